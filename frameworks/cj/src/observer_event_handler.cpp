@@ -20,6 +20,7 @@
 #include "securec.h"
 #include "telephony_errors.h"
 #include "telephony_observer_impl.h"
+#include "telephony_observer_options.h"
 #include "telephony_state_manager.h"
 
 namespace OHOS {
@@ -232,9 +233,18 @@ int32_t ObserverEventHandler::RegisterEventListener(EventListener &eventListener
             TELEPHONY_LOGE("error by observer nullptr");
             return TELEPHONY_ERR_LOCAL_PTR_NULL;
         }
+        // only the fields FfiTelephonyObserver converts are sent
+        TelephonyObserverOptions options;
+        if (eventListener.eventType == TelephonyUpdateEventType::EVENT_SIGNAL_STRENGTHS_UPDATE) {
+            options.signalInfoProjection_ = SIGNAL_INFO_FIELD_LEVEL | SIGNAL_INFO_FIELD_DBM;
+        } else if (eventListener.eventType == TelephonyUpdateEventType::EVENT_NETWORK_STATE_UPDATE) {
+            options.networkStateProjection_ = NETWORK_STATE_FIELD_REG_STATE | NETWORK_STATE_FIELD_ROAMING |
+                NETWORK_STATE_FIELD_CFG_TECH | NETWORK_STATE_FIELD_OPERATOR | NETWORK_STATE_FIELD_NR_STATE |
+                NETWORK_STATE_FIELD_EMERGENCY;
+        }
         int32_t addResult = TelephonyStateManager::AddStateObserver(
             observer, eventListener.slotId, static_cast<uint32_t>(eventListener.eventType),
-            eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_UPDATE);
+            eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_UPDATE, options);
         if (addResult != TELEPHONY_SUCCESS) {
             TELEPHONY_LOGE("AddStateObserver failed, ret=%{public}d!", addResult);
             return addResult;
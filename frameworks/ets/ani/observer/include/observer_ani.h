@@ -62,7 +62,7 @@ public:
 };
 
 bool IsValidSlotIdEx(int32_t slotId, uint32_t eventType);
-ArktsError EventListenerRegister(int32_t slotId, uint32_t eventType);
+ArktsError EventListenerRegister(int32_t slotId, uint32_t eventType, uint32_t deliveryMode, uint32_t deliveryPeriodMs);
 ArktsError EventListenerUnRegister(int32_t slotId, uint32_t eventType);
 
 } //namespace ObserverAni
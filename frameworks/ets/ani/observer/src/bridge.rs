@@ -43,6 +43,17 @@ impl From<i32> for DataFlowType {
 #[derive(Debug)]
 pub struct ObserverOptions {
     pub slot_id: i32,
+    pub delivery_mode: Option<DeliveryMode>,
+    pub delivery_period: Option<i32>,
+}
+
+#[ani_rs::ani(path = "@ohos.telephony.observer.observer.DeliveryMode")]
+#[repr(i32)]
+#[derive(Debug, Clone, Copy)]
+pub enum DeliveryMode {
+    Every = 0,
+    LatestOnly = 1,
+    Periodic = 2,
 }
 
 #[ani_rs::ani(path = "@ohos.telephony.sim.sim.SimState")]
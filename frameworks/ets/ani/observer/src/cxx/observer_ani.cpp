@@ -17,6 +17,7 @@
 #include "observer_ani.h"
 #include "telephony_log_wrapper.h"
 #include "telephony_errors.h"
+#include "telephony_observer_options.h"
 #include "telephony_state_manager.h"
 #include "telephony_types.h"
 #include "state_registry_errors.h"
@@ -188,7 +189,7 @@ bool IsValidSlotIdEx(int32_t slotId, uint32_t eventType)
     return ((slotId >= defaultSlotId) && (slotId < SIM_SLOT_COUNT + 1));
 }
 
-ArktsError EventListenerRegister(int32_t slotId, uint32_t eventType)
+ArktsError EventListenerRegister(int32_t slotId, uint32_t eventType, uint32_t deliveryMode, uint32_t deliveryPeriodMs)
 {
     int32_t errorCode;
 
@@ -202,8 +203,21 @@ ArktsError EventListenerRegister(int32_t slotId, uint32_t eventType)
     bool isUpdate = (eventType == static_cast<uint32_t>(TelephonyUpdateEventType::EVENT_CALL_STATE_UPDATE) ||
         eventType == static_cast<uint32_t>(TelephonyUpdateEventType::EVENT_CALL_STATE_EX_UPDATE) ||
         eventType == static_cast<uint32_t>(TelephonyUpdateEventType::EVENT_CCALL_STATE_UPDATE));
+    Telephony::TelephonyObserverOptions options;
+    options.SetDeliveryPolicy(eventType,
+        deliveryMode > Telephony::DELIVERY_MODE_PERIODIC ? Telephony::DELIVERY_MODE_EVERY : deliveryMode,
+        deliveryPeriodMs);
+    // only the fields AniTelephonyObserver converts are sent
+    if (eventType == static_cast<uint32_t>(TelephonyUpdateEventType::EVENT_SIGNAL_STRENGTHS_UPDATE)) {
+        options.signalInfoProjection_ = Telephony::SIGNAL_INFO_FIELD_LEVEL | Telephony::SIGNAL_INFO_FIELD_DBM;
+    } else if (eventType == static_cast<uint32_t>(TelephonyUpdateEventType::EVENT_NETWORK_STATE_UPDATE)) {
+        options.networkStateProjection_ = Telephony::NETWORK_STATE_FIELD_REG_STATE |
+            Telephony::NETWORK_STATE_FIELD_ROAMING | Telephony::NETWORK_STATE_FIELD_CFG_TECH |
+            Telephony::NETWORK_STATE_FIELD_OPERATOR | Telephony::NETWORK_STATE_FIELD_NR_STATE |
+            Telephony::NETWORK_STATE_FIELD_EMERGENCY;
+    }
     errorCode = Telephony::TelephonyStateManager::AddStateObserver(
-        observer, slotId, eventType, isUpdate);
+        observer, slotId, eventType, isUpdate, options);
     if (errorCode == TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED) {
         ArktsError ArktsErr = {
             .errorCode = JS_ERROR_TELEPHONY_PERMISSION_DENIED,
@@ -45,7 +45,8 @@ pub fn on_cellular_data_flow_change_option(
         TelephonyUpdateEventType::EventCellularDataFlowUpdate,
         options.slot_id,
         CallbackFlavor::CellularDataFlowChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -131,7 +132,8 @@ pub fn on_sim_state_change_option(
         TelephonyUpdateEventType::EventSimStateUpdate,
         options.slot_id,
         CallbackFlavor::SimStateChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -178,7 +180,8 @@ pub fn on_signal_info_change_option(
         TelephonyUpdateEventType::EventSignalStrengthsUpdate,
         options.slot_id,
         CallbackFlavor::SignalInfoChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -225,7 +228,8 @@ pub fn on_cell_info_change_option(
         TelephonyUpdateEventType::EventCellInfoUpdate,
         options.slot_id,
         CallbackFlavor::CellInfoChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -275,7 +279,8 @@ pub fn on_cellular_data_connection_state_change_option(
         TelephonyUpdateEventType::EventDataConnectionUpdate,
         options.slot_id,
         CallbackFlavor::CellularDataConnectionStateChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -327,7 +332,8 @@ pub fn on_network_state_change_option(
         TelephonyUpdateEventType::EventNetworkStateUpdate,
         options.slot_id,
         CallbackFlavor::NetworkStateChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
@@ -374,7 +380,8 @@ pub fn on_call_state_change_option(
         TelephonyUpdateEventType::EventCallStateUpdate,
         options.slot_id,
         CallbackFlavor::CallStateChange(callback_global),
-    );
+    )
+    .with_options(&options);
     Register::get_instance().register(listener)?;
 
     Ok(())
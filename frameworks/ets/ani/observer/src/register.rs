@@ -78,6 +78,8 @@ pub struct EventListener {
     event_type: TelephonyUpdateEventType,
     slot_id: i32,
     callback_ref: CallbackFlavor,
+    delivery_mode: u32,
+    delivery_period: u32,
 }
 
 impl EventListener {
@@ -90,6 +92,27 @@ impl EventListener {
             event_type,
             slot_id,
             callback_ref,
+            delivery_mode: 0,
+            delivery_period: 0,
+        }
+    }
+
+    pub fn with_options(mut self, options: &bridge::ObserverOptions) -> Self {
+        if let Some(mode) = options.delivery_mode {
+            self.delivery_mode = mode as u32;
+        }
+        if let Some(period) = options.delivery_period {
+            self.delivery_period = period.max(0) as u32;
+        }
+        self
+    }
+
+    // the period only matters to DeliveryMode::Periodic
+    fn get_delivery(&self) -> (u32, u32) {
+        if self.delivery_mode == bridge::DeliveryMode::Periodic as u32 {
+            (self.delivery_mode, self.delivery_period)
+        } else {
+            (self.delivery_mode, 0)
         }
     }
 }
@@ -140,6 +163,24 @@ impl Register {
         return flag;
     }
 
+    // listeners of one slot and event type share an observer, which is notified as often as the most eager
+    // of them wants: every update, then latest only, then the shortest period
+    fn merge_delivery(listener_list: &Vec<EventListener>, listener: &EventListener) -> (u32, u32) {
+        let mut delivery = listener.get_delivery();
+        for listen_item in listener_list {
+            if listen_item.slot_id != listener.slot_id || listen_item.event_type != listener.event_type {
+                continue;
+            }
+            let item_delivery = listen_item.get_delivery();
+            if item_delivery.0 < delivery.0
+                || (item_delivery.0 == delivery.0 && item_delivery.1 < delivery.1)
+            {
+                delivery = item_delivery;
+            }
+        }
+        delivery
+    }
+
     pub fn register(&self, listener: EventListener) -> Result<(), BusinessError> {
         if !wrapper::ffi::IsValidSlotIdEx(listener.slot_id, listener.event_type.to_u32()) {
             telephony_error!("Register slotId {} is invalid", listener.slot_id);
@@ -152,9 +193,21 @@ impl Register {
             telephony_error!("RegisterEventListener Callback is already registered.");
             return Ok(());
         }
-        if register_status != EventListenerStatus::EventListenerSlotidAndEventtypeSame {
-            let arkts_error =
-                wrapper::ffi::EventListenerRegister(listener.slot_id, listener.event_type.to_u32());
+        let delivery = Self::merge_delivery(&inner, &listener);
+        let registered = inner
+            .iter()
+            .find(|item| item.slot_id == listener.slot_id && item.event_type == listener.event_type)
+            .map(|item| Self::merge_delivery(&inner, item));
+        if register_status != EventListenerStatus::EventListenerSlotidAndEventtypeSame
+            || registered != Some(delivery)
+        {
+            // the service keeps the observer already registered and only changes its delivery
+            let arkts_error = wrapper::ffi::EventListenerRegister(
+                listener.slot_id,
+                listener.event_type.to_u32(),
+                delivery.0,
+                delivery.1,
+            );
             if arkts_error.is_error() {
                 telephony_error!(
                     "EventListenerRegister error, {}, {}",
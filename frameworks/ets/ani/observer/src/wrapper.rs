@@ -115,7 +115,12 @@ pub(crate) mod ffi {
     unsafe extern "C++" {
         include!("observer_ani.h");
         fn IsValidSlotIdEx(slotId: i32, eventType: u32) -> bool;
-        fn EventListenerRegister(slotId: i32, eventType: u32) -> ArktsError;
+        fn EventListenerRegister(
+            slotId: i32,
+            eventType: u32,
+            deliveryMode: u32,
+            deliveryPeriodMs: u32,
+        ) -> ArktsError;
         fn EventListenerUnRegister(slotId: i32, eventType: u32) -> ArktsError;
     }
 }
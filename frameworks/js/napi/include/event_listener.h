@@ -17,18 +17,35 @@
 #define EVENT_LISTENER_H
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 
 #include "napi/native_api.h"
 #include "telephony_update_event_type.h"
 
 namespace OHOS {
 namespace Telephony {
+/**
+ * Pacing of a listener asking for a less eager delivery than the observer it shares with the other listeners of
+ * its event type and slot, which is registered with the most eager of them.
+ */
+struct EventListenerPacing {
+    int64_t lastDeliveredMs = 0;
+    // queues the latest update held back for the listener, nullptr if none is
+    std::function<void()> pending = nullptr;
+};
+
 struct EventListener {
     napi_env env = nullptr;
     TelephonyUpdateEventType eventType = TelephonyUpdateEventType::NONE_EVENT_TYPE;
     int32_t slotId = 0;
     napi_ref callbackRef = nullptr;
     std::shared_ptr<bool> isDeleting = nullptr;
+    uint32_t networkStateFields = 0;
+    uint32_t dataConnectionStateFields = 0;
+    uint32_t deliveryMode = 0;
+    uint32_t deliveryPeriodMs = 0;
+    std::shared_ptr<EventListenerPacing> pacing = nullptr;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -21,6 +21,7 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <utility>
 #include <uv.h>
 
 #include "event_handler.h"
@@ -32,6 +33,7 @@
 #include "signal_information.h"
 #include "singleton.h"
 #include "telephony_callback_event_id.h"
+#include "telephony_observer_options.h"
 #include "telephony_update_event_type.h"
 
 namespace OHOS {
@@ -60,6 +62,8 @@ private:
         void (*)(uv_work_t *work, std::unique_lock<std::mutex> &lock)> workFuncMap_;
     static std::mutex operatorMutex_;
     std::list<EventListener> listenerList_;
+    // delivery the observer of each (slot, event type) is registered with
+    std::map<std::pair<int32_t, TelephonyUpdateEventType>, DeliveryPolicy> registeredDelivery_;
 
 private:
     void AddBasicHandlerToMap();
@@ -74,6 +78,8 @@ private:
         std::list<EventListener> &removeListenerList, std::set<int32_t> &soltIdSet);
     void CheckRemoveStateObserver(TelephonyUpdateEventType eventType, int32_t slotId, int32_t &result);
     int32_t CheckEventListenerRegister(EventListener &eventListener);
+    TelephonyObserverOptions GetObserverOptions(int32_t slotId, TelephonyUpdateEventType eventType);
+    int32_t AddStateObserver(const EventListener &eventListener, const TelephonyObserverOptions &options);
     bool IsNeedHandleCallbackUpdate(TelephonyUpdateEventType eventType,
         TelephonyUpdateEventType curEventType, int32_t eventSlotId, int32_t curSlotId);
 
@@ -97,6 +103,10 @@ private:
     void HandleCallbackInfoUpdate(const AppExecFwk::InnerEvent::Pointer &event);
     template<TelephonyUpdateEventType eventType>
     void HandleCallbackVoidUpdate(const AppExecFwk::InnerEvent::Pointer &event);
+    template<typename T, typename D>
+    static bool QueueCallbackInfoUpdate(const EventListener &listen, const D &info);
+    template<typename T, typename D>
+    bool HoldCallbackInfoUpdate(const EventListener &listen, const D &info);
 };
 } // namespace Telephony
 } // namespace OHOS
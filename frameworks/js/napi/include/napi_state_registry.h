@@ -106,6 +106,10 @@ struct ObserverContext : BaseContext {
     int32_t slotId = DEFAULT_SIM_SLOT_ID;
     TelephonyUpdateEventType eventType = TelephonyUpdateEventType::NONE_EVENT_TYPE;
     int32_t errorCode = 0;
+    uint32_t networkStateFields = 0;
+    uint32_t dataConnectionStateFields = 0;
+    uint32_t deliveryMode = 0;
+    uint32_t deliveryPeriodMs = 0;
     std::list<EventListener> removeListenerList {};
 };
 } // namespace Telephony
@@ -30,19 +30,27 @@ namespace Telephony {
 struct CallStateContext : EventListener {
     int32_t callState;
     std::u16string phoneNumber;
+    uint64_t sequence = 0;
+    int64_t timestampMs = 0;
     CallStateContext &operator=(const CallStateUpdateInfo &info)
     {
         callState = info.callState_;
         phoneNumber = info.phoneNumber_;
+        sequence = info.sequence_;
+        timestampMs = info.timestampMs_;
         return *this;
     }
 };
 
 struct CallStateExContext : EventListener {
     int32_t callStateEx;
+    uint64_t sequence = 0;
+    int64_t timestampMs = 0;
     CallStateExContext &operator=(const CallStateExUpdateInfo &info)
     {
         callStateEx = info.callStateEx_;
+        sequence = info.sequence_;
+        timestampMs = info.timestampMs_;
         return *this;
     }
 };
@@ -58,9 +66,13 @@ struct SignalListContext : EventListener {
 
 struct NetworkStateContext : EventListener {
     sptr<NetworkState> networkState = nullptr;
+    uint64_t sequence = 0;
+    int64_t timestampMs = 0;
     NetworkStateContext &operator=(const NetworkStateUpdateInfo &info)
     {
         networkState = info.networkState_;
+        sequence = info.sequence_;
+        timestampMs = info.timestampMs_;
         return *this;
     }
 };
@@ -69,11 +81,15 @@ struct SimStateContext : EventListener {
     CardType cardType;
     SimState simState;
     LockReason reason;
+    uint64_t sequence = 0;
+    int64_t timestampMs = 0;
     SimStateContext &operator=(const SimStateUpdateInfo &info)
     {
         cardType = info.type_;
         simState = info.state_;
         reason = info.reason_;
+        sequence = info.sequence_;
+        timestampMs = info.timestampMs_;
         return *this;
     }
 };
@@ -90,10 +106,14 @@ struct CellInfomationContext : EventListener {
 struct CellularDataConnectStateContext : EventListener {
     int32_t dataState;
     int32_t networkType;
+    uint64_t sequence = 0;
+    int64_t timestampMs = 0;
     CellularDataConnectStateContext &operator=(const CellularDataConnectState &info)
     {
         dataState = info.dataState_;
         networkType = info.networkType_;
+        sequence = info.sequence_;
+        timestampMs = info.timestampMs_;
         return *this;
     }
 };
@@ -25,12 +25,21 @@
 #include "refbase.h"
 #include "signal_information.h"
 #include "sim_state_type.h"
+#include "telephony_observer_update_stamp.h"
 
 namespace OHOS {
 namespace Telephony {
 struct UpdateInfo {
     int32_t slotId_ = 0;
-    explicit UpdateInfo(int32_t slotId) : slotId_(slotId) {}
+    // stamp of the update being delivered to the observer callback creating this info
+    uint64_t sequence_ = 0;
+    int64_t timestampMs_ = 0;
+    explicit UpdateInfo(int32_t slotId) : slotId_(slotId)
+    {
+        TelephonyObserverUpdateStamp stamp = TelephonyObserverUpdateStamp::GetCurrent();
+        sequence_ = stamp.sequence;
+        timestampMs_ = stamp.timestampMs;
+    }
 };
 
 struct CallStateUpdateInfo : public UpdateInfo {
@@ -15,6 +15,8 @@
 
 #include "event_listener_handler.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cinttypes>
 
 #include "event_listener_manager.h"
@@ -203,6 +205,16 @@ napi_status NapiReturnToJS(
     return status;
 }
 
+void SetUpdateStampToNapiObject(napi_env env, napi_value object, uint64_t sequence, int64_t timestampMs)
+{
+    // updates from a registry not stamping them carry neither property
+    if (sequence == 0) {
+        return;
+    }
+    SetPropertyToNapiObject(env, object, "sequence", static_cast<int64_t>(sequence));
+    SetPropertyToNapiObject(env, object, "timestamp", timestampMs);
+}
+
 napi_value SignalInfoConversion(napi_env env, int32_t type, int32_t level, int32_t signalIntensity)
 {
     napi_value val = nullptr;
@@ -312,6 +324,12 @@ bool InitLoop(napi_env env, uv_loop_s **loop)
 #endif // NAPI_VERSION >= 2
     return *loop != nullptr;
 }
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
 } // namespace
 
 std::map<TelephonyUpdateEventType,
@@ -464,6 +482,83 @@ int32_t EventListenerHandler::CheckEventListenerRegister(EventListener &eventLis
     return flag;
 }
 
+TelephonyObserverOptions EventListenerHandler::GetObserverOptions(int32_t slotId, TelephonyUpdateEventType eventType)
+{
+    // listeners of one slot and event type share an observer, which is notified for the fields any of them wants
+    auto mergeFields = [](uint32_t fields, uint32_t other) {
+        return (fields == 0 || other == 0) ? 0 : (fields | other);
+    };
+    // and as often as the most eager of them wants: every update, then latest only, then the shortest period.
+    // The less eager listeners are paced here, see HoldCallbackInfoUpdate
+    auto mergeDelivery = [](DeliveryPolicy &delivery, const EventListener &listen) {
+        if (listen.deliveryMode < delivery.mode) {
+            delivery.mode = listen.deliveryMode;
+            delivery.periodMs = listen.deliveryPeriodMs;
+        } else if (listen.deliveryMode == DELIVERY_MODE_PERIODIC && delivery.mode == DELIVERY_MODE_PERIODIC) {
+            delivery.periodMs = std::min(delivery.periodMs, listen.deliveryPeriodMs);
+        }
+    };
+    TelephonyObserverOptions options;
+    DeliveryPolicy delivery;
+    bool isFirst = true;
+    for (auto &listen : listenerList_) {
+        if (listen.slotId != slotId || listen.eventType != eventType) {
+            continue;
+        }
+        if (isFirst) {
+            options.networkStateFields_ = listen.networkStateFields;
+            options.dataConnectionStateFields_ = listen.dataConnectionStateFields;
+            delivery.mode = listen.deliveryMode;
+            delivery.periodMs = listen.deliveryPeriodMs;
+            isFirst = false;
+            continue;
+        }
+        options.networkStateFields_ = mergeFields(options.networkStateFields_, listen.networkStateFields);
+        options.dataConnectionStateFields_ =
+            mergeFields(options.dataConnectionStateFields_, listen.dataConnectionStateFields);
+        mergeDelivery(delivery, listen);
+    }
+    options.SetDeliveryPolicy(ToUint32t(eventType), delivery.mode, delivery.periodMs);
+    return options;
+}
+
+int32_t EventListenerHandler::AddStateObserver(
+    const EventListener &eventListener, const TelephonyObserverOptions &options)
+{
+    NapiTelephonyObserver *telephonyObserver = std::make_unique<NapiTelephonyObserver>().release();
+    if (telephonyObserver == nullptr) {
+        TELEPHONY_LOGE("error by telephonyObserver nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    sptr<TelephonyObserverBroker> observer(telephonyObserver);
+    if (observer == nullptr) {
+        TELEPHONY_LOGE("error by observer nullptr");
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
+    bool isUpdate = (eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_UPDATE ||
+        eventListener.eventType == TelephonyUpdateEventType::EVENT_SIM_STATE_UPDATE ||
+        eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_EX_UPDATE ||
+        eventListener.eventType == TelephonyUpdateEventType::EVENT_CCALL_STATE_UPDATE ||
+        eventListener.eventType == TelephonyUpdateEventType::EVENT_SIM_ACTIVE_STATE);
+    // NapiTelephonyObserver rebuilds network state and cell information from deltas
+    TelephonyObserverOptions observerOptions = options;
+    observerOptions.deltaEncoding_ = (eventListener.eventType == TelephonyUpdateEventType::EVENT_NETWORK_STATE_UPDATE ||
+        eventListener.eventType == TelephonyUpdateEventType::EVENT_CELL_INFO_UPDATE);
+    // and only hands the network type, level and dBm of a signal to JS
+    if (eventListener.eventType == TelephonyUpdateEventType::EVENT_SIGNAL_STRENGTHS_UPDATE) {
+        observerOptions.signalInfoProjection_ = SIGNAL_INFO_FIELD_LEVEL | SIGNAL_INFO_FIELD_DBM;
+    }
+    int32_t addResult = TelephonyStateManager::AddStateObserver(
+        observer, eventListener.slotId, ToUint32t(eventListener.eventType), isUpdate, observerOptions);
+    if (addResult != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("AddStateObserver failed, ret=%{public}d!", addResult);
+        return addResult;
+    }
+    registeredDelivery_[std::make_pair(eventListener.slotId, eventListener.eventType)] =
+        options.GetDeliveryPolicy(ToUint32t(eventListener.eventType));
+    return addResult;
+}
+
 int32_t EventListenerHandler::RegisterEventListener(EventListener &eventListener)
 {
     std::unique_lock<std::mutex> lock(operatorMutex_);
@@ -471,28 +566,35 @@ int32_t EventListenerHandler::RegisterEventListener(EventListener &eventListener
     if (registerStatus == EVENT_LISTENER_SAME) {
         return TELEPHONY_ERR_CALLBACK_ALREADY_REGISTERED;
     }
+    if (eventListener.deliveryMode != DELIVERY_MODE_EVERY) {
+        eventListener.pacing = std::make_shared<EventListenerPacing>();
+    }
     if (registerStatus != EVENT_LISTENER_SLOTID_AND_EVENTTYPE_SAME) {
-        NapiTelephonyObserver *telephonyObserver = std::make_unique<NapiTelephonyObserver>().release();
-        if (telephonyObserver == nullptr) {
-            TELEPHONY_LOGE("error by telephonyObserver nullptr");
-            return TELEPHONY_ERR_LOCAL_PTR_NULL;
-        }
-        sptr<TelephonyObserverBroker> observer(telephonyObserver);
-        if (observer == nullptr) {
-            TELEPHONY_LOGE("error by observer nullptr");
-            return TELEPHONY_ERR_LOCAL_PTR_NULL;
-        }
-        bool isUpdate = (eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_UPDATE ||
-            eventListener.eventType == TelephonyUpdateEventType::EVENT_SIM_STATE_UPDATE ||
-            eventListener.eventType == TelephonyUpdateEventType::EVENT_CALL_STATE_EX_UPDATE ||
-            eventListener.eventType == TelephonyUpdateEventType::EVENT_CCALL_STATE_UPDATE ||
-            eventListener.eventType == TelephonyUpdateEventType::EVENT_SIM_ACTIVE_STATE);
-        int32_t addResult = TelephonyStateManager::AddStateObserver(
-            observer, eventListener.slotId, ToUint32t(eventListener.eventType), isUpdate);
+        TelephonyObserverOptions options;
+        options.networkStateFields_ = eventListener.networkStateFields;
+        options.dataConnectionStateFields_ = eventListener.dataConnectionStateFields;
+        options.SetDeliveryPolicy(
+            ToUint32t(eventListener.eventType), eventListener.deliveryMode, eventListener.deliveryPeriodMs);
+        int32_t addResult = AddStateObserver(eventListener, options);
         if (addResult != TELEPHONY_SUCCESS) {
-            TELEPHONY_LOGE("AddStateObserver failed, ret=%{public}d!", addResult);
             return addResult;
         }
+    } else {
+        TelephonyObserverOptions registered = GetObserverOptions(eventListener.slotId, eventListener.eventType);
+        listenerList_.push_back(eventListener);
+        TelephonyObserverOptions options = GetObserverOptions(eventListener.slotId, eventListener.eventType);
+        listenerList_.pop_back();
+        DeliveryPolicy delivery = options.GetDeliveryPolicy(ToUint32t(eventListener.eventType));
+        DeliveryPolicy registeredDelivery = registered.GetDeliveryPolicy(ToUint32t(eventListener.eventType));
+        if (options.networkStateFields_ != registered.networkStateFields_ ||
+            options.dataConnectionStateFields_ != registered.dataConnectionStateFields_ ||
+            delivery.mode != registeredDelivery.mode || delivery.periodMs != registeredDelivery.periodMs) {
+            // the service keeps the observer already registered and only widens its fields and delivery
+            int32_t addResult = AddStateObserver(eventListener, options);
+            if (addResult != TELEPHONY_SUCCESS) {
+                return addResult;
+            }
+        }
     }
     listenerList_.push_back(eventListener);
     TELEPHONY_LOGI("EventListenerHandler::RegisterEventListener listenerList_ size=%{public}d",
@@ -554,6 +656,7 @@ void EventListenerHandler::RemoveEventListenerRegister(napi_env env, TelephonyUp
 void EventListenerHandler::CheckRemoveStateObserver(TelephonyUpdateEventType eventType, int32_t slotId, int32_t &result)
 {
     if (!CheckEventTypeExist(slotId, eventType)) {
+        registeredDelivery_.erase(std::make_pair(slotId, eventType));
         int32_t removeRet = TelephonyStateManager::RemoveStateObserver(slotId, ToUint32t(eventType));
         if (removeRet != TELEPHONY_SUCCESS) {
             TELEPHONY_LOGE("EventListenerHandler::RemoveStateObserver slotId %{public}d, eventType %{public}d fail!",
@@ -673,37 +776,93 @@ void EventListenerHandler::HandleCallbackInfoUpdate(const AppExecFwk::InnerEvent
         if (!IsNeedHandleCallbackUpdate(listen.eventType, eventType, listen.slotId, info->slotId_)) {
             continue;
         }
-        uv_loop_s *loop = nullptr;
-        if (!InitLoop(listen.env, &loop)) {
-            TELEPHONY_LOGE("loop is null");
-            break;
-        }
-        T *context = std::make_unique<T>().release();
-        if (context == nullptr) {
-            TELEPHONY_LOGE("make context failed");
-            break;
-        }
-        *(static_cast<EventListener *>(context)) = listen;
-        *context = *info;
-        uv_work_t *work = std::make_unique<uv_work_t>().release();
-        if (work == nullptr) {
-            TELEPHONY_LOGE("make work failed");
-            break;
+        if (HoldCallbackInfoUpdate<T, D>(listen, *info)) {
+            continue;
         }
-        work->data = static_cast<void *>(context);
-        int32_t resultCode =
-            uv_queue_work_with_qos(loop, work, [](uv_work_t *) {}, WorkUpdated, uv_qos_default);
-        if (resultCode != 0) {
-            delete context;
-            context = nullptr;
-            TELEPHONY_LOGE("HandleCallbackInfoUpdate failed, result: %{public}d", resultCode);
-            delete work;
-            work = nullptr;
+        if (!QueueCallbackInfoUpdate<T, D>(listen, *info)) {
             return;
         }
     }
 }
 
+template<typename T, typename D>
+bool EventListenerHandler::QueueCallbackInfoUpdate(const EventListener &listen, const D &info)
+{
+    uv_loop_s *loop = nullptr;
+    if (!InitLoop(listen.env, &loop)) {
+        TELEPHONY_LOGE("loop is null");
+        return false;
+    }
+    T *context = std::make_unique<T>().release();
+    if (context == nullptr) {
+        TELEPHONY_LOGE("make context failed");
+        return false;
+    }
+    *(static_cast<EventListener *>(context)) = listen;
+    *context = info;
+    uv_work_t *work = std::make_unique<uv_work_t>().release();
+    if (work == nullptr) {
+        TELEPHONY_LOGE("make work failed");
+        delete context;
+        return false;
+    }
+    work->data = static_cast<void *>(context);
+    int32_t resultCode =
+        uv_queue_work_with_qos(loop, work, [](uv_work_t *) {}, WorkUpdated, uv_qos_default);
+    if (resultCode != 0) {
+        delete context;
+        context = nullptr;
+        TELEPHONY_LOGE("HandleCallbackInfoUpdate failed, result: %{public}d", resultCode);
+        delete work;
+        work = nullptr;
+        return false;
+    }
+    return true;
+}
+
+template<typename T, typename D>
+bool EventListenerHandler::HoldCallbackInfoUpdate(const EventListener &listen, const D &info)
+{
+    std::shared_ptr<EventListenerPacing> pacing = listen.pacing;
+    if (pacing == nullptr) {
+        return false;
+    }
+    // the service already paces the observer as the listener asked for
+    auto registered = registeredDelivery_.find(std::make_pair(listen.slotId, listen.eventType));
+    if (registered == registeredDelivery_.end() || (registered->second.mode == listen.deliveryMode &&
+        (listen.deliveryMode != DELIVERY_MODE_PERIODIC || registered->second.periodMs == listen.deliveryPeriodMs))) {
+        return false;
+    }
+    int64_t windowMs = listen.deliveryMode == DELIVERY_MODE_PERIODIC ?
+        static_cast<int64_t>(listen.deliveryPeriodMs) : DELIVERY_LATEST_ONLY_WINDOW_MS;
+    int64_t nowMs = GetSteadyTimeMs();
+    if (pacing->pending == nullptr && nowMs - pacing->lastDeliveredMs >= windowMs) {
+        pacing->lastDeliveredMs = nowMs;
+        return false;
+    }
+    bool isPosted = pacing->pending != nullptr;
+    // only the latest update is delivered when the window of the listener ends
+    EventListener listener = listen;
+    std::shared_ptr<D> latest = std::make_shared<D>(info);
+    pacing->pending = [listener, latest]() {
+        if (listener.isDeleting != nullptr && !*(listener.isDeleting)) {
+            QueueCallbackInfoUpdate<T, D>(listener, *latest);
+        }
+    };
+    if (!isPosted) {
+        PostTask([pacing]() {
+            std::unique_lock<std::mutex> lock(operatorMutex_);
+            std::function<void()> pending = std::move(pacing->pending);
+            pacing->pending = nullptr;
+            if (pending != nullptr) {
+                pacing->lastDeliveredMs = GetSteadyTimeMs();
+                pending();
+            }
+        }, std::max<int64_t>(pacing->lastDeliveredMs + windowMs - nowMs, 0));
+    }
+    return true;
+}
+
 template<TelephonyUpdateEventType eventType>
 void EventListenerHandler::HandleCallbackVoidUpdate(const AppExecFwk::InnerEvent::Pointer &event)
 {
@@ -788,6 +947,7 @@ void EventListenerHandler::WorkCallStateUpdated(uv_work_t *work, std::unique_loc
     std::string number = NapiUtil::ToUtf8(callStateInfo->phoneNumber);
     SetPropertyToNapiObject(callStateInfo->env, callbackValue, "state", wrappedCallState);
     SetPropertyToNapiObject(callStateInfo->env, callbackValue, "number", number);
+    SetUpdateStampToNapiObject(env, callbackValue, callStateInfo->sequence, callStateInfo->timestampMs);
     NapiReturnToJS(callStateInfo->env, callStateInfo->callbackRef, callbackValue, lock);
     napi_close_handle_scope(env, scope);
 }
@@ -807,6 +967,7 @@ void EventListenerHandler::WorkCallStateExUpdated(uv_work_t *work, std::unique_l
     napi_create_object(callStateExInfo->env, &callbackValue);
     int32_t wrappedCallStateEx = WrapCallStateEx(callStateExInfo->callStateEx);
     SetPropertyToNapiObject(callStateExInfo->env, callbackValue, "state", wrappedCallStateEx);
+    SetUpdateStampToNapiObject(env, callbackValue, callStateExInfo->sequence, callStateExInfo->timestampMs);
     NapiReturnToJS(callStateExInfo->env, callStateExInfo->callbackRef, callbackValue, lock);
     napi_close_handle_scope(env, scope);
 }
@@ -873,6 +1034,8 @@ void EventListenerHandler::WorkNetworkStateUpdated(uv_work_t *work, std::unique_
     SetPropertyToNapiObject(env, callbackValue, "cfgTech", WrapRadioTech(cfgTech));
     SetPropertyToNapiObject(env, callbackValue, "nsaState", nsaState);
     SetPropertyToNapiObject(env, callbackValue, "isCaActive", false);
+    SetUpdateStampToNapiObject(
+        env, callbackValue, networkStateUpdateInfo->sequence, networkStateUpdateInfo->timestampMs);
     NapiReturnToJS(env, networkStateUpdateInfo->callbackRef, callbackValue, lock);
     napi_close_handle_scope(env, scope);
 }
@@ -896,6 +1059,7 @@ void EventListenerHandler::WorkSimStateUpdated(uv_work_t *work, std::unique_lock
     SetPropertyToNapiObject(simStateUpdateInfo->env, callbackValue, "type", cardType);
     SetPropertyToNapiObject(simStateUpdateInfo->env, callbackValue, "state", simState);
     SetPropertyToNapiObject(simStateUpdateInfo->env, callbackValue, "reason", lockReason);
+    SetUpdateStampToNapiObject(env, callbackValue, simStateUpdateInfo->sequence, simStateUpdateInfo->timestampMs);
     NapiReturnToJS(simStateUpdateInfo->env, simStateUpdateInfo->callbackRef, callbackValue, lock);
     napi_close_handle_scope(env, scope);
 }
@@ -937,6 +1101,7 @@ void EventListenerHandler::WorkCellularDataConnectStateUpdated(uv_work_t *work,
     napi_create_object(context->env, &callbackValue);
     SetPropertyToNapiObject(context->env, callbackValue, "state", context->dataState);
     SetPropertyToNapiObject(context->env, callbackValue, "network", context->networkType);
+    SetUpdateStampToNapiObject(env, callbackValue, context->sequence, context->timestampMs);
     NapiReturnToJS(context->env, context->callbackRef, callbackValue, lock);
     napi_close_handle_scope(env, scope);
 }
@@ -1053,7 +1218,7 @@ bool EventListenerHandler::IsNeedHandleCallbackUpdate(TelephonyUpdateEventType e
         return false;
     }
 
-    if (eventSlotId == curSlotId) {
+    if (eventSlotId == curSlotId || eventSlotId == SIM_SLOT_ID_FOR_ALL_SLOTS) {
         return true;
     }
 
@@ -25,6 +25,7 @@
 #include "state_registry_errors.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
+#include "telephony_observer_options.h"
 #include "telephony_state_manager.h"
 
 namespace OHOS {
@@ -71,7 +72,7 @@ static inline bool IsValidSlotIdEx(TelephonyUpdateEventType eventType, int32_t s
     }
     // One more slot for VSim.
     return (((slotId >= defaultSlotId) && (slotId < SIM_SLOT_COUNT + 1)) ||
-        (slotId == SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT));
+        (slotId == SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT) || (slotId == SIM_SLOT_ID_FOR_ALL_SLOTS));
 }
 
 static void NativeOn(napi_env env, void *data)
@@ -102,6 +103,10 @@ static void NativeOn(napi_env env, void *data)
         asyncContext->slotId,
         asyncContext->callbackRef,
         isDeleting,
+        asyncContext->networkStateFields,
+        asyncContext->dataConnectionStateFields,
+        asyncContext->deliveryMode,
+        asyncContext->deliveryPeriodMs,
     };
     asyncContext->errorCode = EventListenerManager::RegisterEventListener(listener);
     if (asyncContext->errorCode == TELEPHONY_SUCCESS) {
@@ -139,6 +144,37 @@ static void OnCallback(napi_env env, void *data)
     delete asyncContext;
 }
 
+static uint32_t GetObserverFields(napi_env env, napi_value object, const char *name)
+{
+    uint32_t fields = 0;
+    napi_value array = NapiUtil::GetNamedProperty(env, object, name);
+    bool isArray = false;
+    if (array == nullptr || napi_is_array(env, array, &isArray) != napi_ok || !isArray) {
+        return fields;
+    }
+    uint32_t length = 0;
+    napi_get_array_length(env, array, &length);
+    for (uint32_t i = 0; i < length; i++) {
+        napi_value element = nullptr;
+        int32_t field = 0;
+        if (napi_get_element(env, array, i, &element) == napi_ok &&
+            napi_get_value_int32(env, element, &field) == napi_ok && field > 0) {
+            fields |= static_cast<uint32_t>(field);
+        }
+    }
+    return fields;
+}
+
+static uint32_t GetObserverUint32(napi_env env, napi_value object, const char *name)
+{
+    napi_value value = NapiUtil::GetNamedProperty(env, object, name);
+    int32_t number = 0;
+    if (value == nullptr || napi_get_value_int32(env, value, &number) != napi_ok || number < 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>(number);
+}
+
 static std::optional<NapiError> MatchParametersWithObject(napi_env env, napi_value* parameters, size_t parameterCount,
     std::array<char, ARRAY_SIZE>& eventType, std::unique_ptr<ObserverContext>&asyncContext)
 {
@@ -161,6 +197,13 @@ static std::optional<NapiError> MatchParametersWithObject(napi_env env, napi_val
             TELEPHONY_LOGI("state registry on slotId = %{public}d, eventType = %{public}d",
                 asyncContext->slotId, asyncContext->eventType);
         }
+        asyncContext->networkStateFields = GetObserverFields(env, object, "networkStateFields");
+        asyncContext->dataConnectionStateFields = GetObserverFields(env, object, "dataConnectionStateFields");
+        asyncContext->deliveryMode = GetObserverUint32(env, object, "deliveryMode");
+        asyncContext->deliveryPeriodMs = GetObserverUint32(env, object, "deliveryPeriod");
+        if (asyncContext->deliveryMode > DELIVERY_MODE_PERIODIC) {
+            asyncContext->deliveryMode = DELIVERY_MODE_EVERY;
+        }
     }
     return errCode;
 }
@@ -506,6 +549,58 @@ napi_status InitEnumLockReason(napi_env env, napi_value exports)
     return napi_define_properties(env, exports, arrSize, desc);
 }
 
+napi_status InitEnumNetworkStateField(napi_env env, napi_value exports)
+{
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "REG_STATE", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_REG_STATE))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "ROAMING", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_ROAMING))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "RADIO_TECH", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_RADIO_TECH))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "CFG_TECH", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_CFG_TECH))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "OPERATOR", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_OPERATOR))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "NR_STATE", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_NR_STATE))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "EMERGENCY", GetNapiValue(env, static_cast<int32_t>(NETWORK_STATE_FIELD_EMERGENCY))),
+    };
+
+    constexpr size_t arrSize = sizeof(desc) / sizeof(desc[0]);
+    NapiUtil::DefineEnumClassByName(env, exports, "NetworkStateField", arrSize, desc);
+    return napi_define_properties(env, exports, arrSize, desc);
+}
+
+napi_status InitEnumDataConnectionStateField(napi_env env, napi_value exports)
+{
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "STATE", GetNapiValue(env, static_cast<int32_t>(DATA_CONNECTION_STATE_FIELD_STATE))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "NETWORK_TYPE", GetNapiValue(env, static_cast<int32_t>(DATA_CONNECTION_STATE_FIELD_NETWORK_TYPE))),
+    };
+
+    constexpr size_t arrSize = sizeof(desc) / sizeof(desc[0]);
+    NapiUtil::DefineEnumClassByName(env, exports, "DataConnectionStateField", arrSize, desc);
+    return napi_define_properties(env, exports, arrSize, desc);
+}
+
+napi_status InitEnumDeliveryMode(napi_env env, napi_value exports)
+{
+    napi_property_descriptor desc[] = {
+        DECLARE_NAPI_STATIC_PROPERTY("EVERY", GetNapiValue(env, static_cast<int32_t>(DELIVERY_MODE_EVERY))),
+        DECLARE_NAPI_STATIC_PROPERTY(
+            "LATEST_ONLY", GetNapiValue(env, static_cast<int32_t>(DELIVERY_MODE_LATEST_ONLY))),
+        DECLARE_NAPI_STATIC_PROPERTY("PERIODIC", GetNapiValue(env, static_cast<int32_t>(DELIVERY_MODE_PERIODIC))),
+    };
+
+    constexpr size_t arrSize = sizeof(desc) / sizeof(desc[0]);
+    NapiUtil::DefineEnumClassByName(env, exports, "DeliveryMode", arrSize, desc);
+    return napi_define_properties(env, exports, arrSize, desc);
+}
+
 EXTERN_C_START
 napi_value InitNapiStateRegistry(napi_env env, napi_value exports)
 {
@@ -519,6 +614,9 @@ napi_value InitNapiStateRegistry(napi_env env, napi_value exports)
     };
     NAPI_CALL(env, napi_define_properties(env, exports, sizeof(desc) / sizeof(desc[0]), desc));
     NAPI_CALL(env, InitEnumLockReason(env, exports));
+    NAPI_CALL(env, InitEnumNetworkStateField(env, exports));
+    NAPI_CALL(env, InitEnumDataConnectionStateField(env, exports));
+    NAPI_CALL(env, InitEnumDeliveryMode(env, exports));
     const char *nativeStr = "InitNapiStateRegistry";
     napi_wrap(
         env, exports, static_cast<void *>(const_cast<char *>(nativeStr)),
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STATE_REGISTRY_INNER_ERRORS_H
+#define STATE_REGISTRY_INNER_ERRORS_H
+
+#include "state_registry_errors.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Error codes owned by the state registry part itself. They extend the ones in
+ * state_registry_errors.h and start after a gap so both sets can grow independently.
+ */
+enum StateRegistryInnerErrorCode {
+    /**
+     * The update was a delta against a value the registry does not have, the producer has to send it in full.
+     */
+    TELEPHONY_STATE_REGISTRY_DELTA_BASE_UNKNOWN = STATE_REGISTRY_ERR_OFFSET + 101,
+    /**
+     * The registration was refused, the uid or the pid of the caller already holds as many records as it may.
+     */
+    TELEPHONY_STATE_REGISTRY_QUOTA_EXCEEDED = STATE_REGISTRY_ERR_OFFSET + 102,
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // STATE_REGISTRY_INNER_ERRORS_H
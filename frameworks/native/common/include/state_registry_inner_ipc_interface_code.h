@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STATE_REGISTRY_INNER_IPC_INTERFACE_CODE_H
+#define STATE_REGISTRY_INNER_IPC_INTERFACE_CODE_H
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Request codes served by the state registry stub on top of StateNotifyInterfaceCode. They are sent by
+ * TelephonyObserverClient directly, and start after a gap so both sets can grow independently.
+ */
+enum class StateNotifyInnerInterfaceCode : uint32_t {
+    ADD_OBSERVER_WITH_OPTIONS = 100,
+    DEFAULT_DATA_SLOT_ID = 101,
+    NET_WORK_STATE_DELTA = 102,
+    CELL_INFO_DELTA = 103,
+    RESYNC_OBSERVER = 104,
+    RESYNC_EVENT_RING = 105,
+    GET_STATE_MIRROR = 106,
+    GET_SIGNAL_STATISTICS = 107,
+    GET_SUBSCRIBER_INTEREST = 108,
+    ADD_INTEREST_OBSERVER = 109,
+    REMOVE_INTEREST_OBSERVER = 110,
+};
+
+/**
+ * Request codes served by TelephonyObserver on top of ObserverBrokerCode, only sent to observers that asked
+ * for them when registering.
+ */
+enum class ObserverBrokerInnerCode : uint32_t {
+    ON_NETWORK_STATE_DELTA_UPDATED = 100,
+    ON_CELL_INFO_DELTA_UPDATED = 101,
+    ON_SIGNAL_INFO_BLOB_UPDATED = 102,
+    ON_CELL_INFO_BLOB_UPDATED = 103,
+    ON_EVENT_RING_ATTACHED = 104,
+    ON_EVENT_RING_DOORBELL = 105,
+    ON_SIGNAL_STATISTICS_UPDATED = 106,
+    ON_SIGNAL_INFO_PROJECTED_UPDATED = 107,
+    ON_NETWORK_STATE_PROJECTED_UPDATED = 108,
+    ON_SUBSCRIBER_INTEREST_UPDATED = 109,
+    ON_UPDATE_BATCH = 110,
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // STATE_REGISTRY_INNER_IPC_INTERFACE_CODE_H
@@ -16,10 +16,21 @@
 #ifndef TELEPHONY_OBSERVER_PROXY_H
 #define TELEPHONY_OBSERVER_PROXY_H
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "ashmem.h"
 #include "iremote_proxy.h"
 
+#include "state_registry_inner_ipc_interface_code.h"
 #include "telephony_log_wrapper.h"
 #include "telephony_observer_broker.h"
+#include "telephony_observer_delta.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_signal_statistics.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -49,8 +60,126 @@ public:
     void OnCCallStateUpdated(int32_t slotId, int32_t callState, const std::u16string &phoneNumber);
     void OnSimActiveStateUpdated(int32_t slotId, bool enable);
 
+    /**
+     * Send network state and cell information as deltas against the value last sent, for observers that
+     * registered with TelephonyObserverOptions::deltaEncoding_.
+     */
+    void SetDeltaEncoding(bool enable);
+
+    /**
+     * Send the next network state and cell information of slotId in full.
+     */
+    void ResetDeltaEncoding(int32_t slotId);
+
+    /**
+     * Send signal information and network state restricted to the given fields, for observers that
+     * registered with TelephonyObserverOptions::signalInfoProjection_ or networkStateProjection_. 0 sends
+     * every field as usual.
+     */
+    void SetProjection(uint32_t signalInfoFields, uint32_t networkStateFields);
+
+    /**
+     * Send a signal information or cell information list that is already marshalled, the element count
+     * followed by the elements, as it is.
+     *
+     * @return bool false if nothing was sent because the list has to be sent typed, e.g. delta encoded.
+     */
+    bool OnSignalInfoBytesUpdated(int32_t slotId, const std::vector<uint8_t> &bytes);
+    bool OnCellInfoBytesUpdated(int32_t slotId, const std::vector<uint8_t> &bytes);
+
+    /**
+     * Send a signal information or cell information list that is already marshalled into a sealed shared
+     * memory region, the observer maps it instead of getting the bytes copied into the transaction.
+     *
+     * @return bool false if nothing was sent because there is no region or the list has to be sent typed.
+     */
+    bool OnSignalInfoBlobUpdated(int32_t slotId, const sptr<Ashmem> &blob);
+    bool OnCellInfoBlobUpdated(int32_t slotId, const sptr<Ashmem> &blob);
+
+    /**
+     * Hand the region of a TelephonyObserverRing to the observer.
+     */
+    void OnEventRingAttached(uint32_t ringId, const sptr<Ashmem> &ashmem);
+
+    /**
+     * Wake the observer to drain a TelephonyObserverRing.
+     */
+    void OnEventRingDoorbell(uint32_t ringId);
+
+    /**
+     * Send the signal statistics of a slot to an observer registered with
+     * TelephonyObserverOptions::signalStatisticsPeriodMs_.
+     */
+    void OnSignalStatisticsUpdated(int32_t slotId, const std::vector<TelephonyObserverSignalStatistics> &statistics);
+
+    /**
+     * Send the subscriber interest to an observer registered as interest observer.
+     */
+    void OnSubscriberInterestUpdated(const std::vector<TelephonyObserverInterest> &interests);
+
+    /**
+     * While in scope, asynchronous updates sent on the calling thread do not wake the observer process up,
+     * it gets them the next time it runs.
+     */
+    class WakeupLaterScope {
+    public:
+        WakeupLaterScope();
+        ~WakeupLaterScope();
+        WakeupLaterScope(const WakeupLaterScope &) = delete;
+        WakeupLaterScope &operator=(const WakeupLaterScope &) = delete;
+
+    private:
+        bool previous_ = false;
+    };
+
+    static constexpr size_t UPDATE_BATCH_NUM_MAX = 32;
+    static constexpr size_t UPDATE_BATCH_SIZE_MAX = 64 * 1024;
+
+    /**
+     * While in scope, asynchronous updates sent on the calling thread are held and every observer gets the
+     * updates held for it in one transaction when the scope ends. An update carrying objects or file
+     * descriptors is sent right away, after the updates held for the same observer.
+     */
+    class BatchScope {
+    public:
+        BatchScope();
+        ~BatchScope();
+        BatchScope(const BatchScope &) = delete;
+        BatchScope &operator=(const BatchScope &) = delete;
+
+    private:
+        friend class TelephonyObserverProxy;
+        struct Batch {
+            sptr<IRemoteObject> remote;
+            std::vector<sptr<TelephonyObserverProxy>> proxies;
+            bool wakeupLater = true;
+            size_t size = 0;
+            std::vector<std::pair<uint32_t, std::vector<uint8_t>>> updates;
+        };
+        bool Hold(TelephonyObserverProxy *proxy, const sptr<IRemoteObject> &remote, int32_t msgId,
+            const MessageParcel &dataParcel, const MessageOption &option);
+        void Flush(const sptr<IRemoteObject> &remote);
+        static void Send(const Batch &batch);
+
+        BatchScope *previous_ = nullptr;
+        std::vector<Batch> batches_;
+    };
+
 private:
     int32_t SendRequest(int32_t msgId, MessageParcel &dataParcel, MessageParcel &replyParcel, MessageOption &option);
+    void SendDelta(ObserverBrokerInnerCode code, int32_t slotId, const TelephonyObserverDeltaValue &value,
+        MessageOption &option);
+    void SendBytes(ObserverBrokerCode code, int32_t slotId, const std::vector<uint8_t> &bytes, MessageOption &option);
+    void SendBlob(ObserverBrokerInnerCode code, int32_t slotId, const sptr<Ashmem> &blob, MessageOption &option);
+
+private:
+    std::atomic<bool> deltaEncoding_ = false;
+    std::atomic<uint32_t> signalInfoProjection_ = 0;
+    std::atomic<uint32_t> networkStateProjection_ = 0;
+    // set when held deltas could not be sent, the next ones are sent in full
+    std::atomic<bool> deltaStale_ = false;
+    std::mutex deltaMutex_;
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverDeltaEncoder> deltaEncoders_;
     static inline BrokerDelegator<TelephonyObserverProxy> delegator_;
 };
 } // namespace Telephony
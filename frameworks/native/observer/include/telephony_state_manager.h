@@ -17,6 +17,7 @@
 #define TELEPHONY_STATE_MANAGER_H
 
 #include <stdint.h>
+#include <vector>
 
 namespace OHOS {
 template<typename T>
@@ -72,12 +73,24 @@ enum class CallStatus {
     CALL_STATUS_ANSWERED,
 };
 
+class CellInformation;
+class NetworkState;
 class TelephonyObserverBroker;
+struct TelephonyObserverInterest;
+class TelephonyObserverOptions;
 class TelephonyStateManager {
 public:
     static int32_t AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
         int32_t slotId, uint32_t mask, bool notifyNow);
+    static int32_t AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
+        int32_t slotId, uint32_t mask, bool notifyNow, const TelephonyObserverOptions &options);
     static int32_t RemoveStateObserver(int32_t slotId, uint32_t mask);
+    static int32_t UpdateDefaultDataSlotId(int32_t slotId);
+    static int32_t UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState);
+    static int32_t UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &cells);
+    static int32_t GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests);
+    static int32_t AddInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask);
+    static int32_t RemoveInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver);
 };
 } // namespace Telephony
 } // namespace OHOS
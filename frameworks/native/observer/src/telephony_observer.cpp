@@ -15,11 +15,65 @@
 
 #include "telephony_observer.h"
 
+#include <functional>
+#include <new>
+
+#include "ashmem.h"
+#include "state_registry_inner_ipc_interface_code.h"
 #include "telephony_errors.h"
 #include "telephony_log_wrapper.h"
+#include "telephony_observer_client.h"
+#include "telephony_observer_projection.h"
+#include "telephony_observer_proxy.h"
 
 namespace OHOS {
 namespace Telephony {
+namespace {
+/**
+ * Lets a parcel read a mapped shared memory region in place, the mapping is released by its Ashmem.
+ */
+class MappedBlobAllocator : public Allocator {
+public:
+    void *Realloc(void *data, size_t newSize) override
+    {
+        return nullptr;
+    }
+
+    void *Alloc(size_t size) override
+    {
+        return nullptr;
+    }
+
+    void Dealloc(void *data) override {}
+};
+} // namespace
+
+/**
+ * Map the shared memory region carried by data and let read parse the list in it.
+ */
+static bool ReadBlob(MessageParcel &data, const std::function<void(MessageParcel &blobParcel)> &read)
+{
+    int32_t size = data.ReadInt32();
+    sptr<Ashmem> blob = data.ReadAshmem();
+    if (blob == nullptr || size <= 0 || size > blob->GetAshmemSize() || !blob->MapReadOnlyAshmem()) {
+        TELEPHONY_LOGE("blob is invalid");
+        return false;
+    }
+    const void *buffer = blob->ReadFromAshmem(size, 0);
+    MappedBlobAllocator *allocator = new (std::nothrow) MappedBlobAllocator();
+    if (buffer == nullptr || allocator == nullptr) {
+        delete allocator;
+        return false;
+    }
+    // declared after blob, so the parcel is gone before the region is unmapped
+    MessageParcel blobParcel(allocator);
+    if (!blobParcel.ParseFrom(reinterpret_cast<uintptr_t>(buffer), static_cast<size_t>(size))) {
+        return false;
+    }
+    read(blobParcel);
+    return true;
+}
+
 void TelephonyObserver::OnCallStateUpdated(
     int32_t slotId, int32_t callState, const std::u16string &phoneNumber) {}
 
@@ -54,6 +108,11 @@ void TelephonyObserver::OnCCallStateUpdated(
 
 void TelephonyObserver::OnSimActiveStateUpdated(int32_t slotId, bool enable) {}
 
+void TelephonyObserver::OnSignalStatisticsUpdated(
+    int32_t slotId, const std::vector<TelephonyObserverSignalStatistics> &statistics) {}
+
+void TelephonyObserver::OnSubscriberInterestUpdated(const std::vector<TelephonyObserverInterest> &interests) {}
+
 TelephonyObserver::TelephonyObserver()
 {
     memberFuncMap_[static_cast<uint32_t>(ObserverBrokerCode::ON_CALL_STATE_UPDATED)] =
@@ -82,6 +141,28 @@ TelephonyObserver::TelephonyObserver()
         [this](MessageParcel &data, MessageParcel &reply) { OnCCallStateUpdatedInner(data, reply); };
     memberFuncMap_[static_cast<uint32_t>(ObserverBrokerCode::ON_SIM_ACTIVE_STATE_UPDATED)] =
         [this](MessageParcel &data, MessageParcel &reply) { OnSimActiveStateUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_NETWORK_STATE_DELTA_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnNetworkStateDeltaUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_CELL_INFO_DELTA_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnCellInfoDeltaUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_SIGNAL_INFO_BLOB_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnSignalInfoBlobUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_CELL_INFO_BLOB_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnCellInfoBlobUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_ATTACHED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnEventRingAttachedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_DOORBELL)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnEventRingDoorbellInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_SIGNAL_STATISTICS_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnSignalStatisticsUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_SIGNAL_INFO_PROJECTED_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnSignalInfoProjectedUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_NETWORK_STATE_PROJECTED_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnNetworkStateProjectedUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_SUBSCRIBER_INTEREST_UPDATED)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnSubscriberInterestUpdatedInner(data, reply); };
+    memberFuncMap_[static_cast<uint32_t>(ObserverBrokerInnerCode::ON_UPDATE_BATCH)] =
+        [this](MessageParcel &data, MessageParcel &reply) { OnUpdateBatchInner(data, reply); };
 }
 
 TelephonyObserver::~TelephonyObserver() {}
@@ -111,6 +192,11 @@ void TelephonyObserver::OnCallStateUpdatedInner(
     int32_t slotId = data.ReadInt32();
     int32_t callState = data.ReadInt32();
     std::u16string phoneNumber = data.ReadString16();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CALL_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCallStateUpdated(slotId, callState, phoneNumber);
 }
 
@@ -120,6 +206,11 @@ void TelephonyObserver::OnSignalInfoUpdatedInner(
     int32_t slotId = data.ReadInt32();
     std::vector<sptr<SignalInformation>> signalInfos;
     ConvertSignalInfoList(data, signalInfos);
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnSignalInfoUpdated(slotId, signalInfos);
 }
 
@@ -132,6 +223,11 @@ void TelephonyObserver::OnNetworkStateUpdatedInner(
         TELEPHONY_LOGE("networkState is null");
         return;
     }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_NETWORK_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnNetworkStateUpdated(slotId, networkState);
 }
 
@@ -141,9 +237,230 @@ void TelephonyObserver::OnCellInfoUpdatedInner(
     int32_t slotId = data.ReadInt32();
     std::vector<sptr<CellInformation>> cells;
     ConvertCellInfoList(data, cells);
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CELL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCellInfoUpdated(slotId, cells);
 }
 
+void TelephonyObserver::OnNetworkStateDeltaUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    TelephonyObserverDeltaValue value;
+    if (!ReadDelta(ObserverBrokerCode::ON_NETWORK_STATE_UPDATED, slotId, data, value)) {
+        return;
+    }
+    sptr<NetworkState> networkState = TelephonyObserverDelta::ToNetworkState(value);
+    if (networkState == nullptr) {
+        TELEPHONY_LOGE("networkState is null");
+        return;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_NETWORK_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnNetworkStateUpdated(slotId, networkState);
+}
+
+void TelephonyObserver::OnCellInfoDeltaUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    TelephonyObserverDeltaValue value;
+    if (!ReadDelta(ObserverBrokerCode::ON_CELL_INFO_UPDATED, slotId, data, value)) {
+        return;
+    }
+    std::vector<sptr<CellInformation>> cells;
+    TelephonyObserverDelta::ToCellInfo(value, cells);
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CELL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnCellInfoUpdated(slotId, cells);
+}
+
+void TelephonyObserver::OnSignalInfoBlobUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    std::vector<sptr<SignalInformation>> signalInfos;
+    auto read = [this, &signalInfos](MessageParcel &blobParcel) { ConvertSignalInfoList(blobParcel, signalInfos); };
+    if (!ReadBlob(data, read)) {
+        return;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnSignalInfoUpdated(slotId, signalInfos);
+}
+
+void TelephonyObserver::OnCellInfoBlobUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    std::vector<sptr<CellInformation>> cells;
+    auto read = [this, &cells](MessageParcel &blobParcel) { ConvertCellInfoList(blobParcel, cells); };
+    if (!ReadBlob(data, read)) {
+        return;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CELL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnCellInfoUpdated(slotId, cells);
+}
+
+void TelephonyObserver::OnEventRingAttachedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    uint32_t ringId = data.ReadUint32();
+    std::shared_ptr<TelephonyObserverRing> ring = TelephonyObserverRing::Attach(ringId, data.ReadAshmem());
+    if (ring == nullptr) {
+        TELEPHONY_LOGE("attach event ring %{public}u failed", ringId);
+        return;
+    }
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    // registering again for the same slot and types replaces the record and so its ring
+    for (auto it = rings_.begin(); it != rings_.end();) {
+        if (it->second->GetSlotId() == ring->GetSlotId() && it->second->GetMask() == ring->GetMask()) {
+            it = rings_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    rings_[ringId] = ring;
+}
+
+void TelephonyObserver::OnEventRingDoorbellInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    uint32_t ringId = data.ReadUint32();
+    std::unique_lock<std::mutex> lock(ringMutex_);
+    auto it = rings_.find(ringId);
+    if (it == rings_.end()) {
+        TELEPHONY_LOGE("event ring %{public}u is unknown", ringId);
+        return;
+    }
+    std::shared_ptr<TelephonyObserverRing> ring = it->second;
+    auto handle = [this](uint32_t code, const uint8_t *body, size_t size) {
+        if (code != static_cast<uint32_t>(ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED) &&
+            code != static_cast<uint32_t>(ObserverBrokerCode::ON_CELL_INFO_UPDATED)) {
+            TELEPHONY_LOGE("event ring record code %{public}u is not expected", code);
+            return;
+        }
+        MappedBlobAllocator *allocator = new (std::nothrow) MappedBlobAllocator();
+        if (allocator == nullptr) {
+            return;
+        }
+        MessageParcel recordParcel(allocator);
+        MessageParcel recordReply;
+        if (recordParcel.ParseFrom(reinterpret_cast<uintptr_t>(body), size)) {
+            memberFuncMap_[code](recordParcel, recordReply);
+        }
+    };
+    bool overflowed = ring->Drain(handle);
+    lock.unlock();
+    if (overflowed) {
+        TELEPHONY_LOGW("event ring %{public}u dropped %{public}llu records, resync", ringId,
+            static_cast<unsigned long long>(ring->GetDropped()));
+        DelayedRefSingleton<TelephonyObserverClient>::GetInstance().ResyncEventRing(this, ringId);
+    }
+}
+
+void TelephonyObserver::OnUpdateBatchInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t count = data.ReadInt32();
+    if (count <= 0 || static_cast<size_t>(count) > TelephonyObserverProxy::UPDATE_BATCH_NUM_MAX) {
+        TELEPHONY_LOGE("update batch count %{public}d is invalid", count);
+        return;
+    }
+    for (int32_t i = 0; i < count; i++) {
+        uint32_t code = data.ReadUint32();
+        int32_t size = data.ReadInt32();
+        if (code == static_cast<uint32_t>(ObserverBrokerInnerCode::ON_UPDATE_BATCH) || size <= 0 ||
+            static_cast<size_t>(size) > TelephonyObserverProxy::UPDATE_BATCH_SIZE_MAX) {
+            TELEPHONY_LOGE("update batch entry %{public}u is invalid", code);
+            return;
+        }
+        const uint8_t *bytes = data.ReadBuffer(size);
+        MessageParcel updateParcel;
+        MessageParcel updateReply;
+        MessageOption option;
+        option.SetFlags(MessageOption::TF_ASYNC);
+        if (bytes == nullptr || !updateParcel.WriteBuffer(bytes, size)) {
+            TELEPHONY_LOGE("read update batch entry %{public}u failed", code);
+            return;
+        }
+        OnRemoteRequest(code, updateParcel, updateReply, option);
+    }
+}
+
+void TelephonyObserver::OnSignalStatisticsUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    std::vector<TelephonyObserverSignalStatistics> statistics;
+    if (!TelephonyObserverSignalStatistics::ReadList(data, statistics)) {
+        TELEPHONY_LOGE("read signal statistics failed");
+        return;
+    }
+    OnSignalStatisticsUpdated(slotId, statistics);
+}
+
+void TelephonyObserver::OnSignalInfoProjectedUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    std::vector<sptr<SignalInformation>> signalInfos;
+    if (!TelephonyObserverProjection::ReadSignalInfo(data, signalInfos)) {
+        TELEPHONY_LOGE("read projected signal information failed");
+        return;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnSignalInfoUpdated(slotId, signalInfos);
+}
+
+void TelephonyObserver::OnNetworkStateProjectedUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    sptr<NetworkState> networkState = TelephonyObserverProjection::ReadNetworkState(data);
+    if (networkState == nullptr) {
+        TELEPHONY_LOGE("networkState is null");
+        return;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_NETWORK_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    OnNetworkStateUpdated(slotId, networkState);
+}
+
+void TelephonyObserver::OnSubscriberInterestUpdatedInner(
+    MessageParcel &data, MessageParcel &reply)
+{
+    std::vector<TelephonyObserverInterest> interests;
+    if (!TelephonyObserverInterest::ReadList(data, interests)) {
+        TELEPHONY_LOGE("read subscriber interest failed");
+        return;
+    }
+    OnSubscriberInterestUpdated(interests);
+}
+
 void TelephonyObserver::OnSimStateUpdatedInner(
     MessageParcel &data, MessageParcel &reply)
 {
@@ -151,6 +468,11 @@ void TelephonyObserver::OnSimStateUpdatedInner(
     CardType type = static_cast<CardType>(data.ReadInt32());
     SimState simState = static_cast<SimState>(data.ReadInt32());
     LockReason reson = static_cast<LockReason>(data.ReadInt32());
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_SIM_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnSimStateUpdated(slotId, type, simState, reson);
 }
 
@@ -160,6 +482,11 @@ void TelephonyObserver::OnCellularDataConnectStateUpdatedInner(
     int32_t slotId = data.ReadInt32();
     int32_t dataState = data.ReadInt32();
     int32_t networkType = data.ReadInt32();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CELLULAR_DATA_CONNECT_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCellularDataConnectStateUpdated(slotId, dataState, networkType);
 }
 
@@ -168,6 +495,11 @@ void TelephonyObserver::OnCellularDataFlowUpdatedInner(
 {
     int32_t slotId = data.ReadInt32();
     int32_t flowType = data.ReadInt32();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CELLULAR_DATA_FLOW_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCellularDataFlowUpdated(slotId, flowType);
 }
 
@@ -176,6 +508,11 @@ void TelephonyObserver::OnCfuIndicatorUpdatedInner(
 {
     int32_t slotId = data.ReadInt32();
     bool cfuResult = data.ReadBool();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CFU_INDICATOR_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCfuIndicatorUpdated(slotId, cfuResult);
 }
 
@@ -184,11 +521,21 @@ void TelephonyObserver::OnVoiceMailMsgIndicatorUpdatedInner(
 {
     int32_t slotId = data.ReadInt32();
     bool voiceMailMsgResult = data.ReadBool();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_VOICE_MAIL_MSG_INDICATOR_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnVoiceMailMsgIndicatorUpdated(slotId, voiceMailMsgResult);
 }
 
 void TelephonyObserver::OnIccAccountUpdatedInner(MessageParcel &data, MessageParcel &reply)
 {
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_ICC_ACCOUNT_UPDATED, -1, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnIccAccountUpdated();
 }
 
@@ -197,6 +544,11 @@ void TelephonyObserver::OnCallStateUpdatedExInner(
 {
     int32_t slotId = data.ReadInt32();
     int32_t callStateEx = data.ReadInt32();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CALL_STATE_EX_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCallStateUpdatedEx(slotId, callStateEx);
 }
 
@@ -204,9 +556,48 @@ void TelephonyObserver::OnSimActiveStateUpdatedInner(MessageParcel &data, Messag
 {
     int32_t slotId = data.ReadInt32();
     bool enable = data.ReadBool();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_SIM_ACTIVE_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnSimActiveStateUpdated(slotId, enable);
 }
 
+bool TelephonyObserver::AcceptUpdateStamp(
+    ObserverBrokerCode code, int32_t slotId, MessageParcel &data, TelephonyObserverUpdateStamp &stamp)
+{
+    if (!stamp.ReadFromParcel(data)) {
+        return true;
+    }
+    std::lock_guard<std::mutex> lock(stampMutex_);
+    TelephonyObserverUpdateStamp &last = lastStamps_[std::make_pair(static_cast<uint32_t>(code), slotId)];
+    if (stamp.IsStale(last)) {
+        TELEPHONY_LOGW("drop stale update code = %{public}u slotId = %{public}d sequence = %{public}llu "
+            "last = %{public}llu", static_cast<uint32_t>(code), slotId,
+            static_cast<unsigned long long>(stamp.sequence), static_cast<unsigned long long>(last.sequence));
+        return false;
+    }
+    last = stamp;
+    return true;
+}
+
+bool TelephonyObserver::ReadDelta(
+    ObserverBrokerCode code, int32_t slotId, MessageParcel &data, TelephonyObserverDeltaValue &value)
+{
+    std::unique_lock<std::mutex> lock(deltaMutex_);
+    if (deltaDecoders_[std::make_pair(static_cast<uint32_t>(code), slotId)].Read(data, value)) {
+        return true;
+    }
+    lock.unlock();
+    uint32_t mask = code == ObserverBrokerCode::ON_NETWORK_STATE_UPDATED ?
+        TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE : TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO;
+    TELEPHONY_LOGW("delta of code = %{public}u slotId = %{public}d cannot be applied, resync",
+        static_cast<uint32_t>(code), slotId);
+    DelayedRefSingleton<TelephonyObserverClient>::GetInstance().ResyncStateObserver(this, slotId, mask);
+    return false;
+}
+
 void TelephonyObserver::ConvertSignalInfoList(
     MessageParcel &data, std::vector<sptr<SignalInformation>> &result)
 {
@@ -322,6 +713,11 @@ void TelephonyObserver::OnCCallStateUpdatedInner(
     int32_t slotId = data.ReadInt32();
     int32_t callState = data.ReadInt32();
     std::u16string phoneNumber = data.ReadString16();
+    TelephonyObserverUpdateStamp stamp;
+    if (!AcceptUpdateStamp(ObserverBrokerCode::ON_CCALL_STATE_UPDATED, slotId, data, stamp)) {
+        return;
+    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     OnCCallStateUpdated(slotId, callState, phoneNumber);
 }
 } // namespace Telephony
@@ -18,6 +18,8 @@
 #include "if_system_ability_manager.h"
 #include "iservice_registry.h"
 #include "state_registry_errors.h"
+#include "state_registry_inner_errors.h"
+#include "state_registry_inner_ipc_interface_code.h"
 #include "system_ability_definition.h"
 #include "telephony_log_wrapper.h"
 #include "telephony_state_registry_proxy.h"
@@ -75,6 +77,8 @@ void TelephonyObserverClient::OnRemoteDied(const wptr<IRemoteObject> &remote)
     if ((serviceRemote != nullptr) && (serviceRemote == remote.promote())) {
         serviceRemote->RemoveDeathRecipient(deathRecipient_);
         proxy_ = nullptr;
+        // the region of a restarted registry is a new one
+        std::atomic_store(&mirror_, std::shared_ptr<TelephonyObserverMirror>());
         TELEPHONY_LOGE("on remote died");
     }
 }
@@ -90,6 +94,42 @@ int32_t TelephonyObserverClient::AddStateObserver(const sptr<TelephonyObserverBr
     return proxy->RegisterStateChange(telephonyObserver, slotId, mask, isUpdate);
 }
 
+int32_t TelephonyObserverClient::AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
+    int32_t slotId, uint32_t mask, bool isUpdate, const TelephonyObserverOptions &options)
+{
+    if (options.IsDefault()) {
+        return AddStateObserver(telephonyObserver, slotId, mask, isUpdate);
+    }
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    if (telephonyObserver == nullptr) {
+        TELEPHONY_LOGE("telephonyObserver is null!");
+        return TELEPHONY_ERR_ARGUMENT_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteInt32(slotId) || !data.WriteInt32(static_cast<int32_t>(mask)) || !data.WriteBool(isUpdate) ||
+        !data.WriteRemoteObject(telephonyObserver->AsObject()) || !options.Marshalling(data)) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::ADD_OBSERVER_WITH_OPTIONS), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGW("add observer with options failed, ret=%{public}d, add it without options", ret);
+        return proxy->RegisterStateChange(telephonyObserver, slotId, mask, isUpdate);
+    }
+    return reply.ReadInt32();
+}
+
 int32_t TelephonyObserverClient::RemoveStateObserver(int32_t slotId, uint32_t mask)
 {
     auto proxy = GetProxy();
@@ -99,6 +139,330 @@ int32_t TelephonyObserverClient::RemoveStateObserver(int32_t slotId, uint32_t ma
     }
     return proxy->UnregisterStateChange(slotId, mask);
 }
+
+int32_t TelephonyObserverClient::UpdateDefaultDataSlotId(int32_t slotId)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteInt32(slotId)) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::DEFAULT_DATA_SLOT_ID), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("update default data slot failed, ret=%{public}d", ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
+int32_t TelephonyObserverClient::UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState)
+{
+    TelephonyObserverDeltaValue value;
+    if (!TelephonyObserverDelta::FromNetworkState(networkState, value)) {
+        TELEPHONY_LOGE("networkState is null!");
+        return TELEPHONY_ERR_ARGUMENT_NULL;
+    }
+    return SendDelta(StateNotifyInnerInterfaceCode::NET_WORK_STATE_DELTA, slotId, value);
+}
+
+int32_t TelephonyObserverClient::UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &cells)
+{
+    TelephonyObserverDeltaValue value;
+    if (cells.empty() || !TelephonyObserverDelta::FromCellInfo(cells, value)) {
+        TELEPHONY_LOGE("cells is invalid!");
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    return SendDelta(StateNotifyInnerInterfaceCode::CELL_INFO_DELTA, slotId, value);
+}
+
+int32_t TelephonyObserverClient::ResyncStateObserver(
+    const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId, uint32_t mask)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    if (telephonyObserver == nullptr) {
+        TELEPHONY_LOGE("telephonyObserver is null!");
+        return TELEPHONY_ERR_ARGUMENT_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteInt32(slotId) || !data.WriteInt32(static_cast<int32_t>(mask)) ||
+        !data.WriteRemoteObject(telephonyObserver->AsObject())) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::RESYNC_OBSERVER), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("resync observer failed, ret=%{public}d", ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
+int32_t TelephonyObserverClient::ResyncEventRing(
+    const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t ringId)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    if (telephonyObserver == nullptr) {
+        TELEPHONY_LOGE("telephonyObserver is null!");
+        return TELEPHONY_ERR_ARGUMENT_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteUint32(ringId) || !data.WriteRemoteObject(telephonyObserver->AsObject())) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::RESYNC_EVENT_RING), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("resync event ring failed, ret=%{public}d", ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
+int32_t TelephonyObserverClient::GetSlotState(int32_t slotId, TelephonyObserverSlotState &state)
+{
+    std::shared_ptr<TelephonyObserverMirror> mirror = std::atomic_load(&mirror_);
+    if (mirror == nullptr) {
+        mirror = GetMirror();
+        if (mirror == nullptr) {
+            return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+        }
+    }
+    if (slotId < -1 || slotId >= mirror->GetSlotCount()) {
+        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
+    }
+    if (!mirror->Read(slotId, state)) {
+        return TELEPHONY_ERR_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyObserverClient::GetSignalStatistics(
+    int32_t slotId, std::vector<TelephonyObserverSignalStatistics> &statistics)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteInt32(slotId)) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::GET_SIGNAL_STATISTICS), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("get signal statistics failed, ret=%{public}d", ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    ret = reply.ReadInt32();
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    if (!TelephonyObserverSignalStatistics::ReadList(reply, statistics)) {
+        TELEPHONY_LOGE("read signal statistics failed");
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyObserverClient::GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteUint32(mask)) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::GET_SUBSCRIBER_INTEREST), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("get subscriber interest failed, ret=%{public}d", ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    ret = reply.ReadInt32();
+    if (ret != TELEPHONY_SUCCESS) {
+        return ret;
+    }
+    if (!TelephonyObserverInterest::ReadList(reply, interests)) {
+        TELEPHONY_LOGE("read subscriber interest failed");
+        return TELEPHONY_ERR_READ_DATA_FAIL;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyObserverClient::AddInterestObserver(
+    const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask)
+{
+    return SendInterestObserver(StateNotifyInnerInterfaceCode::ADD_INTEREST_OBSERVER, telephonyObserver, mask);
+}
+
+int32_t TelephonyObserverClient::RemoveInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver)
+{
+    return SendInterestObserver(StateNotifyInnerInterfaceCode::REMOVE_INTEREST_OBSERVER, telephonyObserver, 0);
+}
+
+int32_t TelephonyObserverClient::SendInterestObserver(StateNotifyInnerInterfaceCode code,
+    const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    if (telephonyObserver == nullptr) {
+        TELEPHONY_LOGE("telephonyObserver is null!");
+        return TELEPHONY_ERR_ARGUMENT_NULL;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteUint32(mask) || !data.WriteRemoteObject(telephonyObserver->AsObject())) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(static_cast<uint32_t>(code), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("interest observer request failed, code=%{public}u ret=%{public}d",
+            static_cast<uint32_t>(code), ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return reply.ReadInt32();
+}
+
+std::shared_ptr<TelephonyObserverMirror> TelephonyObserverClient::GetMirror()
+{
+    std::lock_guard<std::mutex> lock(mutexMirror_);
+    std::shared_ptr<TelephonyObserverMirror> mirror = std::atomic_load(&mirror_);
+    if (mirror != nullptr) {
+        return mirror;
+    }
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return nullptr;
+    }
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return nullptr;
+    }
+    int32_t ret = proxy->AsObject()->SendRequest(
+        static_cast<uint32_t>(StateNotifyInnerInterfaceCode::GET_STATE_MIRROR), data, reply, option);
+    if (ret != ERR_NONE) {
+        TELEPHONY_LOGE("get state mirror failed, ret=%{public}d", ret);
+        return nullptr;
+    }
+    ret = reply.ReadInt32();
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("get state mirror failed, result=%{public}d", ret);
+        return nullptr;
+    }
+    mirror = TelephonyObserverMirror::Attach(reply.ReadAshmem());
+    std::atomic_store(&mirror_, mirror);
+    return mirror;
+}
+
+int32_t TelephonyObserverClient::SendDelta(
+    StateNotifyInnerInterfaceCode code, int32_t slotId, const TelephonyObserverDeltaValue &value)
+{
+    auto proxy = GetProxy();
+    if (proxy == nullptr || proxy->AsObject() == nullptr) {
+        TELEPHONY_LOGE("proxy is null!");
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    // sent under the lock, so the registry gets the values in the order they became bases
+    std::lock_guard<std::mutex> lock(mutexDelta_);
+    TelephonyObserverDeltaEncoder &encoder = deltaEncoders_[std::make_pair(static_cast<uint32_t>(code), slotId)];
+    int32_t ret = SendDeltaRequest(proxy->AsObject(), code, slotId, value, encoder);
+    if (ret == TELEPHONY_STATE_REGISTRY_DELTA_BASE_UNKNOWN) {
+        // e.g. the registry restarted since the base was sent
+        TELEPHONY_LOGI("delta base unknown, send in full, slotId = %{public}d", slotId);
+        encoder.Reset();
+        ret = SendDeltaRequest(proxy->AsObject(), code, slotId, value, encoder);
+    }
+    return ret;
+}
+
+int32_t TelephonyObserverClient::SendDeltaRequest(const sptr<IRemoteObject> &remote,
+    StateNotifyInnerInterfaceCode code, int32_t slotId, const TelephonyObserverDeltaValue &value,
+    TelephonyObserverDeltaEncoder &encoder)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option;
+    if (!data.WriteInterfaceToken(ITelephonyStateNotify::GetDescriptor())) {
+        TELEPHONY_LOGE("write interface token failed");
+        return TELEPHONY_ERR_WRITE_DESCRIPTOR_TOKEN_FAIL;
+    }
+    if (!data.WriteInt32(slotId) || !encoder.Write(data, value)) {
+        TELEPHONY_LOGE("write data failed");
+        return TELEPHONY_ERR_WRITE_DATA_FAIL;
+    }
+    int32_t ret = remote->SendRequest(static_cast<uint32_t>(code), data, reply, option);
+    if (ret != ERR_NONE) {
+        encoder.Reset();
+        TELEPHONY_LOGE("send delta failed, code=%{public}u ret=%{public}d", static_cast<uint32_t>(code), ret);
+        return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
+    }
+    return reply.ReadInt32();
+}
 }
 }
 
@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_delta.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <unistd.h>
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int32_t DELTA_ENCODING_FULL = 0;
+constexpr int32_t DELTA_ENCODING_DELTA = 1;
+constexpr int32_t DELTA_ENTRY_ADDED = 0;
+constexpr int32_t DELTA_ENTRY_UNCHANGED = 1;
+constexpr int32_t DELTA_ENTRY_CHANGED = 2;
+constexpr uint32_t MAX_DELTA_ENTRIES = 32;
+constexpr uint32_t MAX_DELTA_ENTRY_SIZE = 4096;
+constexpr size_t MAX_DELTA_CHANNELS = 8;
+constexpr uint32_t BITS_PER_WORD = 32;
+constexpr uint32_t CHANNEL_PID_SHIFT = 32;
+constexpr uint32_t KEY_TYPE_SHIFT = 32;
+std::atomic<uint32_t> g_channelCount = 0;
+
+void CopyParcelData(const Parcel &parcel, std::vector<uint8_t> &bytes)
+{
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(parcel.GetData());
+    if (data == nullptr) {
+        bytes.clear();
+        return;
+    }
+    bytes.assign(data, data + parcel.GetDataSize());
+}
+
+bool WriteEntryBytes(Parcel &parcel, const std::vector<uint8_t> &bytes)
+{
+    if (!parcel.WriteUint32(static_cast<uint32_t>(bytes.size()))) {
+        return false;
+    }
+    return bytes.empty() || parcel.WriteBuffer(bytes.data(), bytes.size());
+}
+
+bool ReadEntryBytes(Parcel &parcel, std::vector<uint8_t> &bytes)
+{
+    uint32_t size = 0;
+    if (!parcel.ReadUint32(size) || size > MAX_DELTA_ENTRY_SIZE) {
+        return false;
+    }
+    bytes.clear();
+    if (size == 0) {
+        return true;
+    }
+    const uint8_t *data = parcel.ReadBuffer(size);
+    if (data == nullptr) {
+        return false;
+    }
+    bytes.assign(data, data + size);
+    return true;
+}
+
+size_t GetFullSize(const TelephonyObserverDeltaValue &value)
+{
+    size_t size = sizeof(int32_t);
+    for (const auto &entry : value) {
+        size += sizeof(uint32_t) + (entry.bytes.size() + sizeof(uint32_t) - 1) / sizeof(uint32_t) * sizeof(uint32_t);
+    }
+    return size;
+}
+
+bool WritePatch(Parcel &parcel, const std::vector<uint8_t> &base, const std::vector<uint8_t> &bytes)
+{
+    uint32_t words = static_cast<uint32_t>(bytes.size() / sizeof(uint32_t));
+    std::vector<uint32_t> bitmap((words + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    std::vector<uint32_t> changed;
+    for (uint32_t i = 0; i < words; i++) {
+        size_t offset = i * sizeof(uint32_t);
+        if (memcmp(base.data() + offset, bytes.data() + offset, sizeof(uint32_t)) == 0) {
+            continue;
+        }
+        uint32_t word = 0;
+        memcpy(&word, bytes.data() + offset, sizeof(uint32_t));
+        bitmap[i / BITS_PER_WORD] |= 1u << (i % BITS_PER_WORD);
+        changed.push_back(word);
+    }
+    for (uint32_t bits : bitmap) {
+        if (!parcel.WriteUint32(bits)) {
+            return false;
+        }
+    }
+    for (uint32_t word : changed) {
+        if (!parcel.WriteUint32(word)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadPatch(Parcel &parcel, std::vector<uint8_t> &bytes)
+{
+    uint32_t words = static_cast<uint32_t>(bytes.size() / sizeof(uint32_t));
+    std::vector<uint32_t> bitmap((words + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+    for (uint32_t &bits : bitmap) {
+        if (!parcel.ReadUint32(bits)) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < words; i++) {
+        if ((bitmap[i / BITS_PER_WORD] & (1u << (i % BITS_PER_WORD))) == 0) {
+            continue;
+        }
+        uint32_t word = 0;
+        if (!parcel.ReadUint32(word)) {
+            return false;
+        }
+        memcpy(bytes.data() + i * sizeof(uint32_t), &word, sizeof(uint32_t));
+    }
+    return true;
+}
+
+bool WriteFull(Parcel &parcel, const TelephonyObserverDeltaValue &value)
+{
+    if (!parcel.WriteInt32(static_cast<int32_t>(value.size()))) {
+        return false;
+    }
+    for (const auto &entry : value) {
+        if (!WriteEntryBytes(parcel, entry.bytes)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadFull(Parcel &parcel, TelephonyObserverDeltaValue &value)
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<uint32_t>(size) > MAX_DELTA_ENTRIES) {
+        return false;
+    }
+    value.assign(size, TelephonyObserverDeltaEntry());
+    for (auto &entry : value) {
+        if (!ReadEntryBytes(parcel, entry.bytes)) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace
+
+bool TelephonyObserverDelta::FromNetworkState(
+    const sptr<NetworkState> &networkState, TelephonyObserverDeltaValue &value)
+{
+    value.clear();
+    if (networkState == nullptr) {
+        return false;
+    }
+    Parcel parcel;
+    if (!networkState->Marshalling(parcel)) {
+        return false;
+    }
+    TelephonyObserverDeltaEntry entry;
+    CopyParcelData(parcel, entry.bytes);
+    value.push_back(std::move(entry));
+    return true;
+}
+
+sptr<NetworkState> TelephonyObserverDelta::ToNetworkState(const TelephonyObserverDeltaValue &value)
+{
+    if (value.size() != 1 || value[0].bytes.empty()) {
+        return nullptr;
+    }
+    Parcel parcel;
+    if (!parcel.WriteBuffer(value[0].bytes.data(), value[0].bytes.size())) {
+        return nullptr;
+    }
+    return NetworkState::Unmarshalling(parcel);
+}
+
+bool TelephonyObserverDelta::FromCellInfo(
+    const std::vector<sptr<CellInformation>> &cells, TelephonyObserverDeltaValue &value)
+{
+    value.clear();
+    if (cells.size() > MAX_DELTA_ENTRIES) {
+        return false;
+    }
+    for (const auto &cell : cells) {
+        if (cell == nullptr) {
+            continue;
+        }
+        Parcel parcel;
+        if (!cell->Marshalling(parcel)) {
+            return false;
+        }
+        TelephonyObserverDeltaEntry entry;
+        entry.key = (static_cast<int64_t>(cell->GetNetworkType()) << KEY_TYPE_SHIFT) |
+            static_cast<uint32_t>(cell->GetCellId());
+        CopyParcelData(parcel, entry.bytes);
+        value.push_back(std::move(entry));
+    }
+    return true;
+}
+
+void TelephonyObserverDelta::ToCellInfo(
+    const TelephonyObserverDeltaValue &value, std::vector<sptr<CellInformation>> &cells)
+{
+    cells.clear();
+    for (const auto &entry : value) {
+        Parcel parcel;
+        if (entry.bytes.empty() || !parcel.WriteBuffer(entry.bytes.data(), entry.bytes.size())) {
+            continue;
+        }
+        CellInformation::CellType type = static_cast<CellInformation::CellType>(parcel.ReadInt32());
+        sptr<CellInformation> cell = nullptr;
+        switch (type) {
+            case CellInformation::CellType::CELL_TYPE_GSM:
+                cell = new (std::nothrow) GsmCellInformation();
+                break;
+            case CellInformation::CellType::CELL_TYPE_LTE:
+                cell = new (std::nothrow) LteCellInformation();
+                break;
+            case CellInformation::CellType::CELL_TYPE_NR:
+                cell = new (std::nothrow) NrCellInformation();
+                break;
+            default:
+                break;
+        }
+        if (cell != nullptr && cell->ReadFromParcel(parcel)) {
+            cells.push_back(cell);
+        }
+    }
+}
+
+TelephonyObserverDeltaEncoder::TelephonyObserverDeltaEncoder()
+    : channel_((static_cast<uint64_t>(getpid()) << CHANNEL_PID_SHIFT) | ++g_channelCount)
+{}
+
+bool TelephonyObserverDeltaEncoder::Write(Parcel &parcel, const TelephonyObserverDeltaValue &value)
+{
+    if (value.size() > MAX_DELTA_ENTRIES) {
+        return false;
+    }
+    uint64_t baseSequence = sequence_++;
+    Parcel delta;
+    bool isDelta = hasBase_ && WriteDelta(delta, value) && delta.GetDataSize() < GetFullSize(value);
+    bool ret = parcel.WriteInt32(isDelta ? DELTA_ENCODING_DELTA : DELTA_ENCODING_FULL) &&
+        parcel.WriteUint64(channel_) && parcel.WriteUint64(sequence_);
+    if (isDelta) {
+        ret = ret && parcel.WriteUint64(baseSequence) &&
+            parcel.WriteBuffer(reinterpret_cast<const void *>(delta.GetData()), delta.GetDataSize());
+    } else {
+        ret = ret && WriteFull(parcel, value);
+    }
+    if (!ret) {
+        Reset();
+        return false;
+    }
+    base_ = value;
+    hasBase_ = true;
+    return true;
+}
+
+void TelephonyObserverDeltaEncoder::Reset()
+{
+    hasBase_ = false;
+    base_.clear();
+}
+
+bool TelephonyObserverDeltaEncoder::WriteDelta(Parcel &parcel, const TelephonyObserverDeltaValue &value) const
+{
+    if (!parcel.WriteInt32(static_cast<int32_t>(value.size()))) {
+        return false;
+    }
+    std::vector<bool> used(base_.size(), false);
+    for (const auto &entry : value) {
+        int32_t index = -1;
+        for (size_t i = 0; i < base_.size(); i++) {
+            if (!used[i] && base_[i].key == entry.key) {
+                index = static_cast<int32_t>(i);
+                used[i] = true;
+                break;
+            }
+        }
+        bool ret = true;
+        if (index < 0 || base_[index].bytes.size() != entry.bytes.size() ||
+            entry.bytes.size() % sizeof(uint32_t) != 0) {
+            ret = parcel.WriteInt32(DELTA_ENTRY_ADDED) && WriteEntryBytes(parcel, entry.bytes);
+        } else if (base_[index].bytes == entry.bytes) {
+            ret = parcel.WriteInt32(DELTA_ENTRY_UNCHANGED) && parcel.WriteInt32(index);
+        } else {
+            ret = parcel.WriteInt32(DELTA_ENTRY_CHANGED) && parcel.WriteInt32(index) &&
+                WritePatch(parcel, base_[index].bytes, entry.bytes);
+        }
+        if (!ret) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverDeltaDecoder::Read(Parcel &parcel, TelephonyObserverDeltaValue &value)
+{
+    int32_t encoding = 0;
+    uint64_t channel = 0;
+    uint64_t sequence = 0;
+    if (!parcel.ReadInt32(encoding) || !parcel.ReadUint64(channel) || !parcel.ReadUint64(sequence)) {
+        return false;
+    }
+    if (encoding == DELTA_ENCODING_FULL) {
+        if (!ReadFull(parcel, value)) {
+            bases_.erase(channel);
+            return false;
+        }
+        if (bases_.find(channel) == bases_.end() && bases_.size() >= MAX_DELTA_CHANNELS) {
+            bases_.erase(bases_.begin());
+        }
+        Base &base = bases_[channel];
+        base.sequence = sequence;
+        base.value = value;
+        return true;
+    }
+    uint64_t baseSequence = 0;
+    auto it = bases_.find(channel);
+    if (encoding != DELTA_ENCODING_DELTA || !parcel.ReadUint64(baseSequence) || it == bases_.end() ||
+        it->second.sequence != baseSequence || !ReadDelta(parcel, it->second.value, value)) {
+        if (it != bases_.end()) {
+            bases_.erase(it);
+        }
+        return false;
+    }
+    it->second.sequence = sequence;
+    it->second.value = value;
+    return true;
+}
+
+bool TelephonyObserverDeltaDecoder::ReadDelta(
+    Parcel &parcel, const TelephonyObserverDeltaValue &base, TelephonyObserverDeltaValue &value) const
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || static_cast<uint32_t>(size) > MAX_DELTA_ENTRIES) {
+        return false;
+    }
+    value.assign(size, TelephonyObserverDeltaEntry());
+    for (auto &entry : value) {
+        int32_t op = 0;
+        if (!parcel.ReadInt32(op)) {
+            return false;
+        }
+        if (op == DELTA_ENTRY_ADDED) {
+            if (!ReadEntryBytes(parcel, entry.bytes)) {
+                return false;
+            }
+            continue;
+        }
+        int32_t index = 0;
+        if (!parcel.ReadInt32(index) || index < 0 || static_cast<size_t>(index) >= base.size()) {
+            return false;
+        }
+        entry = base[index];
+        if (op == DELTA_ENTRY_CHANGED) {
+            if (!ReadPatch(parcel, entry.bytes)) {
+                return false;
+            }
+        } else if (op != DELTA_ENTRY_UNCHANGED) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace Telephony
+} // namespace OHOS
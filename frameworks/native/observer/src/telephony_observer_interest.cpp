@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "telephony_observer_interest.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// 32 listening types of up to 8 slots
+constexpr int32_t MAX_INTEREST_COUNT = 256;
+} // namespace
+
+bool TelephonyObserverInterest::Marshalling(Parcel &parcel) const
+{
+    return parcel.WriteUint32(mask) && parcel.WriteInt32(slotId) && parcel.WriteUint32(subscribers) &&
+        parcel.WriteUint32(minPeriodMs);
+}
+
+bool TelephonyObserverInterest::ReadFromParcel(Parcel &parcel)
+{
+    return parcel.ReadUint32(mask) && parcel.ReadInt32(slotId) && parcel.ReadUint32(subscribers) &&
+        parcel.ReadUint32(minPeriodMs);
+}
+
+bool TelephonyObserverInterest::WriteList(Parcel &parcel, const std::vector<TelephonyObserverInterest> &interests)
+{
+    if (!parcel.WriteInt32(static_cast<int32_t>(interests.size()))) {
+        return false;
+    }
+    for (const auto &item : interests) {
+        if (!item.Marshalling(parcel)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverInterest::ReadList(Parcel &parcel, std::vector<TelephonyObserverInterest> &interests)
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || size > MAX_INTEREST_COUNT) {
+        return false;
+    }
+    interests.resize(size);
+    for (auto &item : interests) {
+        if (!item.ReadFromParcel(parcel)) {
+            interests.clear();
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_mirror.h"
+
+#include <atomic>
+#include <new>
+#include <sys/mman.h>
+#include <thread>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr uint32_t MIRROR_MAGIC = 0x544d4952;
+constexpr int32_t MAX_MIRROR_SLOTS = 8;
+constexpr int32_t MAX_READ_RETRIES = 64;
+
+enum MirrorValue {
+    CALL_STATE,
+    CARD_TYPE,
+    SIM_STATE,
+    LOCK_REASON,
+    DATA_STATE,
+    NETWORK_TYPE,
+    DATA_FLOW,
+    CFU_RESULT,
+    VOICE_MAIL_MSG_RESULT,
+    SIM_ACTIVE,
+    VALUE_COUNT,
+};
+} // namespace
+
+struct TelephonyObserverMirror::Header {
+    uint32_t magic;
+    int32_t slotCount;
+};
+
+/**
+ * The values are atomics only so that copying them while the registry writes is not a data race, the sequence
+ * decides whether a copy is used.
+ */
+struct TelephonyObserverMirror::Slot {
+    std::atomic<uint32_t> sequence;
+    std::atomic<uint32_t> reported;
+    std::atomic<int32_t> values[VALUE_COUNT];
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "mirror values have to be lock free across processes");
+
+static void ToValues(const TelephonyObserverSlotState &state, int32_t (&values)[VALUE_COUNT])
+{
+    values[CALL_STATE] = state.callState;
+    values[CARD_TYPE] = static_cast<int32_t>(state.cardType);
+    values[SIM_STATE] = static_cast<int32_t>(state.simState);
+    values[LOCK_REASON] = static_cast<int32_t>(state.lockReason);
+    values[DATA_STATE] = state.dataState;
+    values[NETWORK_TYPE] = state.networkType;
+    values[DATA_FLOW] = state.dataFlow;
+    values[CFU_RESULT] = state.cfuResult ? 1 : 0;
+    values[VOICE_MAIL_MSG_RESULT] = state.voiceMailMsgResult ? 1 : 0;
+    values[SIM_ACTIVE] = state.simActive ? 1 : 0;
+}
+
+static void FromValues(const int32_t (&values)[VALUE_COUNT], TelephonyObserverSlotState &state)
+{
+    state.callState = values[CALL_STATE];
+    state.cardType = static_cast<CardType>(values[CARD_TYPE]);
+    state.simState = static_cast<SimState>(values[SIM_STATE]);
+    state.lockReason = static_cast<LockReason>(values[LOCK_REASON]);
+    state.dataState = values[DATA_STATE];
+    state.networkType = values[NETWORK_TYPE];
+    state.dataFlow = values[DATA_FLOW];
+    state.cfuResult = values[CFU_RESULT] != 0;
+    state.voiceMailMsgResult = values[VOICE_MAIL_MSG_RESULT] != 0;
+    state.simActive = values[SIM_ACTIVE] != 0;
+}
+
+std::shared_ptr<TelephonyObserverMirror> TelephonyObserverMirror::Create(int32_t slotCount)
+{
+    if (slotCount <= 0 || slotCount > MAX_MIRROR_SLOTS) {
+        return nullptr;
+    }
+    int32_t size = static_cast<int32_t>(sizeof(Header) + sizeof(Slot) * (slotCount + 1));
+    sptr<Ashmem> ashmem = Ashmem::CreateAshmem("telephony_observer_mirror", size);
+    if (ashmem == nullptr) {
+        TELEPHONY_LOGE("create mirror failed");
+        return nullptr;
+    }
+    auto mirror = std::make_shared<TelephonyObserverMirror>();
+    // the registry keeps its writable mapping, every mapping made from now on is read-only
+    if (!mirror->Map(ashmem, true, slotCount) || !ashmem->SetProtection(PROT_READ)) {
+        ashmem->CloseAshmem();
+        return nullptr;
+    }
+    return mirror;
+}
+
+std::shared_ptr<TelephonyObserverMirror> TelephonyObserverMirror::Attach(const sptr<Ashmem> &ashmem)
+{
+    if (ashmem == nullptr) {
+        return nullptr;
+    }
+    auto mirror = std::make_shared<TelephonyObserverMirror>();
+    if (!mirror->Map(ashmem, false, 0)) {
+        return nullptr;
+    }
+    return mirror;
+}
+
+bool TelephonyObserverMirror::Map(const sptr<Ashmem> &ashmem, bool create, int32_t slotCount)
+{
+    int32_t size = ashmem->GetAshmemSize();
+    if (size < static_cast<int32_t>(sizeof(Header)) ||
+        !(create ? ashmem->MapReadAndWriteAshmem() : ashmem->MapReadOnlyAshmem())) {
+        TELEPHONY_LOGE("map mirror failed");
+        return false;
+    }
+    void *data = const_cast<void *>(ashmem->ReadFromAshmem(size, 0));
+    if (data == nullptr) {
+        ashmem->UnmapAshmem();
+        return false;
+    }
+    Header *header = nullptr;
+    if (create) {
+        header = new (data) Header();
+        header->magic = MIRROR_MAGIC;
+        header->slotCount = slotCount;
+        Slot *slots = reinterpret_cast<Slot *>(static_cast<uint8_t *>(data) + sizeof(Header));
+        TelephonyObserverSlotState initState;
+        int32_t values[VALUE_COUNT] = {};
+        ToValues(initState, values);
+        for (int32_t i = 0; i <= slotCount; i++) {
+            Slot *slot = new (&slots[i]) Slot();
+            for (int32_t j = 0; j < VALUE_COUNT; j++) {
+                slot->values[j].store(values[j], std::memory_order_relaxed);
+            }
+        }
+    } else {
+        header = static_cast<Header *>(data);
+        if (header->magic != MIRROR_MAGIC || header->slotCount <= 0 || header->slotCount > MAX_MIRROR_SLOTS ||
+            static_cast<uint64_t>(size) < sizeof(Header) + sizeof(Slot) * (header->slotCount + 1)) {
+            TELEPHONY_LOGE("region is not a mirror");
+            ashmem->UnmapAshmem();
+            return false;
+        }
+    }
+    ashmem_ = ashmem;
+    slots_ = reinterpret_cast<Slot *>(static_cast<uint8_t *>(data) + sizeof(Header));
+    slotCount_ = header->slotCount;
+    return true;
+}
+
+TelephonyObserverMirror::Slot *TelephonyObserverMirror::GetSlot(int32_t slotId) const
+{
+    if (slots_ == nullptr || slotId < -1 || slotId >= slotCount_) {
+        return nullptr;
+    }
+    return &slots_[slotId + 1];
+}
+
+void TelephonyObserverMirror::Write(
+    int32_t slotId, uint32_t mask, const std::function<void(TelephonyObserverSlotState &state)> &update)
+{
+    Slot *slot = GetSlot(slotId);
+    if (slot == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    int32_t values[VALUE_COUNT] = {};
+    for (int32_t i = 0; i < VALUE_COUNT; i++) {
+        values[i] = slot->values[i].load(std::memory_order_relaxed);
+    }
+    TelephonyObserverSlotState state;
+    FromValues(values, state);
+    update(state);
+    ToValues(state, values);
+    uint32_t sequence = slot->sequence.load(std::memory_order_relaxed);
+    slot->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->reported.store(slot->reported.load(std::memory_order_relaxed) | mask, std::memory_order_relaxed);
+    for (int32_t i = 0; i < VALUE_COUNT; i++) {
+        slot->values[i].store(values[i], std::memory_order_relaxed);
+    }
+    slot->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool TelephonyObserverMirror::Read(int32_t slotId, TelephonyObserverSlotState &state) const
+{
+    Slot *slot = GetSlot(slotId);
+    if (slot == nullptr) {
+        return false;
+    }
+    for (int32_t retry = 0; retry < MAX_READ_RETRIES; retry++) {
+        uint32_t begin = slot->sequence.load(std::memory_order_acquire);
+        if ((begin & 1) != 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        uint32_t reported = slot->reported.load(std::memory_order_relaxed);
+        int32_t values[VALUE_COUNT] = {};
+        for (int32_t i = 0; i < VALUE_COUNT; i++) {
+            values[i] = slot->values[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == begin) {
+            state.reported = reported;
+            FromValues(values, state);
+            return true;
+        }
+    }
+    TELEPHONY_LOGW("slot %{public}d of the mirror kept changing while it was read", slotId);
+    return false;
+}
+
+int32_t TelephonyObserverMirror::GetSlotCount() const
+{
+    return slotCount_;
+}
+
+sptr<Ashmem> TelephonyObserverMirror::GetAshmem() const
+{
+    return ashmem_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_options.h"
+
+#include <new>
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr uint32_t MAX_DELIVERY_POLICIES = 32;
+} // namespace
+
+bool TelephonyObserverOptions::Marshalling(Parcel &parcel) const
+{
+    if (!parcel.WriteUint32(networkStateFields_) || !parcel.WriteUint32(dataConnectionStateFields_) ||
+        !parcel.WriteBool(deltaEncoding_) || !parcel.WriteBool(eventRing_) ||
+        !parcel.WriteUint32(signalStatisticsPeriodMs_) || !parcel.WriteUint32(signalInfoProjection_) ||
+        !parcel.WriteUint32(networkStateProjection_) ||
+        !parcel.WriteUint32(static_cast<uint32_t>(deliveryPolicies_.size()))) {
+        return false;
+    }
+    for (const auto &policy : deliveryPolicies_) {
+        if (!parcel.WriteUint32(policy.first) || !parcel.WriteUint32(policy.second.mode) ||
+            !parcel.WriteUint32(policy.second.periodMs)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverOptions::ReadFromParcel(Parcel &parcel)
+{
+    if (!parcel.ReadUint32(networkStateFields_) || !parcel.ReadUint32(dataConnectionStateFields_)) {
+        return false;
+    }
+    // older clients do not send it
+    deltaEncoding_ = parcel.GetReadableBytes() > 0 && parcel.ReadBool();
+    eventRing_ = parcel.GetReadableBytes() > 0 && parcel.ReadBool();
+    signalStatisticsPeriodMs_ = parcel.GetReadableBytes() > 0 ? parcel.ReadUint32() : 0;
+    signalInfoProjection_ = parcel.GetReadableBytes() > 0 ? parcel.ReadUint32() : 0;
+    networkStateProjection_ = parcel.GetReadableBytes() > 0 ? parcel.ReadUint32() : 0;
+    uint32_t policyCount = parcel.GetReadableBytes() > 0 ? parcel.ReadUint32() : 0;
+    // one policy per listening type bit
+    if (policyCount > MAX_DELIVERY_POLICIES) {
+        return false;
+    }
+    deliveryPolicies_.clear();
+    for (uint32_t i = 0; i < policyCount; i++) {
+        uint32_t mask = 0;
+        DeliveryPolicy policy;
+        if (!parcel.ReadUint32(mask) || !parcel.ReadUint32(policy.mode) || !parcel.ReadUint32(policy.periodMs) ||
+            policy.mode > DELIVERY_MODE_PERIODIC) {
+            return false;
+        }
+        deliveryPolicies_[mask] = policy;
+    }
+    return true;
+}
+
+TelephonyObserverOptions *TelephonyObserverOptions::Unmarshalling(Parcel &parcel)
+{
+    TelephonyObserverOptions *options = new (std::nothrow) TelephonyObserverOptions();
+    if (options == nullptr) {
+        return nullptr;
+    }
+    if (!options->ReadFromParcel(parcel)) {
+        delete options;
+        return nullptr;
+    }
+    return options;
+}
+
+bool TelephonyObserverOptions::IsDefault() const
+{
+    return networkStateFields_ == 0 && dataConnectionStateFields_ == 0 && !deltaEncoding_ && !eventRing_ &&
+        signalStatisticsPeriodMs_ == 0 && signalInfoProjection_ == 0 && networkStateProjection_ == 0 &&
+        !HasPacedDelivery();
+}
+
+void TelephonyObserverOptions::SetDeliveryPolicy(uint32_t mask, uint32_t mode, uint32_t periodMs)
+{
+    for (uint32_t bit = 1; bit != 0 && bit <= mask; bit <<= 1) {
+        if ((mask & bit) == 0) {
+            continue;
+        }
+        if (mode == DELIVERY_MODE_EVERY) {
+            deliveryPolicies_.erase(bit);
+            continue;
+        }
+        DeliveryPolicy &policy = deliveryPolicies_[bit];
+        policy.mode = mode;
+        policy.periodMs = mode == DELIVERY_MODE_PERIODIC ? periodMs : 0;
+    }
+}
+
+DeliveryPolicy TelephonyObserverOptions::GetDeliveryPolicy(uint32_t mask) const
+{
+    auto it = deliveryPolicies_.find(mask);
+    if (it == deliveryPolicies_.end()) {
+        return DeliveryPolicy();
+    }
+    return it->second;
+}
+
+bool TelephonyObserverOptions::HasPacedDelivery() const
+{
+    for (const auto &policy : deliveryPolicies_) {
+        if (policy.second.mode != DELIVERY_MODE_EVERY) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace Telephony
+} // namespace OHOS
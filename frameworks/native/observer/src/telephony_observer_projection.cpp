@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "telephony_observer_projection.h"
+
+#include <new>
+
+#include "telephony_observer_options.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+sptr<SignalInformation> NewSignal(SignalInformation::NetworkType type, int32_t dbm)
+{
+    // dBm goes to the value GetSignalIntensity reports for the type
+    switch (type) {
+        case SignalInformation::NetworkType::GSM: {
+            sptr<GsmSignalInformation> signal = new (std::nothrow) GsmSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(dbm);
+            }
+            return signal;
+        }
+        case SignalInformation::NetworkType::CDMA: {
+            sptr<CdmaSignalInformation> signal = new (std::nothrow) CdmaSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(dbm);
+            }
+            return signal;
+        }
+        case SignalInformation::NetworkType::WCDMA: {
+            sptr<WcdmaSignalInformation> signal = new (std::nothrow) WcdmaSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(0, dbm);
+            }
+            return signal;
+        }
+        case SignalInformation::NetworkType::TDSCDMA: {
+            sptr<TdScdmaSignalInformation> signal = new (std::nothrow) TdScdmaSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(dbm);
+            }
+            return signal;
+        }
+        case SignalInformation::NetworkType::LTE: {
+            sptr<LteSignalInformation> signal = new (std::nothrow) LteSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(0, dbm);
+            }
+            return signal;
+        }
+        case SignalInformation::NetworkType::NR: {
+            sptr<NrSignalInformation> signal = new (std::nothrow) NrSignalInformation();
+            if (signal != nullptr) {
+                signal->SetValue(dbm);
+            }
+            return signal;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+bool WriteDomains(Parcel &parcel, int32_t cs, int32_t ps)
+{
+    return parcel.WriteInt32(cs) && parcel.WriteInt32(ps);
+}
+} // namespace
+
+bool TelephonyObserverProjection::WriteSignalInfo(
+    Parcel &parcel, uint32_t fields, const std::vector<sptr<SignalInformation>> &vec)
+{
+    int32_t size = 0;
+    for (const auto &signal : vec) {
+        size += signal != nullptr ? 1 : 0;
+    }
+    if (size > SignalInformation::MAX_SIGNAL_NUM || !parcel.WriteUint32(fields) || !parcel.WriteInt32(size)) {
+        return false;
+    }
+    for (const auto &signal : vec) {
+        if (signal == nullptr) {
+            continue;
+        }
+        if (!parcel.WriteInt32(static_cast<int32_t>(signal->GetNetworkType()))) {
+            return false;
+        }
+        if ((fields & SIGNAL_INFO_FIELD_LEVEL) != 0 && !parcel.WriteInt32(signal->GetSignalLevel())) {
+            return false;
+        }
+        if ((fields & SIGNAL_INFO_FIELD_DBM) != 0 && !parcel.WriteInt32(signal->GetSignalIntensity())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverProjection::ReadSignalInfo(Parcel &parcel, std::vector<sptr<SignalInformation>> &vec)
+{
+    uint32_t fields = 0;
+    int32_t size = 0;
+    if (!parcel.ReadUint32(fields) || !parcel.ReadInt32(size) || size < 0 ||
+        size > SignalInformation::MAX_SIGNAL_NUM) {
+        return false;
+    }
+    for (int32_t i = 0; i < size; i++) {
+        int32_t type = 0;
+        int32_t level = 0;
+        int32_t dbm = 0;
+        if (!parcel.ReadInt32(type) || ((fields & SIGNAL_INFO_FIELD_LEVEL) != 0 && !parcel.ReadInt32(level)) ||
+            ((fields & SIGNAL_INFO_FIELD_DBM) != 0 && !parcel.ReadInt32(dbm))) {
+            return false;
+        }
+        sptr<SignalInformation> signal = NewSignal(static_cast<SignalInformation::NetworkType>(type), dbm);
+        if (signal == nullptr) {
+            continue;
+        }
+        signal->SetSignalLevel(level);
+        vec.push_back(signal);
+    }
+    return true;
+}
+
+bool TelephonyObserverProjection::WriteNetworkState(
+    Parcel &parcel, uint32_t fields, const sptr<NetworkState> &networkState)
+{
+    if (networkState == nullptr || !parcel.WriteUint32(fields)) {
+        return false;
+    }
+    const NetworkState &state = *networkState;
+    if ((fields & NETWORK_STATE_FIELD_REG_STATE) != 0 && !WriteDomains(parcel,
+        static_cast<int32_t>(state.GetCsRegStatus()), static_cast<int32_t>(state.GetPsRegStatus()))) {
+        return false;
+    }
+    if ((fields & NETWORK_STATE_FIELD_ROAMING) != 0 && !WriteDomains(parcel,
+        static_cast<int32_t>(state.GetCsRoamingStatus()), static_cast<int32_t>(state.GetPsRoamingStatus()))) {
+        return false;
+    }
+    if ((fields & NETWORK_STATE_FIELD_RADIO_TECH) != 0 && !WriteDomains(parcel,
+        static_cast<int32_t>(state.GetCsRadioTech()), static_cast<int32_t>(state.GetPsRadioTech()))) {
+        return false;
+    }
+    if ((fields & NETWORK_STATE_FIELD_CFG_TECH) != 0 && !parcel.WriteInt32(static_cast<int32_t>(state.GetCfgTech()))) {
+        return false;
+    }
+    if ((fields & NETWORK_STATE_FIELD_OPERATOR) != 0 && (!parcel.WriteString(state.GetLongOperatorName()) ||
+        !parcel.WriteString(state.GetShortOperatorName()) || !parcel.WriteString(state.GetPlmnNumeric()))) {
+        return false;
+    }
+    if ((fields & NETWORK_STATE_FIELD_NR_STATE) != 0 && !parcel.WriteInt32(static_cast<int32_t>(state.GetNrState()))) {
+        return false;
+    }
+    return (fields & NETWORK_STATE_FIELD_EMERGENCY) == 0 || parcel.WriteBool(state.IsEmergency());
+}
+
+sptr<NetworkState> TelephonyObserverProjection::ReadNetworkState(Parcel &parcel)
+{
+    uint32_t fields = 0;
+    sptr<NetworkState> state = new (std::nothrow) NetworkState();
+    if (state == nullptr || !parcel.ReadUint32(fields)) {
+        return nullptr;
+    }
+    int32_t cs = 0;
+    int32_t ps = 0;
+    if ((fields & NETWORK_STATE_FIELD_REG_STATE) != 0) {
+        if (!parcel.ReadInt32(cs) || !parcel.ReadInt32(ps)) {
+            return nullptr;
+        }
+        state->SetNetworkState(static_cast<RegServiceState>(cs), DomainType::DOMAIN_TYPE_CS);
+        state->SetNetworkState(static_cast<RegServiceState>(ps), DomainType::DOMAIN_TYPE_PS);
+    }
+    if ((fields & NETWORK_STATE_FIELD_ROAMING) != 0) {
+        if (!parcel.ReadInt32(cs) || !parcel.ReadInt32(ps)) {
+            return nullptr;
+        }
+        state->SetRoaming(static_cast<RoamingType>(cs), DomainType::DOMAIN_TYPE_CS);
+        state->SetRoaming(static_cast<RoamingType>(ps), DomainType::DOMAIN_TYPE_PS);
+    }
+    if ((fields & NETWORK_STATE_FIELD_RADIO_TECH) != 0) {
+        if (!parcel.ReadInt32(cs) || !parcel.ReadInt32(ps)) {
+            return nullptr;
+        }
+        state->SetNetworkType(static_cast<RadioTech>(cs), DomainType::DOMAIN_TYPE_CS);
+        state->SetNetworkType(static_cast<RadioTech>(ps), DomainType::DOMAIN_TYPE_PS);
+    }
+    if ((fields & NETWORK_STATE_FIELD_CFG_TECH) != 0) {
+        if (!parcel.ReadInt32(cs)) {
+            return nullptr;
+        }
+        state->SetCfgTech(static_cast<RadioTech>(cs));
+    }
+    if ((fields & NETWORK_STATE_FIELD_OPERATOR) != 0) {
+        std::string longName;
+        std::string shortName;
+        std::string numeric;
+        if (!parcel.ReadString(longName) || !parcel.ReadString(shortName) || !parcel.ReadString(numeric)) {
+            return nullptr;
+        }
+        // the names were read through the getters, both domains get them so the getters return them again
+        state->SetOperatorInfo(longName, shortName, numeric, DomainType::DOMAIN_TYPE_CS);
+        state->SetOperatorInfo(longName, shortName, numeric, DomainType::DOMAIN_TYPE_PS);
+    }
+    if ((fields & NETWORK_STATE_FIELD_NR_STATE) != 0) {
+        if (!parcel.ReadInt32(cs)) {
+            return nullptr;
+        }
+        state->SetNrState(static_cast<NrState>(cs));
+    }
+    bool emergency = false;
+    if ((fields & NETWORK_STATE_FIELD_EMERGENCY) != 0) {
+        if (!parcel.ReadBool(emergency)) {
+            return nullptr;
+        }
+        state->SetEmergency(emergency);
+    }
+    return state;
+}
+} // namespace Telephony
+} // namespace OHOS
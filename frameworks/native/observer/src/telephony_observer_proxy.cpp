@@ -13,14 +13,120 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "telephony_errors.h"
+#include "telephony_observer_projection.h"
 #include "telephony_observer_proxy.h"
+#include "telephony_observer_update_stamp.h"
 
 #include "parcel.h"
+#include "securec.h"
 #include "string_ex.h"
 
 namespace OHOS {
 namespace Telephony {
+namespace {
+thread_local bool g_wakeupLater = false;
+thread_local TelephonyObserverProxy::BatchScope *g_batchScope = nullptr;
+} // namespace
+
+TelephonyObserverProxy::WakeupLaterScope::WakeupLaterScope() : previous_(g_wakeupLater)
+{
+    g_wakeupLater = true;
+}
+
+TelephonyObserverProxy::WakeupLaterScope::~WakeupLaterScope()
+{
+    g_wakeupLater = previous_;
+}
+
+TelephonyObserverProxy::BatchScope::BatchScope() : previous_(g_batchScope)
+{
+    g_batchScope = this;
+}
+
+TelephonyObserverProxy::BatchScope::~BatchScope()
+{
+    g_batchScope = previous_;
+    for (const Batch &batch : batches_) {
+        Send(batch);
+    }
+}
+
+bool TelephonyObserverProxy::BatchScope::Hold(TelephonyObserverProxy *proxy, const sptr<IRemoteObject> &remote,
+    int32_t msgId, const MessageParcel &dataParcel, const MessageOption &option)
+{
+    if ((option.GetFlags() & MessageOption::TF_ASYNC) == 0 || dataParcel.GetOffsetsSize() != 0 ||
+        dataParcel.GetDataSize() > UPDATE_BATCH_SIZE_MAX) {
+        return false;
+    }
+    // keyed by the remote object, the records of one observer each have their own proxy
+    auto it = std::find_if(batches_.begin(), batches_.end(),
+        [&remote](const Batch &batch) { return batch.remote == remote; });
+    if (it != batches_.end() && (it->updates.size() >= UPDATE_BATCH_NUM_MAX ||
+        it->size + dataParcel.GetDataSize() > UPDATE_BATCH_SIZE_MAX)) {
+        Flush(remote);
+        it = batches_.end();
+    }
+    if (it == batches_.end()) {
+        it = batches_.emplace(batches_.end());
+        it->remote = remote;
+    }
+    if (std::find(it->proxies.begin(), it->proxies.end(), proxy) == it->proxies.end()) {
+        it->proxies.emplace_back(proxy);
+    }
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(dataParcel.GetData());
+    it->updates.emplace_back(static_cast<uint32_t>(msgId), std::vector<uint8_t>(data, data + dataParcel.GetDataSize()));
+    it->size += dataParcel.GetDataSize();
+    it->wakeupLater = it->wakeupLater && (option.GetFlags() & MessageOption::TF_ASYNC_WAKEUP_LATER) != 0;
+    return true;
+}
+
+void TelephonyObserverProxy::BatchScope::Flush(const sptr<IRemoteObject> &remote)
+{
+    auto it = std::find_if(batches_.begin(), batches_.end(),
+        [&remote](const Batch &batch) { return batch.remote == remote; });
+    if (it == batches_.end()) {
+        return;
+    }
+    Batch batch = std::move(*it);
+    batches_.erase(it);
+    Send(batch);
+}
+
+void TelephonyObserverProxy::BatchScope::Send(const Batch &batch)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC | (batch.wakeupLater ? MessageOption::TF_ASYNC_WAKEUP_LATER : 0));
+    uint32_t code = static_cast<uint32_t>(ObserverBrokerInnerCode::ON_UPDATE_BATCH);
+    bool written = true;
+    if (batch.updates.size() == 1) {
+        // a single update is sent as it is
+        code = batch.updates.front().first;
+        written = dataParcel.WriteBuffer(batch.updates.front().second.data(), batch.updates.front().second.size());
+    } else {
+        written = dataParcel.WriteInterfaceToken(GetDescriptor()) &&
+            dataParcel.WriteInt32(static_cast<int32_t>(batch.updates.size()));
+        for (auto it = batch.updates.begin(); written && it != batch.updates.end(); ++it) {
+            written = dataParcel.WriteUint32(it->first) &&
+                dataParcel.WriteInt32(static_cast<int32_t>(it->second.size())) &&
+                dataParcel.WriteBuffer(it->second.data(), it->second.size());
+        }
+    }
+    int32_t ret = written ? batch.remote->SendRequest(code, dataParcel, replyParcel, option) : ERR_INVALID_DATA;
+    if (ret != ERR_NONE) {
+        // the held deltas were taken as sent, the next ones go out in full
+        for (const sptr<TelephonyObserverProxy> &proxy : batch.proxies) {
+            proxy->deltaStale_ = true;
+        }
+    }
+    TELEPHONY_LOGD("TelephonyObserverProxy::BatchScope::Send size: %{public}zu ##error: %{public}d.",
+        batch.updates.size(), ret);
+}
+
 TelephonyObserverProxy::TelephonyObserverProxy(const sptr<IRemoteObject> &impl)
     : IRemoteProxy<TelephonyObserverBroker>(impl)
 {}
@@ -33,6 +139,21 @@ int32_t TelephonyObserverProxy::SendRequest(
         TELEPHONY_LOGE("TelephonyObserverProxy remote is nullptr!, msgId: %{public}d", msgId);
         return TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL;
     }
+    if (g_wakeupLater && (option.GetFlags() & MessageOption::TF_ASYNC) != 0) {
+        option.SetFlags(option.GetFlags() | MessageOption::TF_ASYNC_WAKEUP_LATER);
+    }
+    TelephonyObserverUpdateStamp stamp = TelephonyObserverUpdateStamp::GetCurrent();
+    if (stamp.IsValid()) {
+        // appended after the payload so that observers not reading it are unaffected
+        stamp.Marshalling(dataParcel);
+    }
+    if (g_batchScope != nullptr) {
+        if (g_batchScope->Hold(this, remote, msgId, dataParcel, option)) {
+            return ERR_NONE;
+        }
+        // the held updates go first, the observer gets the updates in the order they were sent
+        g_batchScope->Flush(remote);
+    }
     return remote->SendRequest(msgId, dataParcel, replyParcel, option);
 }
 
@@ -110,6 +231,17 @@ void TelephonyObserverProxy::OnSignalInfoUpdated(
         return;
     }
     dataParcel.WriteInt32(slotId);
+    uint32_t fields = signalInfoProjection_;
+    if (fields != 0) {
+        if (!TelephonyObserverProjection::WriteSignalInfo(dataParcel, fields, vec)) {
+            TELEPHONY_LOGE("TelephonyObserverProxy::OnSignalInfoUpdated projection failed!");
+            return;
+        }
+        auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_SIGNAL_INFO_PROJECTED_UPDATED),
+            dataParcel, replyParcel, option);
+        TELEPHONY_LOGD("TelephonyObserverProxy::OnSignalInfoUpdated projected##error: %{public}d.", code);
+        return;
+    }
     dataParcel.WriteInt32(size);
     for (const auto &v : vec) {
         v->Marshalling(dataParcel);
@@ -140,6 +272,11 @@ void TelephonyObserverProxy::OnCellInfoUpdated(
         TELEPHONY_LOGE("Cellinformation array length is greater than MAX_CELL_NUM!");
         return;
     }
+    TelephonyObserverDeltaValue value;
+    if (deltaEncoding_ && TelephonyObserverDelta::FromCellInfo(vec, value)) {
+        SendDelta(ObserverBrokerInnerCode::ON_CELL_INFO_DELTA_UPDATED, slotId, value, option);
+        return;
+    }
     if (!dataParcel.WriteInt32(size)) {
         TELEPHONY_LOGE("Failed to write Cellinformation array size!");
         return;
@@ -159,6 +296,23 @@ void TelephonyObserverProxy::OnNetworkStateUpdated(
     MessageParcel dataParcel;
     MessageParcel replyParcel;
     option.SetFlags(MessageOption::TF_ASYNC | MessageOption::TF_ASYNC_WAKEUP_LATER);
+    uint32_t fields = networkStateProjection_;
+    if (fields != 0 && networkState != nullptr) {
+        if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteInt32(slotId) ||
+            !TelephonyObserverProjection::WriteNetworkState(dataParcel, fields, networkState)) {
+            TELEPHONY_LOGE("TelephonyObserverProxy::OnNetworkStateUpdated projection failed!");
+            return;
+        }
+        auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_NETWORK_STATE_PROJECTED_UPDATED),
+            dataParcel, replyParcel, option);
+        TELEPHONY_LOGD("TelephonyObserverProxy::OnNetworkStateUpdated projected##error: %{public}d.", code);
+        return;
+    }
+    TelephonyObserverDeltaValue value;
+    if (deltaEncoding_ && TelephonyObserverDelta::FromNetworkState(networkState, value)) {
+        SendDelta(ObserverBrokerInnerCode::ON_NETWORK_STATE_DELTA_UPDATED, slotId, value, option);
+        return;
+    }
     if (!dataParcel.WriteInterfaceToken(GetDescriptor())) {
         TELEPHONY_LOGE("TelephonyObserverProxy::OnNetworkStateUpdated WriteInterfaceToken failed!");
         return;
@@ -295,5 +449,210 @@ void TelephonyObserverProxy::OnSimActiveStateUpdated(int32_t slotId, bool enable
         static_cast<int32_t>(ObserverBrokerCode::ON_SIM_ACTIVE_STATE_UPDATED), dataParcel, replyParcel, option);
     TELEPHONY_LOGI("TelephonyObserverProxy::OnSimActiveStateUpdated##error: %{public}d.", code);
 }
+
+void TelephonyObserverProxy::SetDeltaEncoding(bool enable)
+{
+    deltaEncoding_ = enable;
+}
+
+void TelephonyObserverProxy::SetProjection(uint32_t signalInfoFields, uint32_t networkStateFields)
+{
+    signalInfoProjection_ = signalInfoFields;
+    networkStateProjection_ = networkStateFields;
+}
+
+void TelephonyObserverProxy::ResetDeltaEncoding(int32_t slotId)
+{
+    std::lock_guard<std::mutex> lock(deltaMutex_);
+    for (auto &[key, encoder] : deltaEncoders_) {
+        if (key.second == slotId) {
+            encoder.Reset();
+        }
+    }
+}
+
+static bool ReadListSize(const std::vector<uint8_t> &bytes, int32_t &size)
+{
+    return bytes.size() >= sizeof(size) && memcpy_s(&size, sizeof(size), bytes.data(), sizeof(size)) == EOK;
+}
+
+bool TelephonyObserverProxy::OnSignalInfoBytesUpdated(int32_t slotId, const std::vector<uint8_t> &bytes)
+{
+    int32_t size = 0;
+    if (signalInfoProjection_ != 0 || !ReadListSize(bytes, size)) {
+        return false;
+    }
+    if (size < 0 || size > SignalInformation::MAX_SIGNAL_NUM) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::OnSignalInfoBytesUpdated size error!");
+        return true;
+    }
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC | MessageOption::TF_ASYNC_WAKEUP_LATER);
+    SendBytes(ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED, slotId, bytes, option);
+    return true;
+}
+
+bool TelephonyObserverProxy::OnCellInfoBytesUpdated(int32_t slotId, const std::vector<uint8_t> &bytes)
+{
+    int32_t size = 0;
+    if (deltaEncoding_ || !ReadListSize(bytes, size)) {
+        return false;
+    }
+    if (size <= 0 || size > CellInformation::MAX_CELL_NUM) {
+        TELEPHONY_LOGE("Cellinformation array length is invalid!");
+        return true;
+    }
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    SendBytes(ObserverBrokerCode::ON_CELL_INFO_UPDATED, slotId, bytes, option);
+    return true;
+}
+
+bool TelephonyObserverProxy::OnSignalInfoBlobUpdated(int32_t slotId, const sptr<Ashmem> &blob)
+{
+    if (signalInfoProjection_ != 0 || blob == nullptr) {
+        return false;
+    }
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC | MessageOption::TF_ASYNC_WAKEUP_LATER);
+    SendBlob(ObserverBrokerInnerCode::ON_SIGNAL_INFO_BLOB_UPDATED, slotId, blob, option);
+    return true;
+}
+
+bool TelephonyObserverProxy::OnCellInfoBlobUpdated(int32_t slotId, const sptr<Ashmem> &blob)
+{
+    if (deltaEncoding_ || blob == nullptr) {
+        return false;
+    }
+    MessageOption option;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    SendBlob(ObserverBrokerInnerCode::ON_CELL_INFO_BLOB_UPDATED, slotId, blob, option);
+    return true;
+}
+
+void TelephonyObserverProxy::OnEventRingAttached(uint32_t ringId, const sptr<Ashmem> &ashmem)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteUint32(ringId) ||
+        !dataParcel.WriteAshmem(ashmem)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::OnEventRingAttached write data failed!");
+        return;
+    }
+    auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_ATTACHED),
+        dataParcel, replyParcel, option);
+    TELEPHONY_LOGI("TelephonyObserverProxy::OnEventRingAttached ringId: %{public}u ##error: %{public}d.",
+        ringId, code);
+}
+
+void TelephonyObserverProxy::OnEventRingDoorbell(uint32_t ringId)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteUint32(ringId)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::OnEventRingDoorbell write data failed!");
+        return;
+    }
+    auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_DOORBELL),
+        dataParcel, replyParcel, option);
+    TELEPHONY_LOGD("TelephonyObserverProxy::OnEventRingDoorbell ringId: %{public}u ##error: %{public}d.",
+        ringId, code);
+}
+
+void TelephonyObserverProxy::OnSignalStatisticsUpdated(
+    int32_t slotId, const std::vector<TelephonyObserverSignalStatistics> &statistics)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteInt32(slotId) ||
+        !TelephonyObserverSignalStatistics::WriteList(dataParcel, statistics)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::OnSignalStatisticsUpdated write data failed!");
+        return;
+    }
+    auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_SIGNAL_STATISTICS_UPDATED),
+        dataParcel, replyParcel, option);
+    TELEPHONY_LOGD("TelephonyObserverProxy::OnSignalStatisticsUpdated slotId: %{public}d ##error: %{public}d.",
+        slotId, code);
+}
+
+void TelephonyObserverProxy::OnSubscriberInterestUpdated(const std::vector<TelephonyObserverInterest> &interests)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    option.SetFlags(MessageOption::TF_ASYNC);
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) ||
+        !TelephonyObserverInterest::WriteList(dataParcel, interests)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::OnSubscriberInterestUpdated write data failed!");
+        return;
+    }
+    auto code = SendRequest(static_cast<int32_t>(ObserverBrokerInnerCode::ON_SUBSCRIBER_INTEREST_UPDATED),
+        dataParcel, replyParcel, option);
+    TELEPHONY_LOGI("TelephonyObserverProxy::OnSubscriberInterestUpdated size: %{public}zu ##error: %{public}d.",
+        interests.size(), code);
+}
+
+void TelephonyObserverProxy::SendBlob(
+    ObserverBrokerInnerCode code, int32_t slotId, const sptr<Ashmem> &blob, MessageOption &option)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteInt32(slotId) ||
+        !dataParcel.WriteInt32(blob->GetAshmemSize()) || !dataParcel.WriteAshmem(blob)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::SendBlob write data failed!");
+        return;
+    }
+    auto ret = SendRequest(static_cast<int32_t>(code), dataParcel, replyParcel, option);
+    TELEPHONY_LOGD("TelephonyObserverProxy::SendBlob code: %{public}u ##error: %{public}d.",
+        static_cast<uint32_t>(code), ret);
+}
+
+void TelephonyObserverProxy::SendBytes(
+    ObserverBrokerCode code, int32_t slotId, const std::vector<uint8_t> &bytes, MessageOption &option)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteInt32(slotId) ||
+        !dataParcel.WriteBuffer(bytes.data(), bytes.size())) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::SendBytes write data failed!");
+        return;
+    }
+    auto ret = SendRequest(static_cast<int32_t>(code), dataParcel, replyParcel, option);
+    TELEPHONY_LOGD("TelephonyObserverProxy::SendBytes code: %{public}d ##error: %{public}d.",
+        static_cast<int32_t>(code), ret);
+}
+
+void TelephonyObserverProxy::SendDelta(
+    ObserverBrokerInnerCode code, int32_t slotId, const TelephonyObserverDeltaValue &value, MessageOption &option)
+{
+    MessageParcel dataParcel;
+    MessageParcel replyParcel;
+    if (!dataParcel.WriteInterfaceToken(GetDescriptor()) || !dataParcel.WriteInt32(slotId)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::SendDelta write data failed!");
+        return;
+    }
+    // sent under the lock, so the observer gets the values in the order they became bases
+    std::lock_guard<std::mutex> lock(deltaMutex_);
+    if (deltaStale_.exchange(false)) {
+        deltaEncoders_.clear();
+    }
+    TelephonyObserverDeltaEncoder &encoder = deltaEncoders_[std::make_pair(static_cast<uint32_t>(code), slotId)];
+    if (!encoder.Write(dataParcel, value)) {
+        TELEPHONY_LOGE("TelephonyObserverProxy::SendDelta encode failed!");
+        return;
+    }
+    auto ret = SendRequest(static_cast<int32_t>(code), dataParcel, replyParcel, option);
+    if (ret != ERR_NONE) {
+        encoder.Reset();
+    }
+    TELEPHONY_LOGD("TelephonyObserverProxy::SendDelta code: %{public}u ##error: %{public}d.",
+        static_cast<uint32_t>(code), ret);
+}
 } // namespace Telephony
 } // namespace OHOS
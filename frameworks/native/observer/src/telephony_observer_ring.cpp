@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_ring.h"
+
+#include <atomic>
+#include <new>
+
+#include "securec.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr uint32_t RING_MAGIC = 0x54524e47;
+constexpr uint32_t RECORD_WRAP = UINT32_MAX;
+constexpr uint64_t RECORD_ALIGN = 8;
+constexpr int32_t MIN_CAPACITY = 1024;
+
+/**
+ * Starts every record, the body follows padded to RECORD_ALIGN. A record with size RECORD_WRAP only marks
+ * the rest of the area as unused, the next record starts at the beginning.
+ */
+struct RecordHeader {
+    uint32_t size;
+    uint32_t code;
+};
+
+uint64_t AlignRecord(uint64_t size)
+{
+    return (size + RECORD_ALIGN - 1) / RECORD_ALIGN * RECORD_ALIGN;
+}
+} // namespace
+
+/**
+ * Start of the region, the record area follows. head and tail count the bytes ever written and read.
+ */
+struct TelephonyObserverRing::Header {
+    uint32_t magic;
+    uint32_t capacity;
+    int32_t slotId;
+    uint32_t mask;
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    std::atomic<uint64_t> dropped;
+    std::atomic<uint32_t> overflowed;
+    // set by the observer when it has drained the ring, the next push has to wake it
+    std::atomic<uint32_t> waiting;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "ring counters have to be lock free across processes");
+
+TelephonyObserverRing::TelephonyObserverRing(uint32_t id) : id_(id) {}
+
+std::shared_ptr<TelephonyObserverRing> TelephonyObserverRing::Create(
+    uint32_t id, int32_t slotId, uint32_t mask, int32_t capacity)
+{
+    if (capacity < MIN_CAPACITY || static_cast<uint64_t>(capacity) % RECORD_ALIGN != 0 ||
+        capacity > INT32_MAX - static_cast<int32_t>(sizeof(Header))) {
+        return nullptr;
+    }
+    sptr<Ashmem> ashmem =
+        Ashmem::CreateAshmem("telephony_observer_ring", capacity + static_cast<int32_t>(sizeof(Header)));
+    if (ashmem == nullptr) {
+        TELEPHONY_LOGE("create ring failed");
+        return nullptr;
+    }
+    auto ring = std::make_shared<TelephonyObserverRing>(id);
+    if (!ring->Map(ashmem, true, slotId, mask)) {
+        ashmem->CloseAshmem();
+        return nullptr;
+    }
+    return ring;
+}
+
+std::shared_ptr<TelephonyObserverRing> TelephonyObserverRing::Attach(uint32_t id, const sptr<Ashmem> &ashmem)
+{
+    if (ashmem == nullptr) {
+        return nullptr;
+    }
+    auto ring = std::make_shared<TelephonyObserverRing>(id);
+    if (!ring->Map(ashmem, false, 0, 0)) {
+        return nullptr;
+    }
+    return ring;
+}
+
+bool TelephonyObserverRing::Map(const sptr<Ashmem> &ashmem, bool create, int32_t slotId, uint32_t mask)
+{
+    int32_t size = ashmem->GetAshmemSize();
+    if (size < static_cast<int32_t>(sizeof(Header)) + MIN_CAPACITY || !ashmem->MapReadAndWriteAshmem()) {
+        TELEPHONY_LOGE("map ring failed");
+        return false;
+    }
+    void *data = const_cast<void *>(ashmem->ReadFromAshmem(size, 0));
+    if (data == nullptr) {
+        ashmem->UnmapAshmem();
+        return false;
+    }
+    uint64_t capacity = static_cast<uint64_t>(size) - sizeof(Header);
+    Header *header = nullptr;
+    if (create) {
+        header = new (data) Header();
+        header->magic = RING_MAGIC;
+        header->capacity = static_cast<uint32_t>(capacity);
+        header->slotId = slotId;
+        header->mask = mask;
+        header->waiting = 1;
+    } else {
+        header = static_cast<Header *>(data);
+        if (header->magic != RING_MAGIC || header->capacity != capacity || capacity % RECORD_ALIGN != 0) {
+            TELEPHONY_LOGE("region is not a ring");
+            ashmem->UnmapAshmem();
+            return false;
+        }
+    }
+    ashmem_ = ashmem;
+    header_ = header;
+    records_ = static_cast<uint8_t *>(data) + sizeof(Header);
+    capacity_ = capacity;
+    return true;
+}
+
+bool TelephonyObserverRing::Push(uint32_t code, const Parcel &body)
+{
+    std::lock_guard<std::mutex> lock(pushMutex_);
+    if (header_->overflowed.load(std::memory_order_acquire) != 0) {
+        header_->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    uint64_t size = body.GetDataSize();
+    uint64_t need = AlignRecord(sizeof(RecordHeader) + size);
+    uint64_t head = header_->head.load(std::memory_order_relaxed);
+    uint64_t tail = header_->tail.load(std::memory_order_acquire);
+    uint64_t pos = head % capacity_;
+    uint64_t skip = capacity_ - pos < need ? capacity_ - pos : 0;
+    if (need > capacity_ || head - tail + skip + need > capacity_) {
+        // the observer falls behind, it gets the current state once it has drained the ring
+        header_->dropped.fetch_add(1, std::memory_order_relaxed);
+        header_->overflowed.store(1, std::memory_order_seq_cst);
+        return header_->waiting.exchange(0, std::memory_order_seq_cst) != 0;
+    }
+    if (skip != 0) {
+        RecordHeader wrap = { RECORD_WRAP, 0 };
+        if (memcpy_s(records_ + pos, capacity_ - pos, &wrap, sizeof(wrap)) != EOK) {
+            return false;
+        }
+        head += skip;
+        pos = 0;
+    }
+    RecordHeader record = { static_cast<uint32_t>(size), code };
+    if (memcpy_s(records_ + pos, capacity_ - pos, &record, sizeof(record)) != EOK ||
+        (size != 0 && memcpy_s(records_ + pos + sizeof(record), capacity_ - pos - sizeof(record),
+        reinterpret_cast<const void *>(body.GetData()), size) != EOK)) {
+        return false;
+    }
+    header_->head.store(head + need, std::memory_order_seq_cst);
+    return header_->waiting.exchange(0, std::memory_order_seq_cst) != 0;
+}
+
+bool TelephonyObserverRing::Pop(const std::function<void(uint32_t code, const uint8_t *body, size_t size)> &handle)
+{
+    while (true) {
+        uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        uint64_t head = header_->head.load(std::memory_order_acquire);
+        if (head == tail || head - tail > capacity_) {
+            return false;
+        }
+        uint64_t pos = tail % capacity_;
+        RecordHeader record = {};
+        if (memcpy_s(&record, sizeof(record), records_ + pos, sizeof(record)) != EOK) {
+            return false;
+        }
+        if (record.size == RECORD_WRAP) {
+            header_->tail.store(tail + capacity_ - pos, std::memory_order_release);
+            continue;
+        }
+        uint64_t length = AlignRecord(sizeof(RecordHeader) + record.size);
+        if (length > capacity_ - pos || length > head - tail) {
+            TELEPHONY_LOGE("ring record is corrupted, size = %{public}u", record.size);
+            // skip everything there is, the observer resyncs
+            header_->tail.store(head, std::memory_order_release);
+            header_->overflowed.store(1, std::memory_order_release);
+            return false;
+        }
+        handle(record.code, records_ + pos + sizeof(RecordHeader), record.size);
+        header_->tail.store(tail + length, std::memory_order_release);
+        return true;
+    }
+}
+
+bool TelephonyObserverRing::Drain(const std::function<void(uint32_t code, const uint8_t *body, size_t size)> &handle)
+{
+    bool overflowed = false;
+    while (true) {
+        while (Pop(handle)) {}
+        // nothing is pushed while the flag is set, so the ring stays empty until the observer resynced
+        if (header_->overflowed.exchange(0, std::memory_order_seq_cst) != 0) {
+            overflowed = true;
+        }
+        header_->waiting.store(1, std::memory_order_seq_cst);
+        if (header_->head.load(std::memory_order_seq_cst) == header_->tail.load(std::memory_order_relaxed) &&
+            header_->overflowed.load(std::memory_order_seq_cst) == 0) {
+            return overflowed;
+        }
+        // pushed meanwhile, the producer may still wake the observer for it, draining an empty ring is harmless
+        header_->waiting.store(0, std::memory_order_seq_cst);
+    }
+}
+
+uint32_t TelephonyObserverRing::GetId() const
+{
+    return id_;
+}
+
+int32_t TelephonyObserverRing::GetSlotId() const
+{
+    return header_->slotId;
+}
+
+uint32_t TelephonyObserverRing::GetMask() const
+{
+    return header_->mask;
+}
+
+uint64_t TelephonyObserverRing::GetDropped() const
+{
+    return header_->dropped.load(std::memory_order_relaxed);
+}
+
+sptr<Ashmem> TelephonyObserverRing::GetAshmem() const
+{
+    return ashmem_;
+}
+} // namespace Telephony
+} // namespace OHOS
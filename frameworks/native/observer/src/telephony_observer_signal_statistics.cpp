@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_signal_statistics.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int32_t MAX_STATISTICS_COUNT = 16;
+} // namespace
+
+bool TelephonyObserverSignalStatistics::Marshalling(Parcel &parcel) const
+{
+    if (!parcel.WriteInt32(networkType) || !parcel.WriteUint64(samples) || !parcel.WriteInt32(lastDbm) ||
+        !parcel.WriteDouble(averageDbm) || !parcel.WriteInt32(windowMinDbm) || !parcel.WriteInt32(windowMaxDbm) ||
+        !parcel.WriteInt32(lowDbm) || !parcel.WriteInt32(medianDbm) || !parcel.WriteInt32(highDbm)) {
+        return false;
+    }
+    for (int64_t duration : levelDurationMs) {
+        if (!parcel.WriteInt64(duration)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverSignalStatistics::ReadFromParcel(Parcel &parcel)
+{
+    if (!parcel.ReadInt32(networkType) || !parcel.ReadUint64(samples) || !parcel.ReadInt32(lastDbm) ||
+        !parcel.ReadDouble(averageDbm) || !parcel.ReadInt32(windowMinDbm) || !parcel.ReadInt32(windowMaxDbm) ||
+        !parcel.ReadInt32(lowDbm) || !parcel.ReadInt32(medianDbm) || !parcel.ReadInt32(highDbm)) {
+        return false;
+    }
+    for (int64_t &duration : levelDurationMs) {
+        if (!parcel.ReadInt64(duration)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverSignalStatistics::WriteList(
+    Parcel &parcel, const std::vector<TelephonyObserverSignalStatistics> &statistics)
+{
+    if (!parcel.WriteInt32(static_cast<int32_t>(statistics.size()))) {
+        return false;
+    }
+    for (const auto &item : statistics) {
+        if (!item.Marshalling(parcel)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TelephonyObserverSignalStatistics::ReadList(
+    Parcel &parcel, std::vector<TelephonyObserverSignalStatistics> &statistics)
+{
+    int32_t size = 0;
+    if (!parcel.ReadInt32(size) || size < 0 || size > MAX_STATISTICS_COUNT) {
+        return false;
+    }
+    statistics.resize(size);
+    for (auto &item : statistics) {
+        if (!item.ReadFromParcel(parcel)) {
+            statistics.clear();
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace Telephony
+} // namespace OHOS
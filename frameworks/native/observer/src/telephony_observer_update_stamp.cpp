@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_observer_update_stamp.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int32_t UPDATE_STAMP_MAGIC = 0x53544D50;
+constexpr size_t UPDATE_STAMP_SIZE = sizeof(int32_t) + sizeof(uint64_t) * 2 + sizeof(int64_t);
+thread_local TelephonyObserverUpdateStamp g_currentStamp;
+} // namespace
+
+bool TelephonyObserverUpdateStamp::IsValid() const
+{
+    return sequence != 0;
+}
+
+bool TelephonyObserverUpdateStamp::IsStale(const TelephonyObserverUpdateStamp &last) const
+{
+    return IsValid() && last.IsValid() && epoch == last.epoch && sequence <= last.sequence;
+}
+
+bool TelephonyObserverUpdateStamp::Marshalling(Parcel &parcel) const
+{
+    return parcel.WriteInt32(UPDATE_STAMP_MAGIC) && parcel.WriteUint64(epoch) && parcel.WriteUint64(sequence) &&
+        parcel.WriteInt64(timestampMs);
+}
+
+bool TelephonyObserverUpdateStamp::ReadFromParcel(Parcel &parcel)
+{
+    *this = TelephonyObserverUpdateStamp();
+    if (parcel.GetReadableBytes() < UPDATE_STAMP_SIZE) {
+        return false;
+    }
+    int32_t magic = 0;
+    if (!parcel.ReadInt32(magic) || magic != UPDATE_STAMP_MAGIC) {
+        return false;
+    }
+    TelephonyObserverUpdateStamp stamp;
+    if (!parcel.ReadUint64(stamp.epoch) || !parcel.ReadUint64(stamp.sequence) ||
+        !parcel.ReadInt64(stamp.timestampMs)) {
+        return false;
+    }
+    *this = stamp;
+    return true;
+}
+
+TelephonyObserverUpdateStamp TelephonyObserverUpdateStamp::GetCurrent()
+{
+    return g_currentStamp;
+}
+
+TelephonyObserverUpdateStampScope::TelephonyObserverUpdateStampScope(const TelephonyObserverUpdateStamp &stamp)
+    : previous_(g_currentStamp)
+{
+    g_currentStamp = stamp;
+}
+
+TelephonyObserverUpdateStampScope::~TelephonyObserverUpdateStampScope()
+{
+    g_currentStamp = previous_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -30,10 +30,48 @@ int32_t TelephonyStateManager::AddStateObserver(const sptr<TelephonyObserverBrok
         telephonyObserver, slotId, mask, notifyNow);
 }
 
+int32_t TelephonyStateManager::AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
+    int32_t slotId, uint32_t mask, bool notifyNow, const TelephonyObserverOptions &options)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().AddStateObserver(
+        telephonyObserver, slotId, mask, notifyNow, options);
+}
+
 int32_t TelephonyStateManager::RemoveStateObserver(int32_t slotId, uint32_t mask)
 {
     return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().
         RemoveStateObserver(slotId, mask);
 }
+
+int32_t TelephonyStateManager::UpdateDefaultDataSlotId(int32_t slotId)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().UpdateDefaultDataSlotId(slotId);
+}
+
+int32_t TelephonyStateManager::UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().UpdateNetworkState(slotId, networkState);
+}
+
+int32_t TelephonyStateManager::UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &cells)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().UpdateCellInfo(slotId, cells);
+}
+
+int32_t TelephonyStateManager::GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().GetSubscriberInterest(mask, interests);
+}
+
+int32_t TelephonyStateManager::AddInterestObserver(
+    const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().AddInterestObserver(telephonyObserver, mask);
+}
+
+int32_t TelephonyStateManager::RemoveInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver)
+{
+    return DelayedRefSingleton<TelephonyObserverClient>::GetInstance().RemoveInterestObserver(telephonyObserver);
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
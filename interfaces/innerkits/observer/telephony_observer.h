@@ -17,15 +17,34 @@
 #define TELEPHONY_OBSERVER_H
 
 #include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "iremote_stub.h"
 
 #include "telephony_observer_broker.h"
+#include "telephony_observer_delta.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_ring.h"
+#include "telephony_observer_signal_statistics.h"
+#include "telephony_observer_update_stamp.h"
 
 namespace OHOS {
 namespace Telephony {
+/**
+ * Updates arriving out of order or twice for the same event type and slot are dropped before the
+ * callbacks are called. Inside a callback TelephonyObserverUpdateStamp::GetCurrent() returns the
+ * sequence number and timestamp of the update being delivered. Network state and cell information
+ * sent as deltas are rebuilt from the value last received before the callbacks are called. Large
+ * signal and cell information lists arrive in a shared memory region, which is read in place. With
+ * TelephonyObserverOptions::eventRing_ signal and cell information are read from a ring in shared memory
+ * and the registry only calls in when the ring was empty. The updates held back while the process
+ * was frozen arrive in one transaction.
+ */
 class TelephonyObserver : public IRemoteStub<TelephonyObserverBroker> {
 public:
     TelephonyObserver();
@@ -147,6 +166,24 @@ public:
      */
     void OnSimActiveStateUpdated(int32_t slotId, bool enable) override;
 
+    /**
+     * @brief Called with the signal statistics of a slot when registered with
+     * TelephonyObserverOptions::signalStatisticsPeriodMs_.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param statistics Indicates the statistics of every radio technology the slot reported.
+     */
+    virtual void OnSignalStatisticsUpdated(
+        int32_t slotId, const std::vector<TelephonyObserverSignalStatistics> &statistics);
+
+    /**
+     * @brief Called when registered with TelephonyStateManager::AddInterestObserver, first with the interest in
+     * every type and slot of the registered mask, then with the entries that changed.
+     *
+     * @param interests Indicates the subscriber interest, one entry per listening type and slot.
+     */
+    virtual void OnSubscriberInterestUpdated(const std::vector<TelephonyObserverInterest> &interests);
+
 private:
     using TelephonyObserverFunc = std::function<void(MessageParcel &data, MessageParcel &reply)>;
 
@@ -167,9 +204,30 @@ private:
     void OnCallStateUpdatedExInner(MessageParcel &data, MessageParcel &reply);
     void OnCCallStateUpdatedInner(MessageParcel &data, MessageParcel &reply);
     void OnSimActiveStateUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnNetworkStateDeltaUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnCellInfoDeltaUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnSignalInfoBlobUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnCellInfoBlobUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnEventRingAttachedInner(MessageParcel &data, MessageParcel &reply);
+    void OnEventRingDoorbellInner(MessageParcel &data, MessageParcel &reply);
+    void OnSignalStatisticsUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnSignalInfoProjectedUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnNetworkStateProjectedUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnSubscriberInterestUpdatedInner(MessageParcel &data, MessageParcel &reply);
+    void OnUpdateBatchInner(MessageParcel &data, MessageParcel &reply);
+    bool AcceptUpdateStamp(
+        ObserverBrokerCode code, int32_t slotId, MessageParcel &data, TelephonyObserverUpdateStamp &stamp);
+    bool ReadDelta(ObserverBrokerCode code, int32_t slotId, MessageParcel &data, TelephonyObserverDeltaValue &value);
     static constexpr int32_t CELL_NUM_MAX = 100;
     static constexpr int32_t SIGNAL_NUM_MAX = 100;
     std::map<uint32_t, TelephonyObserverFunc> memberFuncMap_;
+    std::mutex stampMutex_;
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverUpdateStamp> lastStamps_;
+    std::mutex deltaMutex_;
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverDeltaDecoder> deltaDecoders_;
+    // also serializes draining, every ring has a single consumer
+    std::mutex ringMutex_;
+    std::map<uint32_t, std::shared_ptr<TelephonyObserverRing>> rings_;
 };
 } // namespace Telephony
 } // namespace OHOS
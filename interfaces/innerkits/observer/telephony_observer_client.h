@@ -18,9 +18,19 @@
 
 #include <cstdint>
 #include <iremote_object.h>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <singleton.h>
+#include <utility>
 
 #include "i_telephony_state_notify.h"
+#include "state_registry_inner_ipc_interface_code.h"
+#include "telephony_observer_delta.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_mirror.h"
+#include "telephony_observer_options.h"
+#include "telephony_observer_signal_statistics.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -40,6 +50,19 @@ public:
     int32_t AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
         int32_t slotId, uint32_t mask, bool isUpdate);
 
+    /**
+     * @brief Add state observer with options.
+     *
+     * @param telephonyObserver Indicates the TelephonyObserverBroker.
+     * @param slotId Indicates the slot identification.
+     * @param mask Indicates the event type mask.
+     * @param isUpdate Whether to update data immediately.
+     * @param options Indicates the options of the observer, such as the fields it is notified for.
+     * @return Return 0 if add succeed, others if add failed.
+     */
+    int32_t AddStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver,
+        int32_t slotId, uint32_t mask, bool isUpdate, const TelephonyObserverOptions &options);
+
     /**
      * @brief Remove state observer.
      *
@@ -49,6 +72,101 @@ public:
      */
     int32_t RemoveStateObserver(int32_t slotId, uint32_t mask);
 
+    /**
+     * @brief Update the default cellular data slot, called by the producer of the data connection state.
+     *
+     * @param slotId Indicates the slot identification of the default cellular data.
+     * @return Return 0 if update succeed, others if update failed.
+     */
+    int32_t UpdateDefaultDataSlotId(int32_t slotId);
+
+    /**
+     * @brief Update the network state, sent as a delta against the value this process sent before.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param networkState Indicates the network state.
+     * @return Return 0 if update succeed, others if update failed.
+     */
+    int32_t UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState);
+
+    /**
+     * @brief Update the cell information, sent as a delta against the list this process sent before.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param cells Indicates the cell information list.
+     * @return Return 0 if update succeed, others if update failed.
+     */
+    int32_t UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &cells);
+
+    /**
+     * @brief Ask for the next network state and cell information of a slot to be sent in full, called by an
+     * observer that got a delta it cannot apply.
+     *
+     * @param telephonyObserver Indicates the TelephonyObserverBroker.
+     * @param slotId Indicates the slot identification.
+     * @param mask Indicates the event type mask.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t ResyncStateObserver(const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId, uint32_t mask);
+
+    /**
+     * @brief Ask for the current state of every listening type and slot of an event ring, called by an
+     * observer whose ring overflowed.
+     *
+     * @param telephonyObserver Indicates the TelephonyObserverBroker.
+     * @param ringId Indicates the ring identification.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t ResyncEventRing(const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t ringId);
+
+    /**
+     * @brief Get the call state, SIM state, cellular data state, CFU, voice mail and SIM active state of a slot.
+     * Only the first call asks the registry for its shared state region, later ones read it without IPC.
+     * CFU, voice mail and SIM active state are only reported to system apps allowed to set the telephony
+     * state, TelephonyObserverSlotState::reported tells which types the state holds.
+     *
+     * @param slotId Indicates the slot identification, -1 for the call state reported without a slot.
+     * @param state Out param, the state of the slot.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t GetSlotState(int32_t slotId, TelephonyObserverSlotState &state);
+
+    /**
+     * @brief Get the signal statistics the registry keeps for a slot, one entry per radio technology.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param statistics Out param, the statistics of the slot, empty if it reported no signal yet.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t GetSignalStatistics(int32_t slotId, std::vector<TelephonyObserverSignalStatistics> &statistics);
+
+    /**
+     * @brief Get what the subscribers of some listening types ask for, called by producers that poll the modem.
+     *
+     * @param mask Indicates the event type mask, one or more OBSERVER_MASK_* bits.
+     * @param interests Out param, one entry per bit of mask and slot.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests);
+
+    /**
+     * @brief Have TelephonyObserver::OnSubscriberInterestUpdated called whenever the interest in one of the
+     * listening types changes. Registering the observer again replaces its mask.
+     *
+     * @param telephonyObserver Indicates the TelephonyObserverBroker.
+     * @param mask Indicates the event type mask, one or more OBSERVER_MASK_* bits.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t AddInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask);
+
+    /**
+     * @brief Stop the interest updates of an observer added with AddInterestObserver.
+     *
+     * @param telephonyObserver Indicates the TelephonyObserverBroker.
+     * @return Return 0 if succeed, others if failed.
+     */
+    int32_t RemoveInterestObserver(const sptr<TelephonyObserverBroker> &telephonyObserver);
+
     /**
      * @brief Get the state registry proxy.
      *
@@ -71,11 +189,22 @@ private:
     };
 
     void OnRemoteDied(const wptr<IRemoteObject> &remote);
+    int32_t SendDelta(StateNotifyInnerInterfaceCode code, int32_t slotId, const TelephonyObserverDeltaValue &value);
+    int32_t SendDeltaRequest(const sptr<IRemoteObject> &remote, StateNotifyInnerInterfaceCode code, int32_t slotId,
+        const TelephonyObserverDeltaValue &value, TelephonyObserverDeltaEncoder &encoder);
+    std::shared_ptr<TelephonyObserverMirror> GetMirror();
+    int32_t SendInterestObserver(StateNotifyInnerInterfaceCode code,
+        const sptr<TelephonyObserverBroker> &telephonyObserver, uint32_t mask);
 
 private:
     std::mutex mutexProxy_;
     sptr<ITelephonyStateNotify> proxy_ {nullptr};
     sptr<IRemoteObject::DeathRecipient> deathRecipient_ {nullptr};
+    std::mutex mutexDelta_;
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverDeltaEncoder> deltaEncoders_;
+    // only taken to map the mirror, readers load it atomically
+    std::mutex mutexMirror_;
+    std::shared_ptr<TelephonyObserverMirror> mirror_ {nullptr};
 };
 } // namespace Telephony
 } // namespace OHOS
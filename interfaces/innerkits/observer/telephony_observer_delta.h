@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_DELTA_H
+#define TELEPHONY_OBSERVER_DELTA_H
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "cell_information.h"
+#include "network_state.h"
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief One entry of a delta encoded value, the marshalled bytes of a NetworkState or of one CellInformation.
+ */
+struct TelephonyObserverDeltaEntry {
+    /**
+     * Identity of the entry, entries of the same identity are diffed against each other.
+     */
+    int64_t key = 0;
+    std::vector<uint8_t> bytes;
+};
+
+using TelephonyObserverDeltaValue = std::vector<TelephonyObserverDeltaEntry>;
+
+/**
+ * @brief Conversions between state values and their delta encodable form.
+ */
+class TelephonyObserverDelta {
+public:
+    static bool FromNetworkState(const sptr<NetworkState> &networkState, TelephonyObserverDeltaValue &value);
+    static sptr<NetworkState> ToNetworkState(const TelephonyObserverDeltaValue &value);
+
+    /**
+     * @brief Convert a cell list, every cell is keyed by its type and cell id.
+     */
+    static bool FromCellInfo(const std::vector<sptr<CellInformation>> &cells, TelephonyObserverDeltaValue &value);
+
+    /**
+     * @brief Convert back to a cell list, cells of a type the registry does not forward are skipped.
+     */
+    static void ToCellInfo(const TelephonyObserverDeltaValue &value, std::vector<sptr<CellInformation>> &cells);
+};
+
+/**
+ * @brief Sending side of a delta encoded stream of one event type and slot.
+ *
+ * The first value and every value after Reset are sent in full. Later ones only carry the 32-bit words that
+ * differ from the value sent before: entries are matched by key, unchanged ones are referenced by their index
+ * in the previous value, changed ones of the same size are sent as a word bitmap plus the changed words, and
+ * entries no longer present are left out.
+ */
+class TelephonyObserverDeltaEncoder {
+public:
+    TelephonyObserverDeltaEncoder();
+    ~TelephonyObserverDeltaEncoder() = default;
+
+    /**
+     * @brief Write value and make it the base of the next one.
+     *
+     * @param parcel The parcel to write to.
+     * @param value The value to write.
+     * @return Return true if the value was written.
+     */
+    bool Write(Parcel &parcel, const TelephonyObserverDeltaValue &value);
+
+    /**
+     * @brief Forget the base, to be called when the value last written may not have reached the receiver.
+     */
+    void Reset();
+
+private:
+    bool WriteDelta(Parcel &parcel, const TelephonyObserverDeltaValue &value) const;
+
+private:
+    uint64_t channel_ = 0;
+    uint64_t sequence_ = 0;
+    bool hasBase_ = false;
+    TelephonyObserverDeltaValue base_;
+};
+
+/**
+ * @brief Receiving side of delta encoded streams of one event type and slot, one base per sender.
+ */
+class TelephonyObserverDeltaDecoder {
+public:
+    /**
+     * @brief Read a value written by TelephonyObserverDeltaEncoder.
+     *
+     * @param parcel The parcel to read from.
+     * @param value Out param, the full value.
+     * @return Return false if the payload is malformed or is a delta against a value this decoder does not
+     * have. The sender then has to send the value in full.
+     */
+    bool Read(Parcel &parcel, TelephonyObserverDeltaValue &value);
+
+private:
+    struct Base {
+        uint64_t sequence = 0;
+        TelephonyObserverDeltaValue value;
+    };
+
+    bool ReadDelta(Parcel &parcel, const TelephonyObserverDeltaValue &base, TelephonyObserverDeltaValue &value) const;
+
+private:
+    std::map<uint64_t, Base> bases_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_DELTA_H
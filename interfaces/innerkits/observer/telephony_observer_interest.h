@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TELEPHONY_OBSERVER_INTEREST_H
+#define TELEPHONY_OBSERVER_INTEREST_H
+
+#include <cstdint>
+#include <vector>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief What the subscribers of one listening type of a slot ask for, advertised to the producers of the
+ * type so they can poll the modem no faster than needed, or not at all.
+ */
+struct TelephonyObserverInterest {
+    // a single TelephonyObserverBroker::OBSERVER_MASK_* bit
+    uint32_t mask = 0;
+    int32_t slotId = 0;
+    // records notified for the type on the slot, all slot and default data slot ones included
+    uint32_t subscribers = 0;
+    // shortest delivery period any of them asked for, 0 if one of them wants every update
+    uint32_t minPeriodMs = 0;
+
+    bool operator==(const TelephonyObserverInterest &other) const
+    {
+        return mask == other.mask && slotId == other.slotId && subscribers == other.subscribers &&
+            minPeriodMs == other.minPeriodMs;
+    }
+
+    bool Marshalling(Parcel &parcel) const;
+    bool ReadFromParcel(Parcel &parcel);
+
+    /**
+     * @brief Write a list, the element count followed by the elements.
+     */
+    static bool WriteList(Parcel &parcel, const std::vector<TelephonyObserverInterest> &interests);
+
+    /**
+     * @brief Read a list written by WriteList.
+     *
+     * @return bool false if the list is truncated or longer than every type of every slot.
+     */
+    static bool ReadList(Parcel &parcel, std::vector<TelephonyObserverInterest> &interests);
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_INTEREST_H
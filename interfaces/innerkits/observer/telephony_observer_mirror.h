@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_MIRROR_H
+#define TELEPHONY_OBSERVER_MIRROR_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "ashmem.h"
+#include "sim_state_type.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Scalar state of a slot as last reported to the registry.
+ */
+struct TelephonyObserverSlotState {
+    // OBSERVER_MASK_* of the types reported so far, the fields of the others keep their defaults
+    uint32_t reported = 0;
+    int32_t callState = -1;
+    CardType cardType = CardType::UNKNOWN_CARD;
+    SimState simState = SimState::SIM_STATE_UNKNOWN;
+    LockReason lockReason = LockReason::SIM_NONE;
+    int32_t dataState = -1;
+    int32_t networkType = 0;
+    int32_t dataFlow = 0;
+    bool cfuResult = false;
+    bool voiceMailMsgResult = false;
+    bool simActive = false;
+};
+
+/**
+ * @brief Per-slot scalar state the registry publishes in a shared memory region, read by clients without
+ * calling the registry.
+ *
+ * Every slot is guarded by a sequence lock: the registry makes the sequence odd while it writes the slot, a
+ * reader retries when it saw an odd sequence or the sequence changed while it copied the slot. Readers map
+ * the region read-only and never block the registry. Slot -1 holds the call state reported without a slot.
+ */
+class TelephonyObserverMirror {
+public:
+    /**
+     * @brief Create the region on the registry side.
+     *
+     * @param slotCount Number of slots, slot -1 comes on top.
+     * @return Return nullptr if the region can not be made.
+     */
+    static std::shared_ptr<TelephonyObserverMirror> Create(int32_t slotCount);
+
+    /**
+     * @brief Map the region created by the registry on the client side.
+     *
+     * @return Return nullptr if the region is not a mirror.
+     */
+    static std::shared_ptr<TelephonyObserverMirror> Attach(const sptr<Ashmem> &ashmem);
+
+    TelephonyObserverMirror() = default;
+    ~TelephonyObserverMirror() = default;
+
+    /**
+     * @brief Change the state of a slot, registry side.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param mask The listening type being reported, added to TelephonyObserverSlotState::reported.
+     * @param update Called with the current state of the slot to change it.
+     */
+    void Write(int32_t slotId, uint32_t mask, const std::function<void(TelephonyObserverSlotState &state)> &update);
+
+    /**
+     * @brief Copy the state of a slot, client side.
+     *
+     * @param slotId Indicates the slot identification.
+     * @param state Out param, the state of the slot.
+     * @return Return false if the slot is out of range or kept changing while it was read.
+     */
+    bool Read(int32_t slotId, TelephonyObserverSlotState &state) const;
+
+    int32_t GetSlotCount() const;
+    sptr<Ashmem> GetAshmem() const;
+
+private:
+    struct Header;
+    struct Slot;
+
+    bool Map(const sptr<Ashmem> &ashmem, bool create, int32_t slotCount);
+    Slot *GetSlot(int32_t slotId) const;
+
+private:
+    sptr<Ashmem> ashmem_ = nullptr;
+    Slot *slots_ = nullptr;
+    int32_t slotCount_ = 0;
+    // a slot has a single writer at a time
+    std::mutex writeMutex_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_MIRROR_H
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_OPTIONS_H
+#define TELEPHONY_OBSERVER_OPTIONS_H
+
+#include <cstdint>
+#include <map>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Slot id to observe an event type on every slot with a single registration.
+ */
+constexpr int32_t SIM_SLOT_ID_FOR_ALL_SLOTS = 1000;
+
+/**
+ * @brief Fields of NetworkState a networkStateChange subscriber can restrict its notifications to.
+ */
+enum NetworkStateField : uint32_t {
+    /**
+     * Indicates the CS and PS registration state.
+     */
+    NETWORK_STATE_FIELD_REG_STATE = 1 << 0,
+    /**
+     * Indicates the CS and PS roaming state.
+     */
+    NETWORK_STATE_FIELD_ROAMING = 1 << 1,
+    /**
+     * Indicates the CS and PS radio technology.
+     */
+    NETWORK_STATE_FIELD_RADIO_TECH = 1 << 2,
+    /**
+     * Indicates the configured radio technology.
+     */
+    NETWORK_STATE_FIELD_CFG_TECH = 1 << 3,
+    /**
+     * Indicates the operator names and PLMN.
+     */
+    NETWORK_STATE_FIELD_OPERATOR = 1 << 4,
+    /**
+     * Indicates the NR state.
+     */
+    NETWORK_STATE_FIELD_NR_STATE = 1 << 5,
+    /**
+     * Indicates the emergency state.
+     */
+    NETWORK_STATE_FIELD_EMERGENCY = 1 << 6,
+};
+
+/**
+ * @brief Fields of the cellular data connection state a subscriber can restrict its notifications to.
+ */
+enum DataConnectionStateField : uint32_t {
+    /**
+     * Indicates the data connection state.
+     */
+    DATA_CONNECTION_STATE_FIELD_STATE = 1 << 0,
+    /**
+     * Indicates the network type of the data connection.
+     */
+    DATA_CONNECTION_STATE_FIELD_NETWORK_TYPE = 1 << 1,
+};
+
+/**
+ * @brief Fields of SignalInformation a signalInfoChange subscriber can restrict the payload to. The network
+ * type is always sent.
+ */
+enum SignalInfoField : uint32_t {
+    /**
+     * Indicates the signal level.
+     */
+    SIGNAL_INFO_FIELD_LEVEL = 1 << 0,
+    /**
+     * Indicates the signal intensity in dBm.
+     */
+    SIGNAL_INFO_FIELD_DBM = 1 << 1,
+};
+
+/**
+ * @brief How the updates of the registered event type reach a subscriber.
+ */
+enum DeliveryMode : uint32_t {
+    /**
+     * Indicates every update is delivered right away.
+     */
+    DELIVERY_MODE_EVERY = 0,
+    /**
+     * Indicates updates arriving within DELIVERY_LATEST_ONLY_WINDOW_MS of the last delivery are merged into one
+     * delivery carrying the latest value, made when the window ends.
+     */
+    DELIVERY_MODE_LATEST_ONLY = 1,
+    /**
+     * Indicates at most one delivery per period, carrying the latest value.
+     */
+    DELIVERY_MODE_PERIODIC = 2,
+};
+
+/**
+ * @brief Fixed coalescing window in milliseconds of DELIVERY_MODE_LATEST_ONLY.
+ */
+constexpr int64_t DELIVERY_LATEST_ONLY_WINDOW_MS = 50;
+
+/**
+ * @brief How the updates of one registered event type reach a subscriber.
+ */
+struct DeliveryPolicy {
+    /**
+     * DeliveryMode of the event type.
+     */
+    uint32_t mode = DELIVERY_MODE_EVERY;
+    /**
+     * Period in milliseconds of DELIVERY_MODE_PERIODIC, ignored by the other modes.
+     */
+    uint32_t periodMs = 0;
+};
+
+/**
+ * @brief Options given with a state observer registration.
+ */
+class TelephonyObserverOptions : public Parcelable {
+public:
+    TelephonyObserverOptions() = default;
+    ~TelephonyObserverOptions() = default;
+
+    bool Marshalling(Parcel &parcel) const override;
+    bool ReadFromParcel(Parcel &parcel);
+    static TelephonyObserverOptions *Unmarshalling(Parcel &parcel);
+
+    /**
+     * @brief Whether the options equal the ones of a plain registration.
+     *
+     * @return Return true if no option is set.
+     */
+    bool IsDefault() const;
+
+    /**
+     * @brief Set how the updates of each event type in mask reach the subscriber, the other types keep theirs.
+     *
+     * @param mask Listening type bitmask.
+     * @param mode DeliveryMode of the event types.
+     * @param periodMs Period in milliseconds of DELIVERY_MODE_PERIODIC.
+     */
+    void SetDeliveryPolicy(uint32_t mask, uint32_t mode, uint32_t periodMs);
+
+    /**
+     * @brief How the updates of one event type reach the subscriber.
+     *
+     * @param mask Listening type bit.
+     * @return Return the policy set for the type, every update if none is.
+     */
+    DeliveryPolicy GetDeliveryPolicy(uint32_t mask) const;
+
+    /**
+     * @brief Whether an event type is delivered other than on every update.
+     *
+     * @return Return true if a type has DELIVERY_MODE_LATEST_ONLY or DELIVERY_MODE_PERIODIC.
+     */
+    bool HasPacedDelivery() const;
+
+public:
+    /**
+     * NetworkStateField bitmask. A network state is only delivered when one of these fields differs from
+     * the one last delivered to the subscriber. 0 means every field.
+     */
+    uint32_t networkStateFields_ = 0;
+    /**
+     * DataConnectionStateField bitmask, same rule as networkStateFields_.
+     */
+    uint32_t dataConnectionStateFields_ = 0;
+    /**
+     * Whether the observer accepts network state and cell information as deltas against the value last
+     * delivered to it. Only observers derived from TelephonyObserver can decode them.
+     */
+    bool deltaEncoding_ = false;
+    /**
+     * Whether signal information and cell information are appended to a shared memory ring read by the
+     * observer instead of being sent one transaction each. Meant for native services that consume every
+     * update, only observers derived from TelephonyObserver can read the ring.
+     */
+    bool eventRing_ = false;
+    /**
+     * Period in milliseconds of the signal statistics delivered through
+     * TelephonyObserver::OnSignalStatisticsUpdated instead of every signal information update, rounded up
+     * to whole seconds. 0 delivers every update. Only observers derived from TelephonyObserver get them.
+     */
+    uint32_t signalStatisticsPeriodMs_ = 0;
+    /**
+     * SignalInfoField bitmask of the fields sent with signal information, the others read as 0 on the
+     * observer side. 0 means every field. Only observers derived from TelephonyObserver can decode it.
+     */
+    uint32_t signalInfoProjection_ = 0;
+    /**
+     * NetworkStateField bitmask of the fields sent with network state, same rule as signalInfoProjection_.
+     * Takes precedence over deltaEncoding_ for network state.
+     */
+    uint32_t networkStateProjection_ = 0;
+    /**
+     * DeliveryPolicy of the registered event types by listening type bit, the types without one get every
+     * update.
+     */
+    std::map<uint32_t, DeliveryPolicy> deliveryPolicies_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_OPTIONS_H
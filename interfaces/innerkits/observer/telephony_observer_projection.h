@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TELEPHONY_OBSERVER_PROJECTION_H
+#define TELEPHONY_OBSERVER_PROJECTION_H
+
+#include <cstdint>
+#include <vector>
+
+#include "network_state.h"
+#include "parcel.h"
+#include "signal_information.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Compact encoding of signal information and network state that only carries the fields a subscriber
+ * declared with TelephonyObserverOptions. The decoded values are regular objects whose other fields keep
+ * their defaults.
+ */
+class TelephonyObserverProjection {
+public:
+    /**
+     * @brief Write the network type of every signal, followed by the SignalInfoField values in fields.
+     */
+    static bool WriteSignalInfo(Parcel &parcel, uint32_t fields, const std::vector<sptr<SignalInformation>> &vec);
+    static bool ReadSignalInfo(Parcel &parcel, std::vector<sptr<SignalInformation>> &vec);
+
+    /**
+     * @brief Write the NetworkStateField values in fields, CS and PS ones each.
+     */
+    static bool WriteNetworkState(Parcel &parcel, uint32_t fields, const sptr<NetworkState> &networkState);
+    static sptr<NetworkState> ReadNetworkState(Parcel &parcel);
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_PROJECTION_H
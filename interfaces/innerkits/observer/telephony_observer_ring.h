@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_RING_H
+#define TELEPHONY_OBSERVER_RING_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "ashmem.h"
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Single producer, single consumer ring of state updates in a shared memory region.
+ *
+ * The registry appends the updates of one registration and the observer reads them in place. The observer
+ * only has to be woken when it has drained the ring and waits for more, Push tells the registry when. A
+ * record that does not fit is dropped and counted; nothing is appended after it until the observer has
+ * drained the ring and asked for the current state again, so it never misses an update without knowing.
+ */
+class TelephonyObserverRing {
+public:
+    static constexpr int32_t DEFAULT_CAPACITY = 64 * 1024;
+
+    /**
+     * @brief Create a ring on the registry side.
+     *
+     * @param id Identifies the ring towards the observer.
+     * @param slotId Slot id of the registration.
+     * @param mask Listening types carried by the ring.
+     * @param capacity Size of the record area in bytes.
+     * @return Return nullptr if the region can not be made.
+     */
+    static std::shared_ptr<TelephonyObserverRing> Create(uint32_t id, int32_t slotId, uint32_t mask,
+        int32_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Map a ring created by the registry on the observer side.
+     *
+     * @return Return nullptr if the region is not a ring.
+     */
+    static std::shared_ptr<TelephonyObserverRing> Attach(uint32_t id, const sptr<Ashmem> &ashmem);
+
+    explicit TelephonyObserverRing(uint32_t id);
+    ~TelephonyObserverRing() = default;
+
+    /**
+     * @brief Append a record, registry side.
+     *
+     * @param code The ObserverBrokerCode the body is the request of.
+     * @param body The request, read by the observer as if it came in a transaction with that code.
+     * @return Return true if the observer waits for records and has to be woken.
+     */
+    bool Push(uint32_t code, const Parcel &body);
+
+    /**
+     * @brief Read every record there is, observer side.
+     *
+     * @param handle Called with the code and the body of every record. The body is only valid during the call.
+     * @return Return true if records were dropped since the last drain, the observer then has to get the
+     * current state of every listening type of the ring again.
+     */
+    bool Drain(const std::function<void(uint32_t code, const uint8_t *body, size_t size)> &handle);
+
+    uint32_t GetId() const;
+    int32_t GetSlotId() const;
+    uint32_t GetMask() const;
+    uint64_t GetDropped() const;
+    sptr<Ashmem> GetAshmem() const;
+
+private:
+    struct Header;
+
+    bool Map(const sptr<Ashmem> &ashmem, bool create, int32_t slotId, uint32_t mask);
+    bool Pop(const std::function<void(uint32_t code, const uint8_t *body, size_t size)> &handle);
+
+private:
+    uint32_t id_ = 0;
+    sptr<Ashmem> ashmem_ = nullptr;
+    Header *header_ = nullptr;
+    uint8_t *records_ = nullptr;
+    uint64_t capacity_ = 0;
+    // the registry may push from several threads, the ring itself has a single producer
+    std::mutex pushMutex_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_RING_H
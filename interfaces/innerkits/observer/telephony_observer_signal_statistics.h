@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_SIGNAL_STATISTICS_H
+#define TELEPHONY_OBSERVER_SIGNAL_STATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Number of signal levels time is counted for, SignalInformation::GetSignalLevel() 0 to 5.
+ */
+constexpr int32_t SIGNAL_STATISTICS_LEVEL_COUNT = 6;
+
+/**
+ * @brief Aggregates the registry keeps over the signal samples of one radio technology of a slot.
+ */
+struct TelephonyObserverSignalStatistics {
+    // SignalInformation::NetworkType
+    int32_t networkType = 0;
+    uint64_t samples = 0;
+    int32_t lastDbm = 0;
+    // exponentially weighted moving average of the signal intensity
+    double averageDbm = 0;
+    // lowest and highest signal intensity over the last minute
+    int32_t windowMinDbm = 0;
+    int32_t windowMaxDbm = 0;
+    // 10th, 50th and 90th percentile, recent samples weigh more than old ones
+    int32_t lowDbm = 0;
+    int32_t medianDbm = 0;
+    int32_t highDbm = 0;
+    // time spent at each signal level
+    std::array<int64_t, SIGNAL_STATISTICS_LEVEL_COUNT> levelDurationMs {};
+
+    bool Marshalling(Parcel &parcel) const;
+    bool ReadFromParcel(Parcel &parcel);
+
+    /**
+     * @brief Write a list, the element count followed by the elements.
+     */
+    static bool WriteList(Parcel &parcel, const std::vector<TelephonyObserverSignalStatistics> &statistics);
+
+    /**
+     * @brief Read a list written by WriteList.
+     *
+     * @return bool false if the list is truncated or longer than any slot reports.
+     */
+    static bool ReadList(Parcel &parcel, std::vector<TelephonyObserverSignalStatistics> &statistics);
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_SIGNAL_STATISTICS_H
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_OBSERVER_UPDATE_STAMP_H
+#define TELEPHONY_OBSERVER_UPDATE_STAMP_H
+
+#include <cstdint>
+
+#include "parcel.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * @brief Ordering information the registry attaches to every state update it delivers.
+ */
+struct TelephonyObserverUpdateStamp {
+    /**
+     * Changes every time the registry starts, sequences of different epochs are not comparable.
+     */
+    uint64_t epoch = 0;
+    /**
+     * Increases with every update of the same event type and slot, gaps are left by updates
+     * coalesced or filtered out. 0 means the update carries no stamp, e.g. it was sent by an
+     * older registry.
+     */
+    uint64_t sequence = 0;
+    /**
+     * Monotonic time in milliseconds at which the registry accepted the update from its producer.
+     */
+    int64_t timestampMs = 0;
+
+    bool IsValid() const;
+
+    /**
+     * @brief Whether this update has to be dropped because the last one seen is newer or the same.
+     *
+     * @param last The stamp of the last update delivered for the same event type and slot.
+     * @return Return true if both are valid, of the same epoch and this one is not newer.
+     */
+    bool IsStale(const TelephonyObserverUpdateStamp &last) const;
+
+    bool Marshalling(Parcel &parcel) const;
+
+    /**
+     * @brief Read the stamp appended after the payload of an update.
+     *
+     * @param parcel The parcel positioned after the payload.
+     * @return Return false and leave the stamp invalid if the sender did not append one.
+     */
+    bool ReadFromParcel(Parcel &parcel);
+
+    /**
+     * @brief Get the stamp of the update being sent or handled on the calling thread.
+     *
+     * Inside a TelephonyObserver callback this is the stamp of the update being delivered.
+     *
+     * @return Return an invalid stamp outside of a delivery.
+     */
+    static TelephonyObserverUpdateStamp GetCurrent();
+};
+
+/**
+ * @brief Makes a stamp the current one of the calling thread while it is in scope.
+ */
+class TelephonyObserverUpdateStampScope {
+public:
+    explicit TelephonyObserverUpdateStampScope(const TelephonyObserverUpdateStamp &stamp);
+    ~TelephonyObserverUpdateStampScope();
+    TelephonyObserverUpdateStampScope(const TelephonyObserverUpdateStampScope &) = delete;
+    TelephonyObserverUpdateStampScope &operator=(const TelephonyObserverUpdateStampScope &) = delete;
+
+private:
+    TelephonyObserverUpdateStamp previous_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_OBSERVER_UPDATE_STAMP_H
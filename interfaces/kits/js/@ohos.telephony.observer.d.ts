@@ -744,6 +744,25 @@ declare namespace observer {
      * @since 8
      */
     reason: LockReason;
+
+    /**
+     * Indicates the sequence number of the update, increasing with every update of the same
+     * event type and card slot. Updates arriving out of order are not delivered.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    sequence?: number;
+
+    /**
+     * Indicates the monotonic time in milliseconds at which the update was reported.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    timestamp?: number;
   }
 
   /**
@@ -771,6 +790,25 @@ declare namespace observer {
      * @since 11
      */
     number: string;
+
+    /**
+     * Indicates the sequence number of the update, increasing with every update of the same
+     * event type and card slot. Updates arriving out of order are not delivered.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    sequence?: number;
+
+    /**
+     * Indicates the monotonic time in milliseconds at which the update was reported.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    timestamp?: number;
   }
 
   /**
@@ -798,6 +836,25 @@ declare namespace observer {
      * @since 11
      */
     network: RatType;
+
+    /**
+     * Indicates the sequence number of the update, increasing with every update of the same
+     * event type and card slot. Updates arriving out of order are not delivered.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    sequence?: number;
+
+    /**
+     * Indicates the monotonic time in milliseconds at which the update was reported.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    timestamp?: number;
   }
 
   /**
@@ -810,12 +867,178 @@ declare namespace observer {
   export interface ObserverOptions {
     /**
      * Indicates the ID of the target card slot.
+     * Since API version 12, 1000 observes every card slot with a single registration.
      *
      * @type { number }
      * @syscap SystemCapability.Telephony.StateRegistry
      * @since 11
      */
     slotId: number;
+
+    /**
+     * Indicates the fields of NetworkState the networkStateChange callback is invoked for.
+     * The callback is only invoked when one of them differs from the value it last received.
+     * All fields if not set.
+     *
+     * @type { ?Array<NetworkStateField> }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    networkStateFields?: Array<NetworkStateField>;
+
+    /**
+     * Indicates the fields of the data connection state the cellularDataConnectionStateChange
+     * callback is invoked for. The callback is only invoked when one of them differs from the value
+     * it last received. All fields if not set.
+     *
+     * @type { ?Array<DataConnectionStateField> }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    dataConnectionStateFields?: Array<DataConnectionStateField>;
+
+    /**
+     * Indicates how the updates reach the callback. Every update if not set. Callbacks of one event
+     * type and slot may each use their own mode.
+     *
+     * @type { ?DeliveryMode }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    deliveryMode?: DeliveryMode;
+
+    /**
+     * Indicates the period in milliseconds of DeliveryMode.PERIODIC, ignored by the other modes.
+     *
+     * @type { ?number }
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    deliveryPeriod?: number;
+  }
+
+  /**
+   * Enum for the fields of NetworkState an observer can be notified for.
+   *
+   * @enum { number }
+   * @syscap SystemCapability.Telephony.StateRegistry
+   * @since 12
+   */
+  export enum NetworkStateField {
+    /**
+     * Indicates the CS and PS registration state.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    REG_STATE = 1,
+
+    /**
+     * Indicates the CS and PS roaming state.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    ROAMING = 2,
+
+    /**
+     * Indicates the CS and PS radio technology.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    RADIO_TECH = 4,
+
+    /**
+     * Indicates the configured radio technology.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    CFG_TECH = 8,
+
+    /**
+     * Indicates the operator names and PLMN.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    OPERATOR = 16,
+
+    /**
+     * Indicates the NR state.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    NR_STATE = 32,
+
+    /**
+     * Indicates the emergency state.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    EMERGENCY = 64,
+  }
+
+  /**
+   * Enum for the fields of the data connection state an observer can be notified for.
+   *
+   * @enum { number }
+   * @syscap SystemCapability.Telephony.StateRegistry
+   * @since 12
+   */
+  export enum DataConnectionStateField {
+    /**
+     * Indicates the data connection state.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    STATE = 1,
+
+    /**
+     * Indicates the network type of the data connection.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    NETWORK_TYPE = 2,
+  }
+
+  /**
+   * Enum for how the updates of an event type reach an observer.
+   *
+   * @enum { number }
+   * @syscap SystemCapability.Telephony.StateRegistry
+   * @since 12
+   */
+  export enum DeliveryMode {
+    /**
+     * Indicates every update is delivered right away.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    EVERY = 0,
+
+    /**
+     * Indicates updates arriving within 50 ms of the last delivery are merged into one delivery
+     * carrying the latest value, made when the 50 ms have passed. The window is fixed.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    LATEST_ONLY = 1,
+
+    /**
+     * Indicates at most one delivery per period, carrying the latest value.
+     *
+     * @syscap SystemCapability.Telephony.StateRegistry
+     * @since 12
+     */
+    PERIODIC = 2,
   }
 
   /**
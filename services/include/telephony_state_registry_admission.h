@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_ADMISSION_H
+#define TELEPHONY_STATE_REGISTRY_ADMISSION_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Admission control for the update fan-out. Every Update* call enters before fanning out to the
+ * observers and leaves afterwards. Level-type updates (signal, cell info, network state, data flow)
+ * only keep the newest value: while one is being delivered for a (type, slot), later ones just mark
+ * it dirty and the running delivery re-reads the cache before it leaves. The watermarks apply to the
+ * work still queued, i.e. the dirty (type, slot) keys waiting for a re-delivery plus the deferred
+ * limiter deliveries; applied updates are never failed, the producer learns about the backpressure
+ * from the flag written after the result of the reply.
+ */
+class TelephonyStateRegistryAdmission {
+public:
+    TelephonyStateRegistryAdmission(uint32_t highWatermark, uint32_t lowWatermark);
+    ~TelephonyStateRegistryAdmission() = default;
+
+    /**
+     * Enter the fan-out.
+     *
+     * @param mask Listening type bitmask of the update.
+     * @param slotId Indicates the slot identification.
+     * @param coalescible Whether only the newest value of this (type, slot) has to be delivered.
+     * @return bool false if the update was merged into a delivery already running, true if the
+     * caller has to deliver it and then call Leave.
+     */
+    bool Enter(uint32_t mask, int32_t slotId, bool coalescible);
+
+    /**
+     * Leave the fan-out.
+     *
+     * @param mask Listening type bitmask of the update.
+     * @param slotId Indicates the slot identification.
+     * @return bool true if a newer value arrived meanwhile and the caller has to deliver the
+     * cached value again before calling Leave once more.
+     */
+    bool Leave(uint32_t mask, int32_t slotId);
+
+    /**
+     * Account a delivery deferred to a later task, e.g. by the limiter.
+     */
+    void AddQueued();
+
+    /**
+     * Account a deferred delivery once its task runs.
+     */
+    void RemoveQueued();
+
+    /**
+     * Check whether the producer has to be told to slow down.
+     *
+     * @return bool true while the queued work is above the low watermark after reaching the high one.
+     */
+    bool CheckBackpressure();
+
+    bool IsThrottled() const;
+    uint32_t GetConcurrentFanOuts() const;
+    uint32_t GetMaxConcurrentFanOuts() const;
+    uint32_t GetQueued() const;
+    uint32_t GetMaxQueued() const;
+    uint64_t GetHighWatermarkHits() const;
+    uint64_t GetCoalescedCount() const;
+    uint64_t GetThrottledCount() const;
+
+private:
+    using AdmissionKey = std::pair<uint32_t, int32_t>;
+    mutable std::mutex mutex_;
+    uint32_t highWatermark_ = 0;
+    uint32_t lowWatermark_ = 0;
+    uint32_t concurrentFanOuts_ = 0;
+    uint32_t maxConcurrentFanOuts_ = 0;
+    uint32_t queued_ = 0;
+    uint32_t maxQueued_ = 0;
+    bool throttled_ = false;
+    uint64_t highWatermarkHits_ = 0;
+    uint64_t coalescedCount_ = 0;
+    uint64_t throttledCount_ = 0;
+    // value is true if a newer value was cached while the key is being delivered
+    std::map<AdmissionKey, bool> inFlight_;
+
+    void IncreaseQueued(uint32_t mask);
+    void DecreaseQueued();
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_ADMISSION_H
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_CHANNEL_H
+#define TELEPHONY_STATE_REGISTRY_CHANNEL_H
+
+#include <cstdint>
+#include <map>
+
+#include "refbase.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_record.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Edge-type updates: every changed value reaches the subscribers, none is merged into a later one.
+ */
+struct TelephonyStateRegistryEdgePolicy {
+    static constexpr bool COALESCIBLE = false;
+    static constexpr bool FOLLOWS_DEFAULT_DATA_SLOT = false;
+};
+
+/**
+ * Level-type updates: only the newest value of a slot matters, intermediate ones may be skipped.
+ */
+struct TelephonyStateRegistryLevelPolicy {
+    static constexpr bool COALESCIBLE = true;
+    static constexpr bool FOLLOWS_DEFAULT_DATA_SLOT = false;
+};
+
+/**
+ * Compile-time description of an event type whose state is one value per slot. The service keeps the
+ * cache and runs every channel through the same intake, stamp, limiter, admission and fan-out code, the
+ * channel only supplies what differs between types. The policy decides whether the type is level or edge,
+ * whether subscribers of the default data slot get it too, and how a value is sent.
+ */
+template<uint32_t Mask, typename Payload, typename Policy>
+class TelephonyStateRegistryChannel {
+public:
+    using PayloadType = Payload;
+    using Cache = std::map<int32_t, Payload>;
+
+    static constexpr uint32_t MASK = Mask;
+    static constexpr bool COALESCIBLE = Policy::COALESCIBLE;
+    static constexpr bool FOLLOWS_DEFAULT_DATA_SLOT = Policy::FOLLOWS_DEFAULT_DATA_SLOT;
+
+    /**
+     * Cache the value of a slot.
+     *
+     * @return bool true if the value differs from the cached one or nothing was cached yet.
+     */
+    static bool Store(Cache &cache, int32_t slotId, const Payload &value)
+    {
+        auto it = cache.find(slotId);
+        if (it != cache.end() && it->second == value) {
+            return false;
+        }
+        cache[slotId] = value;
+        return true;
+    }
+
+    static bool IsListening(const TelephonyStateRegistryRecord &record)
+    {
+        return record.IsExistStateListener(Mask) && record.telephonyObserver_ != nullptr;
+    }
+
+    static void Deliver(const TelephonyStateRegistryRecord &record, int32_t slotId, const Payload &value)
+    {
+        Policy::Deliver(record.telephonyObserver_, slotId, value);
+    }
+};
+
+struct CfuIndicatorPolicy : public TelephonyStateRegistryEdgePolicy {
+    static void Deliver(const sptr<TelephonyObserverBroker> &observer, int32_t slotId, bool value)
+    {
+        observer->OnCfuIndicatorUpdated(slotId, value);
+    }
+};
+
+struct VoiceMailMsgIndicatorPolicy : public TelephonyStateRegistryEdgePolicy {
+    static void Deliver(const sptr<TelephonyObserverBroker> &observer, int32_t slotId, bool value)
+    {
+        observer->OnVoiceMailMsgIndicatorUpdated(slotId, value);
+    }
+};
+
+struct SimActiveStatePolicy : public TelephonyStateRegistryEdgePolicy {
+    static void Deliver(const sptr<TelephonyObserverBroker> &observer, int32_t slotId, bool value)
+    {
+        observer->OnSimActiveStateUpdated(slotId, value);
+    }
+};
+
+struct CellularDataFlowPolicy : public TelephonyStateRegistryLevelPolicy {
+    // 999 means observe the default cellular data slot
+    static constexpr bool FOLLOWS_DEFAULT_DATA_SLOT = true;
+
+    static void Deliver(const sptr<TelephonyObserverBroker> &observer, int32_t slotId, int32_t value)
+    {
+        observer->OnCellularDataFlowUpdated(slotId, value);
+    }
+};
+
+using CfuIndicatorChannel =
+    TelephonyStateRegistryChannel<TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR, bool, CfuIndicatorPolicy>;
+using VoiceMailMsgIndicatorChannel = TelephonyStateRegistryChannel<
+    TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR, bool, VoiceMailMsgIndicatorPolicy>;
+using SimActiveStateChannel = TelephonyStateRegistryChannel<
+    TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE, bool, SimActiveStatePolicy>;
+using CellularDataFlowChannel = TelephonyStateRegistryChannel<
+    TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW, int32_t, CellularDataFlowPolicy>;
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_CHANNEL_H
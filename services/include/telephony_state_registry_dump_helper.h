@@ -35,6 +35,17 @@ private:
     bool ShowTelephonyStateRegistryInfo(
         std::vector<TelephonyStateRegistryRecord> &stateRecords, std::string &result) const;
     void ShowTelephonyChangeState(std::string &result) const;
+    void ShowTelephonyStartupInfo(std::string &result) const;
+    void ShowTelephonyAdmissionInfo(std::string &result) const;
+    void ShowTelephonyLimiterInfo(std::string &result) const;
+    void ShowTelephonyWakeupInfo(std::string &result) const;
+    void ShowTelephonySignalStatisticsInfo(std::string &result) const;
+    void ShowTelephonyTimerWheelInfo(std::string &result) const;
+    void ShowTelephonyInterestInfo(std::string &result) const;
+    void ShowTelephonyProcessStateInfo(std::string &result) const;
+    void ShowTelephonyMemoryInfo(std::string &result) const;
+    void ShowTelephonyQuotaInfo(std::string &result) const;
+    void ShowTelephonyIdentityCacheInfo(std::string &result) const;
     bool WhetherHasSimCard(const int32_t slotId) const;
 };
 } // namespace Telephony
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_EVENT_BUFFER_H
+#define TELEPHONY_STATE_REGISTRY_EVENT_BUFFER_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+
+#include "common_event_manager.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Common events published before the common event service is up. Once Watch is called, events are kept
+ * until SetReady(true) and then published in the order they were sent, instead of being lost while the
+ * service is still starting. When the buffer is full the oldest event is dropped.
+ */
+class TelephonyStateRegistryEventBuffer {
+public:
+    using Publisher =
+        std::function<bool(const EventFwk::CommonEventData &data, const EventFwk::CommonEventPublishInfo &info)>;
+
+    TelephonyStateRegistryEventBuffer(size_t capacity, const Publisher &publisher);
+    ~TelephonyStateRegistryEventBuffer() = default;
+
+    /**
+     * Start buffering until the common event service is reported ready.
+     */
+    void Watch();
+
+    /**
+     * Publish an event, or keep it while the common event service is not ready.
+     *
+     * @return bool false if publishing failed, true if the event was published or kept.
+     */
+    bool Publish(const EventFwk::CommonEventData &data, const EventFwk::CommonEventPublishInfo &info);
+
+    /**
+     * Report whether the common event service is available, the kept events are published when it becomes so.
+     */
+    void SetReady(bool ready);
+
+    bool IsReady() const;
+    size_t GetPendingCount() const;
+    uint64_t GetDroppedCount() const;
+    uint64_t GetFlushedCount() const;
+
+private:
+    struct PendingEvent {
+        EventFwk::CommonEventData data;
+        EventFwk::CommonEventPublishInfo info;
+    };
+
+    mutable std::mutex mutex_;
+    size_t capacity_ = 0;
+    Publisher publisher_;
+    // events are published straight away until Watch is called
+    bool watched_ = false;
+    bool ready_ = false;
+    std::deque<PendingEvent> pending_;
+    uint64_t droppedCount_ = 0;
+    uint64_t flushedCount_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_EVENT_BUFFER_H
@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_IDENTITY_H
+#define TELEPHONY_STATE_REGISTRY_IDENTITY_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Identity of a subscriber process, shared by all the records it registers.
+ */
+struct TelephonyStateRegistryIdentity {
+    std::string bundleName = "";
+    std::string appIdentifier = "";
+    int32_t uid = 0;
+    pid_t pid = 0;
+    int32_t tokenId = 0;
+};
+
+/**
+ * Interns the identities of the subscriber processes, so a process registering several event types and slots
+ * holds a single copy of its strings. An identity is released with the last record referring to it.
+ */
+class TelephonyStateRegistryIdentityPool {
+public:
+    std::shared_ptr<const TelephonyStateRegistryIdentity> Intern(pid_t pid, int32_t uid, int32_t tokenId,
+        const std::string &bundleName, const std::string &appIdentifier);
+    size_t GetSize() const;
+
+private:
+    using IdentityKey = std::pair<pid_t, int32_t>;
+    mutable std::mutex mutex_;
+    std::map<IdentityKey, std::weak_ptr<const TelephonyStateRegistryIdentity>> identities_;
+};
+
+/**
+ * Bundle name and app identifier resolved for a (uid, tokenId), so repeated registrations of a process skip the
+ * bundle and access token queries. The cache is only enabled while package changes are observed, and the entries
+ * of a package are dropped when it is changed or removed.
+ */
+class TelephonyStateRegistryIdentityCache {
+public:
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const;
+
+    /**
+     * Look up the resolved identity of a caller.
+     *
+     * @param uid Calling uid.
+     * @param tokenId Calling token id.
+     * @param bundleName Out param, the cached bundle name.
+     * @param appIdentifier Out param, the cached app identifier.
+     * @param generation Out param, to be passed to Insert once the identity is resolved on a miss.
+     * @return bool true on a hit.
+     */
+    bool Lookup(int32_t uid, int32_t tokenId, std::string &bundleName, std::string &appIdentifier,
+        uint64_t &generation);
+
+    /**
+     * Keep a resolved identity, unless packages changed since the Lookup returning generation.
+     */
+    void Insert(int32_t uid, int32_t tokenId, const std::string &bundleName, const std::string &appIdentifier,
+        uint64_t generation);
+
+    /**
+     * Drop the entries of a changed or removed package.
+     *
+     * @param bundleName Bundle name of the package.
+     * @param uid Uid of the package, -1 if unknown.
+     */
+    void Invalidate(const std::string &bundleName, int32_t uid);
+
+    size_t GetSize() const;
+    uint64_t GetHitCount() const;
+    uint64_t GetMissCount() const;
+
+private:
+    static constexpr size_t MAX_CACHED_IDENTITY = 256;
+    using CacheKey = std::pair<int32_t, int32_t>;
+    mutable std::mutex mutex_;
+    bool enabled_ = false;
+    uint64_t generation_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    std::map<CacheKey, std::pair<std::string, std::string>> entries_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_IDENTITY_H
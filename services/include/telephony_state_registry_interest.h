@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TELEPHONY_STATE_REGISTRY_INTEREST_H
+#define TELEPHONY_STATE_REGISTRY_INTEREST_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "iremote_object.h"
+#include "telephony_observer_broker.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_options.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Subscriber interest advertised to the producers that registered an interest observer. The service collects
+ * the interest in the types the observers watch from its records, this class keeps what was advertised last
+ * and works out which entries each observer has to be told about.
+ */
+class TelephonyStateRegistryInterest {
+public:
+    using InterestKey = std::pair<uint32_t, int32_t>;
+    using InterestMap = std::map<InterestKey, TelephonyObserverInterest>;
+    using Notification = std::pair<sptr<TelephonyObserverBroker>, std::vector<TelephonyObserverInterest>>;
+
+    TelephonyStateRegistryInterest() = default;
+    ~TelephonyStateRegistryInterest() = default;
+
+    /**
+     * Count a record notified for the type and slot of interest, with the delivery period its options ask for.
+     * Every update is asked for unless the record is paced with DELIVERY_MODE_PERIODIC.
+     */
+    static void AddSubscriber(TelephonyObserverInterest &interest, const TelephonyObserverOptions &options);
+
+    /**
+     * Add an observer, or replace the mask of one added before. The next Update tells it every entry of mask.
+     */
+    void AddObserver(const sptr<TelephonyObserverBroker> &observer, uint32_t mask);
+    bool RemoveObserver(const sptr<IRemoteObject> &remote);
+
+    /**
+     * @return uint32_t the listening types any observer watches, 0 if there is none.
+     */
+    uint32_t GetWatchedMask() const;
+
+    /**
+     * Compare the current interest with the one advertised last, dead observers are dropped.
+     *
+     * @param current Interest in every type of GetWatchedMask() and every slot.
+     * @param notifications Out param, the entries each observer has to be sent.
+     */
+    void Update(const InterestMap &current, std::vector<Notification> &notifications);
+
+    size_t GetObserverCount() const;
+    uint64_t GetAdvertisedCount() const;
+
+private:
+    struct InterestObserver {
+        sptr<TelephonyObserverBroker> observer;
+        uint32_t mask = 0;
+        bool initial = true;
+    };
+
+    mutable std::mutex mutex_;
+    std::map<sptr<IRemoteObject>, InterestObserver> observers_;
+    InterestMap advertised_;
+    uint64_t advertisedCount_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_INTEREST_H
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_LIMITER_H
+#define TELEPHONY_STATE_REGISTRY_LIMITER_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+struct LimiterConfig {
+    int64_t debounceMs = 0;
+    uint32_t burst = 0;
+    uint32_t refillPerSecond = 0;
+    /**
+     * true for level-type updates, whose intermediate values may be collapsed into the latest one.
+     * Edge-type updates never lose a changed value, only repeated identical ones.
+     */
+    bool coalescible = false;
+
+    bool IsEnabled() const
+    {
+        return debounceMs > 0 || burst > 0;
+    }
+};
+
+struct LimiterStatistics {
+    uint64_t delivered = 0;
+    uint64_t deferred = 0;
+    uint64_t dropped = 0;
+    uint64_t forced = 0;
+    uint64_t trailing = 0;
+};
+
+enum class LimiterDecision {
+    DELIVER,
+    DEFER,
+    DROP,
+};
+
+/**
+ * Per-(type, slot) debounce window and token bucket in front of the subscriber fan-out. The service sets
+ * a config for every type it limits from persist.telephony.state_registry.limiter.<type>.debounce_ms,
+ * .burst and .refill, where <type> is network_state, sim_state, data_connection_state, data_flow,
+ * cfu_indicator, voice_mail_msg_indicator or sim_active_state. Network, SIM and data connection state
+ * default to a short debounce window; a type whose debounce_ms and burst are both 0 is not limited.
+ */
+class TelephonyStateRegistryLimiter {
+public:
+    TelephonyStateRegistryLimiter() = default;
+    ~TelephonyStateRegistryLimiter() = default;
+
+    void SetConfig(uint32_t mask, const LimiterConfig &config);
+    bool GetConfig(uint32_t mask, LimiterConfig &config) const;
+
+    /**
+     * Decide what to do with an update.
+     *
+     * @param mask Listening type bitmask of the update.
+     * @param slotId Indicates the slot identification.
+     * @param changed Whether the value differs from the previous one, only used by edge types.
+     * @param nowMs Current monotonic time in milliseconds.
+     * @param delayMs Out param, the delay of the trailing delivery the caller has to schedule
+     * when DEFER is returned, or 0 if one is already scheduled.
+     * @return LimiterDecision DELIVER to fan out now, DEFER if a trailing delivery will carry the
+     * latest value, DROP if the update is a repeated identical edge-type value.
+     */
+    LimiterDecision Admit(uint32_t mask, int32_t slotId, bool changed, int64_t nowMs, int64_t &delayMs);
+
+    /**
+     * Mark the scheduled trailing delivery of (type, slot) as done.
+     */
+    void OnTrailing(uint32_t mask, int32_t slotId, int64_t nowMs);
+
+    std::map<uint32_t, LimiterStatistics> GetStatistics() const;
+
+private:
+    struct BucketState {
+        int64_t lastDeliverMs = 0;
+        int64_t lastRefillMs = 0;
+        double tokens = 0;
+        bool delivered = false;
+        bool trailingPending = false;
+    };
+
+    void Refill(const LimiterConfig &config, BucketState &state, int64_t nowMs) const;
+    bool TakeToken(BucketState &state) const;
+
+private:
+    mutable std::mutex mutex_;
+    std::map<uint32_t, LimiterConfig> configs_;
+    std::map<uint32_t, LimiterStatistics> statistics_;
+    std::map<std::pair<uint32_t, int32_t>, BucketState> states_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_LIMITER_H
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_MEMORY_H
+#define TELEPHONY_STATE_REGISTRY_MEMORY_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+enum class MemoryCategory : uint32_t {
+    RECORDS = 0,
+    SIGNAL_CACHE,
+    CELL_CACHE,
+    NETWORK_CACHE,
+    QUEUED,
+    EXT_COPIES,
+    CATEGORY_COUNT,
+};
+
+struct MemoryUsage {
+    uint64_t bytes = 0;
+    uint64_t highWatermark = 0;
+};
+
+struct BundleMemoryUsage {
+    uint32_t records = 0;
+    uint64_t recordBytes = 0;
+    uint64_t queuedBytes = 0;
+};
+
+/**
+ * Byte accounting of the registry, kept up to date by the code that allocates or frees, so reporting
+ * never walks the records or the caches. The sizes are estimates from sizeof and container sizes, not
+ * allocator numbers.
+ */
+class TelephonyStateRegistryMemory {
+public:
+    void Add(MemoryCategory category, uint64_t bytes);
+    void Sub(MemoryCategory category, uint64_t bytes);
+    void Replace(MemoryCategory category, uint64_t oldBytes, uint64_t newBytes);
+
+    void AddRecord(const std::string &bundleName, uint64_t bytes);
+    void RemoveRecord(const std::string &bundleName, uint64_t bytes);
+    void ResizeRecord(const std::string &bundleName, uint64_t oldBytes, uint64_t newBytes);
+
+    /**
+     * Account an update kept for a deferred process until it becomes active again.
+     *
+     * @param pid Process of the subscriber.
+     * @param bundleName Bundle the queued bytes are attributed to.
+     * @param bytes Size of the queued update.
+     */
+    void AddQueued(pid_t pid, const std::string &bundleName, uint64_t bytes);
+
+    /**
+     * Release all the updates queued for a process.
+     *
+     * @param pid Process of the subscriber.
+     */
+    void ClearQueued(pid_t pid);
+
+    MemoryUsage GetUsage(MemoryCategory category) const;
+    uint64_t GetTotalBytes() const;
+    uint64_t GetTotalHighWatermark() const;
+    std::map<std::string, BundleMemoryUsage> GetBundleUsage() const;
+
+    static const char *GetCategoryName(MemoryCategory category);
+
+private:
+    void AddLocked(MemoryCategory category, uint64_t bytes);
+    void SubLocked(MemoryCategory category, uint64_t bytes);
+
+private:
+    mutable std::mutex mutex_;
+    MemoryUsage usage_[static_cast<uint32_t>(MemoryCategory::CATEGORY_COUNT)];
+    uint64_t totalBytes_ = 0;
+    uint64_t totalHighWatermark_ = 0;
+    std::map<std::string, BundleMemoryUsage> bundles_;
+    // queued bytes of a deferred process and the bundle they belong to
+    std::map<pid_t, std::pair<std::string, uint64_t>> queued_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_MEMORY_H
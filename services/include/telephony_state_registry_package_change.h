@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_PACKAGE_CHANGE_H
+#define TELEPHONY_STATE_REGISTRY_PACKAGE_CHANGE_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace OHOS {
+namespace EventFwk {
+class CommonEventSubscriber;
+} // namespace EventFwk
+namespace Telephony {
+/**
+ * Tells the registry when a package is changed, replaced or removed, so what was resolved for it is dropped.
+ */
+class PackageChangeSource {
+public:
+    using Callback = std::function<void(const std::string &bundleName, int32_t uid)>;
+    virtual ~PackageChangeSource() = default;
+    virtual bool Start(const Callback &callback) = 0;
+    virtual void Stop() = 0;
+};
+
+/**
+ * Package changes reported by the package common events.
+ */
+class CommonEventPackageChangeSource : public PackageChangeSource {
+public:
+    bool Start(const Callback &callback) override;
+    void Stop() override;
+
+private:
+    std::mutex mutex_;
+    std::shared_ptr<EventFwk::CommonEventSubscriber> subscriber_ = nullptr;
+};
+
+/**
+ * Package changes reported by hand, used by tests.
+ */
+class LocalPackageChangeSource : public PackageChangeSource {
+public:
+    bool Start(const Callback &callback) override;
+    void Stop() override;
+    void NotifyChanged(const std::string &bundleName, int32_t uid);
+
+private:
+    std::mutex mutex_;
+    Callback callback_ = nullptr;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_PACKAGE_CHANGE_H
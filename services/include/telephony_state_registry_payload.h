@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_PAYLOAD_H
+#define TELEPHONY_STATE_REGISTRY_PAYLOAD_H
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <sys/mman.h>
+#include <vector>
+
+#include "ashmem.h"
+#include "cell_information.h"
+#include "message_parcel.h"
+#include "refbase.h"
+#include "signal_information.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Immutable signal or cell information list of one update, shared by the cache and every delivery of it.
+ * It holds the typed list, for the ext hooks, the common event, delta encoding and in-process observers, and
+ * the bytes remote observers get (the element count followed by the elements). The bytes a producer sent are
+ * kept as they are once they decoded into the list, otherwise they are marshalled the first time they are
+ * asked for. Bytes of at least BLOB_THRESHOLD_BYTES are also written once into a sealed shared memory region
+ * that remote observers map instead of getting a copy.
+ */
+template<typename T, int32_t MaxCount>
+class TelephonyStateRegistryPayload {
+public:
+    // below one page, copying the bytes into each transaction is cheaper than mapping them
+    static constexpr size_t BLOB_THRESHOLD_BYTES = 4096;
+    // larger lists are marshalled again when they are sent, they are not worth keeping as bytes
+    static constexpr size_t MAX_PASS_THROUGH_BYTES = 16384;
+
+    using Decoder = void (*)(MessageParcel &data, const int32_t size, std::vector<sptr<T>> &result);
+
+    TelephonyStateRegistryPayload(std::vector<uint8_t> &&bytes, const std::vector<sptr<T>> &list)
+        : bytes_(std::move(bytes)), hasBytes_(true), list_(list),
+          footprint_(bytes_.capacity() + GetListFootprint(list))
+    {}
+
+    explicit TelephonyStateRegistryPayload(const std::vector<sptr<T>> &list)
+        : list_(list), footprint_(GetListFootprint(list))
+    {}
+
+    ~TelephonyStateRegistryPayload() = default;
+
+    /**
+     * Decode the list a producer sent and keep the bytes it was decoded from, without what follows them in the
+     * parcel. The bytes are dropped if they do not decode into size elements or exceed MAX_PASS_THROUGH_BYTES.
+     *
+     * @param data Parcel positioned right after the element count.
+     * @param begin Read position of the element count.
+     * @param size Element count, at most MaxCount.
+     * @param decoder Reads size elements from data.
+     */
+    static std::shared_ptr<const TelephonyStateRegistryPayload> Read(
+        MessageParcel &data, size_t begin, int32_t size, Decoder decoder)
+    {
+        std::vector<sptr<T>> list;
+        decoder(data, size, list);
+        size_t end = data.GetReadPosition();
+        const uint8_t *buffer = reinterpret_cast<const uint8_t *>(data.GetData());
+        if (buffer == nullptr || list.size() != static_cast<size_t>(size) || end <= begin ||
+            end > data.GetDataSize() || end - begin > MAX_PASS_THROUGH_BYTES) {
+            return std::make_shared<const TelephonyStateRegistryPayload>(list);
+        }
+        return std::make_shared<const TelephonyStateRegistryPayload>(
+            std::vector<uint8_t>(buffer + begin, buffer + end), list);
+    }
+
+    const std::vector<uint8_t> &GetBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!hasBytes_) {
+            // observers read at most MaxCount elements, the proxy never sent more either
+            size_t count = std::min(list_.size(), static_cast<size_t>(MaxCount));
+            MessageParcel parcel;
+            parcel.WriteInt32(static_cast<int32_t>(count));
+            for (size_t i = 0; i < count; i++) {
+                list_[i]->Marshalling(parcel);
+            }
+            const uint8_t *data = reinterpret_cast<const uint8_t *>(parcel.GetData());
+            bytes_.assign(data, data + parcel.GetDataSize());
+            hasBytes_ = true;
+        }
+        return bytes_;
+    }
+
+    const std::vector<sptr<T>> &GetList() const
+    {
+        return list_;
+    }
+
+    /**
+     * Read-only shared memory region holding the bytes, made on first use. Every transaction carrying it
+     * holds a reference to the region, which is released when the payload and the last reader close it.
+     *
+     * @return sptr<Ashmem> nullptr if the bytes are below BLOB_THRESHOLD_BYTES or the region can not be made.
+     */
+    sptr<Ashmem> GetBlob() const
+    {
+        const std::vector<uint8_t> &bytes = GetBytes();
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (blobMade_ || bytes.size() < BLOB_THRESHOLD_BYTES || bytes.size() > INT32_MAX) {
+            return blob_;
+        }
+        blobMade_ = true;
+        int32_t size = static_cast<int32_t>(bytes.size());
+        sptr<Ashmem> blob = Ashmem::CreateAshmem("telephony_state_registry_payload", size);
+        if (blob == nullptr) {
+            return nullptr;
+        }
+        bool written = blob->MapReadAndWriteAshmem() && blob->WriteToAshmem(bytes.data(), size, 0);
+        blob->UnmapAshmem();
+        if (!written || !blob->SetProtection(PROT_READ)) {
+            blob->CloseAshmem();
+            return nullptr;
+        }
+        blob_ = blob;
+        return blob_;
+    }
+
+    /**
+     * Bytes held by the forms the payload arrived in, the ones accounted to the cache.
+     */
+    uint64_t GetFootprint() const
+    {
+        return footprint_;
+    }
+
+private:
+    static uint64_t GetListFootprint(const std::vector<sptr<T>> &list)
+    {
+        return list.capacity() * sizeof(sptr<T>) + list.size() * sizeof(T);
+    }
+
+private:
+    mutable std::mutex mutex_;
+    mutable std::vector<uint8_t> bytes_;
+    mutable bool hasBytes_ = false;
+    const std::vector<sptr<T>> list_;
+    mutable sptr<Ashmem> blob_ = nullptr;
+    mutable bool blobMade_ = false;
+    uint64_t footprint_ = 0;
+};
+
+using SignalInfoPayload = TelephonyStateRegistryPayload<SignalInformation, SignalInformation::MAX_SIGNAL_NUM>;
+using CellInfoPayload = TelephonyStateRegistryPayload<CellInformation, CellInformation::MAX_CELL_NUM>;
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_PAYLOAD_H
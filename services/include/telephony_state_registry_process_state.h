@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_PROCESS_STATE_H
+#define TELEPHONY_STATE_REGISTRY_PROCESS_STATE_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sys/types.h>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Tells the registry when a subscriber process gets frozen or sent to background (deferred) and when it
+ * becomes active again.
+ */
+class ProcessStateSource {
+public:
+    using Callback = std::function<void(pid_t pid, bool deferred)>;
+    virtual ~ProcessStateSource() = default;
+    virtual bool Start(const Callback &callback) = 0;
+    virtual void Stop() = 0;
+};
+
+/**
+ * Process state reported by the telephony ext library.
+ */
+class ExtProcessStateSource : public ProcessStateSource {
+public:
+    bool Start(const Callback &callback) override;
+    void Stop() override;
+};
+
+/**
+ * Process state set by hand, used by tests.
+ */
+class LocalProcessStateSource : public ProcessStateSource {
+public:
+    bool Start(const Callback &callback) override;
+    void Stop() override;
+    void SetDeferred(pid_t pid, bool deferred);
+
+private:
+    std::mutex mutex_;
+    Callback callback_ = nullptr;
+};
+
+/**
+ * Delivery state of the subscriber processes. While a process is deferred only the (type, slot) keys of the
+ * updates it missed are kept, the values are read from the registry cache when it becomes active again.
+ */
+class TelephonyStateRegistryProcessState {
+public:
+    using PendingKey = std::pair<uint32_t, int32_t>;
+
+    bool IsDeferred(pid_t pid) const;
+
+    /**
+     * Keep an update for a process if it is deferred.
+     *
+     * @param pid Process of the subscriber.
+     * @param mask Listening type bitmask of the update.
+     * @param slotId Indicates the slot identification.
+     * @return bool true if the process is deferred and the update has to be skipped.
+     */
+    bool Defer(pid_t pid, uint32_t mask, int32_t slotId);
+
+    /**
+     * Same as above.
+     *
+     * @param added Out param, true if the (type, slot) was not pending for the process yet.
+     */
+    bool Defer(pid_t pid, uint32_t mask, int32_t slotId, bool &added);
+
+    /**
+     * Change the delivery state of a process.
+     *
+     * @param pid Process of the subscriber.
+     * @param deferred Whether the process is frozen or in background.
+     * @param pending Out param, the keys the process missed when it becomes active.
+     */
+    void SetDeferred(pid_t pid, bool deferred, std::set<PendingKey> &pending);
+
+    uint32_t GetDeferredProcessCount() const;
+    uint64_t GetDeferredCount() const;
+    uint64_t GetFlushedCount() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::map<pid_t, std::set<PendingKey>> deferred_;
+    uint64_t deferredCount_ = 0;
+    uint64_t flushedCount_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_PROCESS_STATE_H
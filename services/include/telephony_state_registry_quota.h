@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_QUOTA_H
+#define TELEPHONY_STATE_REGISTRY_QUOTA_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+
+namespace OHOS {
+namespace Telephony {
+struct QuotaUsage {
+    std::string bundleName;
+    uint32_t records = 0;
+    uint64_t rejected = 0;
+};
+
+/**
+ * Number of records a uid and a pid may hold, so the cost of fanning out an update is bounded by policy
+ * instead of by how often an app registers. A limit of 0 means unlimited.
+ */
+class TelephonyStateRegistryQuota {
+public:
+    TelephonyStateRegistryQuota(uint32_t uidLimit, uint32_t pidLimit);
+    ~TelephonyStateRegistryQuota() = default;
+
+    void SetLimits(uint32_t uidLimit, uint32_t pidLimit);
+    uint32_t GetUidLimit() const;
+    uint32_t GetPidLimit() const;
+
+    /**
+     * Account a new record.
+     *
+     * @param uid Uid of the subscriber.
+     * @param pid Process of the subscriber.
+     * @param bundleName Bundle the usage is reported for.
+     * @return bool false if the uid or the pid already holds its limit, the record must not be added then.
+     */
+    bool Acquire(int32_t uid, pid_t pid, const std::string &bundleName);
+
+    /**
+     * Account a removed record.
+     */
+    void Release(int32_t uid, pid_t pid);
+
+    std::map<int32_t, QuotaUsage> GetUidUsage() const;
+
+private:
+    mutable std::mutex mutex_;
+    uint32_t uidLimit_ = 0;
+    uint32_t pidLimit_ = 0;
+    std::map<int32_t, QuotaUsage> uids_;
+    std::map<pid_t, uint32_t> pids_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_QUOTA_H
@@ -16,15 +16,75 @@
 #ifndef STATE_REGISTRY_TELEPHONY_STATE_REGISTRY_RECORD_H
 #define STATE_REGISTRY_TELEPHONY_STATE_REGISTRY_RECORD_H
 
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "telephony_observer_broker.h"
+#include "telephony_observer_options.h"
+#include "telephony_observer_ring.h"
+#include "telephony_state_registry_identity.h"
 
 namespace OHOS {
 namespace Telephony {
+/**
+ * Values last delivered to a record registered with field predicates, per slot. Shared by the copies of the
+ * record state taken for an initial delivery.
+ */
+struct TelephonyStateRegistryDelivered {
+    std::mutex mutex;
+    std::map<int32_t, sptr<NetworkState>> networkStates;
+    // slot id to (data state, network type)
+    std::map<int32_t, std::pair<int32_t, int32_t>> dataConnectStates;
+};
+
+class TelephonyStateRegistryRecord;
+
+/**
+ * Options of a record and what they need at delivery time. The service keeps them keyed by the record id, so the
+ * record itself holds no containers and copying it does not allocate.
+ */
+class TelephonyStateRegistryRecordState {
+public:
+    void SetOptions(const TelephonyObserverOptions &options);
+
+    /**
+     * IsNetworkStateChanged
+     *
+     * @param record Record the state belongs to
+     * @param slotId Slot of the update
+     * @param networkState Network state about to be delivered
+     * @return bool true if one of the fields in options_ differs from the network state last delivered,
+     * for the same slot, which is then replaced by networkState. Only records observing
+     * SIM_SLOT_ID_FOR_ALL_SLOTS keep one value per slot.
+     */
+    bool IsNetworkStateChanged(
+        const TelephonyStateRegistryRecord &record, int32_t slotId, const sptr<NetworkState> &networkState) const;
+
+    /**
+     * IsDataConnectStateChanged
+     *
+     * @param record Record the state belongs to
+     * @param slotId Slot of the update
+     * @param dataState Data connection state about to be delivered
+     * @param networkType Network type about to be delivered
+     * @return bool true if one of the fields in options_ differs from the value last delivered for the same
+     * slot, which is then replaced. Only records observing SIM_SLOT_ID_FOR_ALL_SLOTS keep one value per slot.
+     */
+    bool IsDataConnectStateChanged(
+        const TelephonyStateRegistryRecord &record, int32_t slotId, int32_t dataState, int32_t networkType) const;
+
+public:
+    TelephonyObserverOptions options_;
+    std::shared_ptr<TelephonyStateRegistryDelivered> delivered_ = nullptr;
+    // signal and cell information go through this ring if the observer asked for one
+    std::shared_ptr<TelephonyObserverRing> ring_ = nullptr;
+};
+
 class TelephonyStateRegistryRecord {
 public:
-    bool IsCanReadCallHistory();
+    bool IsCanReadCallHistory() const;
     /**
      * IsExistStateListener
      *
@@ -35,15 +95,42 @@ public:
 
     bool CanManageCallForDevices() const;
 
+    const std::string &GetBundleName() const;
+    const std::string &GetAppIdentifier() const;
+    int32_t GetUid() const;
+
+    /**
+     * IsSlotMatched
+     *
+     * @param slotId Slot of the update, -1 for the slot-less call state
+     * @return bool true if the record observes slotId, either directly or through SIM_SLOT_ID_FOR_ALL_SLOTS.
+     */
+    bool IsSlotMatched(int32_t slotId) const;
+
+    /**
+     * GetDeliveredSlotId
+     *
+     * @param slotId Slot of the update
+     * @return int32_t Slot the last delivered value is kept for, slotId_ unless observing SIM_SLOT_ID_FOR_ALL_SLOTS.
+     */
+    int32_t GetDeliveredSlotId(int32_t slotId) const;
+
 public:
-    std::string bundleName_ = "";
+    // tokenId_ and pid_ identify the registration, the rest of the identity is shared by the records of a process
+    std::shared_ptr<const TelephonyStateRegistryIdentity> identity_ = nullptr;
     int32_t tokenId_ = 0;
-    int32_t uid_ = 0;
     pid_t pid_ = 0;
     unsigned int mask_ = 0;
     int slotId_ = 0;
-    std::string appIdentifier_ = "";
     sptr<TelephonyObserverBroker> telephonyObserver_ = nullptr;
+    // key of the TelephonyStateRegistryRecordState kept by the service, assigned when the record is created
+    uint64_t recordId_ = 0;
+    // whether a SIM_SLOT_ID_FOR_ALL_SLOTS record also observes the VSim slot
+    bool canObserveVSim_ = false;
+    // sequence of the initial state snapshot taken when registering with notifyNow, 0 if none
+    uint64_t snapshotSeq_ = 0;
+    // key of the record in the timer wheel when its options ask for a delivery mode other than every update
+    uint64_t pacingId_ = 0;
 };
 } // namespace Telephony
 } // namespace OHOS
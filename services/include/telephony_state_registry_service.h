@@ -16,23 +16,48 @@
 #ifndef TELEPHONY_STATE_REGISTRY_SERVICE_H
 #define TELEPHONY_STATE_REGISTRY_SERVICE_H
 
+#include <atomic>
 #include <map>
 #include <shared_mutex>
 #include <mutex>
 #include <string>
+#include <utility>
 
 #include "singleton.h"
 #include "system_ability.h"
 #include "common_event_manager.h"
 #include "want.h"
 
+#include "telephony_observer_mirror.h"
+#include "telephony_observer_update_stamp.h"
+#include "telephony_state_registry_admission.h"
+#include "telephony_state_registry_channel.h"
+#include "telephony_state_registry_event_buffer.h"
+#include "telephony_state_registry_interest.h"
+#include "telephony_state_registry_limiter.h"
+#include "telephony_state_registry_memory.h"
+#include "telephony_state_registry_package_change.h"
+#include "telephony_state_registry_payload.h"
+#include "telephony_state_registry_process_state.h"
+#include "telephony_state_registry_quota.h"
 #include "telephony_state_registry_record.h"
+#include "telephony_state_registry_signal_statistics.h"
 #include "telephony_state_registry_stub.h"
+#include "telephony_state_registry_timer_wheel.h"
+#include "telephony_state_registry_wakeup.h"
 #include "sim_state_type.h"
 
 namespace OHOS {
+namespace AppExecFwk {
+class EventHandler;
+} // namespace AppExecFwk
 namespace Telephony {
 enum class ServiceRunningState { STATE_STOPPED, STATE_RUNNING };
+struct StartupPhase {
+    std::string name;
+    // milliseconds since OnStart was entered
+    int64_t elapsedMs = 0;
+};
 class TelephonyStateRegistryService : public SystemAbility,
                                       public TelephonyStateRegistryStub,
                                       public std::enable_shared_from_this<TelephonyStateRegistryService> {
@@ -42,6 +67,8 @@ public:
     void OnStart() override;
     void OnStop() override;
     void OnDump() override;
+    void OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
+    void OnRemoveSystemAbility(int32_t systemAbilityId, const std::string &deviceId) override;
     int Dump(std::int32_t fd, const std::vector<std::u16string> &args) override;
     std::string GetBindStartTime();
     std::string GetBindEndTime();
@@ -55,14 +82,29 @@ public:
     int32_t UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState) override;
     int32_t UpdateSimState(int32_t slotId, CardType type, SimState state, LockReason reason) override;
     int32_t UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &vec) override;
+    int32_t UpdateSignalInfoPayload(int32_t slotId, const std::shared_ptr<const SignalInfoPayload> &payload) override;
+    int32_t UpdateCellInfoPayload(int32_t slotId, const std::shared_ptr<const CellInfoPayload> &payload) override;
     int32_t UpdateCfuIndicator(int32_t slotId, bool cfuResult) override;
     int32_t UpdateVoiceMailMsgIndicator(int32_t slotId, bool voiceMailMsgResult) override;
     int32_t UpdateIccAccount() override;
     int32_t UpdateSimActiveState(int32_t slotId, bool activeStateResult) override;
+    bool CheckUpdateBackpressure() override;
     int32_t RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId, uint32_t mask,
         const std::string &bundleName, bool notifyNow, pid_t pid, int32_t uid, int32_t tokenId,
         const std::string &appIdentifier) override;
+    int32_t RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId, uint32_t mask,
+        const std::string &bundleName, bool notifyNow, pid_t pid, int32_t uid, int32_t tokenId,
+        const std::string &appIdentifier, const TelephonyObserverOptions &options) override;
     int32_t UnregisterStateChange(int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid) override;
+    int32_t UpdateDefaultDataSlotId(int32_t slotId) override;
+    int32_t ResyncStateObserver(
+        const sptr<IRemoteObject> &remote, int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid) override;
+    int32_t ResyncEventRing(const sptr<IRemoteObject> &remote, uint32_t ringId, int32_t tokenId, pid_t pid) override;
+    int32_t GetStateMirror(sptr<Ashmem> &ashmem) override;
+    int32_t GetSignalStatistics(int32_t slotId, std::vector<TelephonyObserverSignalStatistics> &statistics) override;
+    int32_t GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests) override;
+    int32_t AddInterestObserver(const sptr<IRemoteObject> &remote, uint32_t mask) override;
+    int32_t RemoveInterestObserver(const sptr<IRemoteObject> &remote) override;
     int32_t GetServiceRunningState();
     int32_t GetSimState(int32_t slotId);
     int32_t GetCallState(int32_t slotId);
@@ -71,18 +113,128 @@ public:
     int32_t GetCellularDataFlow(int32_t slotId);
     int32_t GetCellularDataConnectionNetworkType(int32_t slotId);
     int32_t GetLockReason(int32_t slotId);
+    int32_t GetDefaultDataSlotId();
+    const TelephonyStateRegistryAdmission &GetAdmission() const;
+    const TelephonyStateRegistryLimiter &GetLimiter() const;
+    const TelephonyStateRegistryProcessState &GetProcessState() const;
+    const TelephonyStateRegistryMemory &GetMemory() const;
+    const TelephonyStateRegistryQuota &GetQuota() const;
+    void SetProcessStateSource(const std::shared_ptr<ProcessStateSource> &source);
+    void OnProcessStateChanged(pid_t pid, bool deferred);
+    const TelephonyStateRegistryIdentityCache &GetIdentityCache() const;
+    void SetPackageChangeSource(const std::shared_ptr<PackageChangeSource> &source);
+    void OnPackageChanged(const std::string &bundleName, int32_t uid);
+    std::vector<StartupPhase> GetStartupTimeline() const;
+    const TelephonyStateRegistryEventBuffer &GetEventBuffer() const;
+    const TelephonyStateRegistryWakeup &GetWakeup() const;
+    const TelephonyStateRegistrySignalStatistics &GetSignalStatistics() const;
+    const TelephonyStateRegistryTimerWheel &GetTimerWheel() const;
+    const TelephonyStateRegistryInterest &GetInterest() const;
 
 private:
+    // cached state of a slot, copied under lock_ so the initial delivery can run without it
+    struct SlotSnapshot {
+        int32_t callState = 0;
+        std::u16string callIncomingNumber;
+        std::shared_ptr<const SignalInfoPayload> signalInfos = nullptr;
+        sptr<NetworkState> networkState = nullptr;
+        std::shared_ptr<const CellInfoPayload> cellInfos = nullptr;
+        CardType cardType {};
+        SimState simState {};
+        LockReason simReason {};
+        int32_t cellularDataConnectionState = 0;
+        int32_t cellularDataConnectionNetworkType = 0;
+        int32_t cellularDataFlow = 0;
+        bool cfuResult = false;
+        bool voiceMailMsgResult = false;
+        bool simActiveResult = false;
+        // stamps of the cached values by listening type bitmask
+        std::map<uint32_t, TelephonyObserverUpdateStamp> stamps;
+
+        TelephonyObserverUpdateStamp GetStamp(uint32_t mask) const
+        {
+            auto it = stamps.find(mask);
+            return it == stamps.end() ? TelephonyObserverUpdateStamp() : it->second;
+        }
+    };
+
     void Finalize();
+    void LoadTelephonyExt();
+    void ResetStartupTimeline();
+    void MarkStartupPhase(const std::string &phase);
     void UpdateData(const TelephonyStateRegistryRecord &record);
-    void UpdateDataEx(const TelephonyStateRegistryRecord &record);
+    void UpdateData(const TelephonyStateRegistryRecord &record, const TelephonyStateRegistryRecordState &state,
+        const std::map<int32_t, SlotSnapshot> &snapshots);
+    void UpdateDataForSlotId(const TelephonyStateRegistryRecord &record, const TelephonyStateRegistryRecordState &state,
+        int32_t slotId, const SlotSnapshot &snapshot);
+    void UpdateDataEx(const TelephonyStateRegistryRecord &record, int32_t slotId, const SlotSnapshot &snapshot);
+    void CaptureSnapshot(const TelephonyStateRegistryRecord &record, std::map<int32_t, SlotSnapshot> &snapshots);
+    void BeginInitialDelivery(TelephonyStateRegistryRecord &record);
+    bool IsInitialDeliveryPending(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    void FinishInitialDelivery(uint64_t snapshotSeq);
+    void InitLimiter();
+    void InitQuota();
+    void InitWakeup();
+    bool IsLimited(uint32_t mask, int32_t slotId, bool changed, int32_t &result);
+    int32_t HasStateListener(uint32_t mask, int32_t slotId);
+    int32_t DeliverLevelUpdate(uint32_t mask, int32_t slotId);
+    int32_t NotifySignalInfoUpdated(int32_t slotId);
+    int32_t NotifyCellInfoUpdated(int32_t slotId);
+    void DeliverSignalInfo(const TelephonyStateRegistryRecord &record, const TelephonyStateRegistryRecordState &state,
+        int32_t slotId, const SignalInfoPayload &payload);
+    void DeliverCellInfo(const TelephonyStateRegistryRecord &record, const TelephonyStateRegistryRecordState &state,
+        int32_t slotId, const CellInfoPayload &payload);
+    void DeliverSignalStatistics(const TelephonyStateRegistryRecord &record, int32_t slotId);
+    void StartSignalStatisticsTick();
+    void PostSignalStatisticsTick();
+    void OnSignalStatisticsTick();
+    bool FindRecord(int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid, size_t &index) const;
+    bool FindMergeableRecord(const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId,
+        int32_t tokenId, pid_t pid, size_t &index) const;
+    const TelephonyStateRegistryRecordState &GetRecordState(const TelephonyStateRegistryRecord &record) const;
+    TelephonyStateRegistryRecordState &GetMutableRecordState(const TelephonyStateRegistryRecord &record);
+    void AttachEventRing(const TelephonyStateRegistryRecord &record, TelephonyStateRegistryRecordState &state);
+    void AssignPacingId(TelephonyStateRegistryRecord &record, const TelephonyObserverOptions &options);
+    static bool IsMergeableOptions(const TelephonyObserverOptions &options);
+    void MergeDeliveryPolicy(
+        TelephonyStateRegistryRecord &record, uint32_t mask, const TelephonyObserverOptions &options);
+    void ReleaseMask(TelephonyStateRegistryRecord &record, uint32_t mask);
+    bool PushEventRing(const TelephonyStateRegistryRecord &record, TelephonyObserverRing &ring,
+        TelephonyObserverBroker::ObserverBrokerCode code, int32_t slotId, const std::vector<uint8_t> &bytes);
+    int32_t NotifyCallStateUpdated(int32_t slotId, int32_t callState, const std::u16string &number);
+    int32_t NotifyNetworkStateUpdated(int32_t slotId);
+    int32_t NotifyCellularDataFlowUpdated(int32_t slotId);
+    template<typename Channel>
+    int32_t UpdateChannel(typename Channel::Cache &cache, int32_t slotId, const typename Channel::PayloadType &value);
+    template<typename Channel>
+    int32_t NotifyChannel(
+        int32_t slotId, const typename Channel::PayloadType &value, const TelephonyObserverUpdateStamp &stamp);
+    template<typename Channel>
+    void NotifyCachedChannel(
+        const TelephonyStateRegistryRecord &record, const typename Channel::Cache &cache, int32_t slotId);
+    bool IsDeliveryDeferred(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    bool IsProcessDeferred(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    bool IsWakeupDeferred(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    void CloseWakeupWindow(pid_t pid);
+    bool IsPacingDeferred(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    void PostTimerWheelTick();
+    void OnTimerWheelTick();
+    void CollectInterest(uint32_t mask, TelephonyStateRegistryInterest::InterestMap &interests);
+    void AdvertiseInterest(uint32_t mask);
+    bool IsDefaultDataSlotMatched(const TelephonyStateRegistryRecord &record, int32_t slotId) const;
+    bool IsDeferredSlotMatched(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    void NotifyCachedState(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    void NotifyCachedStateEx(const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId);
+    TelephonyObserverUpdateStamp NextStamp(uint32_t mask, int32_t slotId);
+    void MirrorState(uint32_t mask, int32_t slotId);
+    TelephonyObserverUpdateStamp GetStamp(uint32_t mask, int32_t slotId) const;
 
 private:
     bool CheckCallerIsSystemApp(uint32_t mask);
     bool IsMultiSimsCapabilitySupported(int32_t slotId);
     bool CheckPermission(uint32_t mask);
     bool VerifySlotId(int32_t slotId);
-    std::u16string GetCallIncomingNumberForSlotId(TelephonyStateRegistryRecord record, int32_t slotId);
+    std::u16string GetCallIncomingNumberForSlotId(const TelephonyStateRegistryRecord &record, int32_t slotId);
     bool PublishCommonEvent(const AAFwk::Want &want, int32_t eventCode, const std::string &eventData);
     void SendCallStateChanged(int32_t slotId, int32_t state);
     void SendCallStateChangedAsUserMultiplePermission(int32_t slotId, int32_t state, const std::u16string &number);
@@ -93,27 +245,81 @@ private:
     bool IsCommonEventServiceAbilityExist();
 
 private:
+    static constexpr uint32_t QUEUED_HIGH_WATERMARK = 8;
+    static constexpr uint32_t QUEUED_LOW_WATERMARK = 2;
+    static constexpr uint32_t UID_RECORD_QUOTA = 200;
+    static constexpr uint32_t PID_RECORD_QUOTA = 100;
+    static constexpr size_t MAX_PENDING_COMMON_EVENTS = 64;
+    static constexpr int64_t SIGNAL_STATISTICS_TICK_MS = 1000;
     ServiceRunningState state_ = ServiceRunningState::STATE_STOPPED;
     std::shared_mutex lock_;
     int32_t slotSize_ = 0;
     int64_t bindStartTime_ = 0L;
     int64_t bindEndTime_ = 0L;
     int64_t bindSpendTime_ = 0L;
-    std::map<int32_t, bool> cfuResult_;
-    std::map<int32_t, bool> voiceMailMsgResult_;
+    CfuIndicatorChannel::Cache cfuResult_;
+    VoiceMailMsgIndicatorChannel::Cache voiceMailMsgResult_;
     std::map<int32_t, int32_t> callState_;
     std::map<int32_t, std::u16string> callIncomingNumber_;
-    std::map<int32_t, std::vector<sptr<SignalInformation>>> signalInfos_;
-    std::map<int32_t, std::vector<sptr<CellInformation>>> cellInfos_;
+    std::map<int32_t, std::shared_ptr<const SignalInfoPayload>> signalInfos_;
+    std::map<int32_t, std::shared_ptr<const CellInfoPayload>> cellInfos_;
     std::map<int32_t, sptr<NetworkState>> searchNetworkState_;
     std::vector<TelephonyStateRegistryRecord> stateRecords_;
+    // options of the records by TelephonyStateRegistryRecord::recordId_, guarded by lock_ like the records
+    std::map<uint64_t, TelephonyStateRegistryRecordState> recordStates_;
+    uint64_t recordSeq_ = 0;
     std::map<int32_t, SimState> simState_;
     std::map<int32_t, CardType> cardType_;
     std::map<int32_t, LockReason> simReason_;
     std::map<int32_t, int32_t> cellularDataConnectionState_;
     std::map<int32_t, int32_t> cellularDataConnectionNetworkType_;
-    std::map<int32_t, int32_t> cellularDataFlow_;
-    std::map<int32_t, bool> simActiveResult_;
+    CellularDataFlowChannel::Cache cellularDataFlow_;
+    SimActiveStateChannel::Cache simActiveResult_;
+    // stamp of the cached value of every (type, slot), guarded by lock_ like the values
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverUpdateStamp> stamps_;
+    uint64_t stampEpoch_ = 0;
+    // scalar state published to clients, written under lock_ like the values
+    // every app may map mirror_, the types only system apps observe are mirrored in systemMirror_ as well
+    std::shared_ptr<TelephonyObserverMirror> mirror_ = nullptr;
+    std::shared_ptr<TelephonyObserverMirror> systemMirror_ = nullptr;
+    // -1 until the producer reports it, 999 subscribers then get the updates of every slot
+    int32_t defaultDataSlotId_ = -1;
+    TelephonyStateRegistryAdmission admission_ { QUEUED_HIGH_WATERMARK, QUEUED_LOW_WATERMARK };
+    TelephonyStateRegistryLimiter limiter_;
+    std::shared_ptr<AppExecFwk::EventHandler> handler_ = nullptr;
+    TelephonyStateRegistryProcessState processState_;
+    TelephonyStateRegistryIdentityPool identities_;
+    TelephonyStateRegistryMemory memory_;
+    TelephonyStateRegistryQuota quota_ { UID_RECORD_QUOTA, PID_RECORD_QUOTA };
+    TelephonyStateRegistryWakeup wakeup_;
+    TelephonyStateRegistrySignalStatistics signalStatistics_;
+    // whether a tick is posted, it stops when no record subscribes to the statistics anymore
+    std::atomic<bool> signalStatisticsTicking_ = false;
+    uint64_t signalStatisticsTicks_ = 0;
+    // held deliveries of the records registered with a delivery mode other than DELIVERY_MODE_EVERY
+    TelephonyStateRegistryTimerWheel timerWheel_;
+    uint64_t pacingSeq_ = 0;
+    // taken across collecting and sending the interest, so the observers get the changes in order
+    std::mutex interestMutex_;
+    TelephonyStateRegistryInterest interest_;
+    std::mutex processStateSourceMutex_;
+    std::shared_ptr<ProcessStateSource> processStateSource_ = nullptr;
+    uint64_t snapshotSeq_ = 0;
+    uint32_t ringId_ = 0;
+    // updates a record missed while its initial snapshot was being delivered, by snapshot sequence
+    struct InitialDelivery {
+        // registrations merged into the record while a snapshot is in flight share its sequence
+        uint32_t snapshots = 0;
+        std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+    };
+    std::mutex initialMutex_;
+    std::map<uint64_t, InitialDelivery> initialPending_;
+    std::mutex packageChangeSourceMutex_;
+    std::shared_ptr<PackageChangeSource> packageChangeSource_ = nullptr;
+    TelephonyStateRegistryEventBuffer eventBuffer_;
+    mutable std::mutex startupMutex_;
+    int64_t startupBeginMs_ = 0;
+    std::vector<StartupPhase> startupTimeline_;
 };
 } // namespace Telephony
 } // namespace OHOS
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_SIGNAL_STATISTICS_H
+#define TELEPHONY_STATE_REGISTRY_SIGNAL_STATISTICS_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "refbase.h"
+#include "signal_information.h"
+#include "telephony_observer_signal_statistics.h"
+
+namespace OHOS {
+namespace Telephony {
+/**
+ * Signal statistics of every slot and radio technology, updated with each signal information report so
+ * subscribers that only want the aggregates need not get and fold every sample. Every structure is of
+ * bounded size: the percentiles come from a histogram whose counts are halved when it fills up, and the
+ * rolling minimum and maximum are kept in monotonic queues that only hold the last minute.
+ */
+class TelephonyStateRegistrySignalStatistics {
+public:
+    static constexpr int32_t HISTOGRAM_MIN_DBM = -140;
+    static constexpr int32_t HISTOGRAM_STEP_DBM = 2;
+    static constexpr size_t HISTOGRAM_BUCKET_COUNT = 50;
+
+    /**
+     * Fold a signal information report of a slot in. A radio technology the report does not carry stops
+     * counting time at its last level.
+     */
+    void Add(int32_t slotId, const std::vector<sptr<SignalInformation>> &signals, int64_t nowMs);
+
+    /**
+     * @param nowMs Current monotonic time in milliseconds, the rolling window and the time at the current
+     * level end there.
+     */
+    void Get(int32_t slotId, int64_t nowMs, std::vector<TelephonyObserverSignalStatistics> &statistics) const;
+    std::map<int32_t, std::vector<TelephonyObserverSignalStatistics>> GetAll(int64_t nowMs) const;
+
+private:
+    struct RatState {
+        TelephonyObserverSignalStatistics statistics;
+        std::array<uint32_t, HISTOGRAM_BUCKET_COUNT> histogram {};
+        uint32_t histogramCount = 0;
+        // (time, dBm) with increasing dBm for the minimum and decreasing dBm for the maximum
+        std::deque<std::pair<int64_t, int32_t>> windowMin;
+        std::deque<std::pair<int64_t, int32_t>> windowMax;
+        // level the time since levelSinceMs counts for, -1 if the last report did not carry the technology
+        int32_t level = -1;
+        int64_t levelSinceMs = 0;
+    };
+
+    void AddSample(RatState &state, int32_t dbm, int32_t level, int64_t nowMs);
+    void SetLevel(RatState &state, int32_t level, int64_t nowMs);
+    TelephonyObserverSignalStatistics Snapshot(const RatState &state, int64_t nowMs) const;
+    int32_t GetPercentile(const RatState &state, uint32_t percent) const;
+
+private:
+    mutable std::mutex mutex_;
+    std::map<int32_t, std::map<int32_t, RatState>> states_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_SIGNAL_STATISTICS_H
@@ -17,12 +17,21 @@
 #define TELEPHONY_STATE_REGISTRY_STUB_H
 
 #include <map>
+#include <mutex>
+#include <utility>
 
 #include "iremote_stub.h"
 
 #include "telephony_log_wrapper.h"
 #include "i_telephony_state_notify.h"
+#include "state_registry_inner_ipc_interface_code.h"
 #include "state_registry_ipc_interface_code.h"
+#include "telephony_observer_delta.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_options.h"
+#include "telephony_observer_signal_statistics.h"
+#include "telephony_state_registry_identity.h"
+#include "telephony_state_registry_payload.h"
 
 namespace OHOS {
 namespace Telephony {
@@ -38,16 +47,53 @@ public:
         uint32_t mask, const std::string &bundleName, bool notifyNow, pid_t pid, int32_t uid, int32_t tokenId,
         const std::string &appIdentifier) = 0;
 
+    virtual int32_t RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId,
+        uint32_t mask, const std::string &bundleName, bool notifyNow, pid_t pid, int32_t uid, int32_t tokenId,
+        const std::string &appIdentifier, const TelephonyObserverOptions &options) = 0;
+
     virtual int32_t UnregisterStateChange(int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid) = 0;
 
+    virtual int32_t UpdateDefaultDataSlotId(int32_t slotId) = 0;
+
+    virtual int32_t ResyncStateObserver(
+        const sptr<IRemoteObject> &remote, int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid) = 0;
+
+    virtual int32_t ResyncEventRing(const sptr<IRemoteObject> &remote, uint32_t ringId, int32_t tokenId, pid_t pid) = 0;
+    virtual int32_t GetStateMirror(sptr<Ashmem> &ashmem) = 0;
+    virtual int32_t GetSignalStatistics(int32_t slotId, std::vector<TelephonyObserverSignalStatistics> &statistics) = 0;
+    virtual int32_t GetSubscriberInterest(uint32_t mask, std::vector<TelephonyObserverInterest> &interests) = 0;
+    virtual int32_t AddInterestObserver(const sptr<IRemoteObject> &remote, uint32_t mask) = 0;
+    virtual int32_t RemoveInterestObserver(const sptr<IRemoteObject> &remote) = 0;
+
+    /**
+     * Update signal information or cell information with the list still in the form the producer sent it.
+     */
+    virtual int32_t UpdateSignalInfoPayload(
+        int32_t slotId, const std::shared_ptr<const SignalInfoPayload> &payload) = 0;
+    virtual int32_t UpdateCellInfoPayload(int32_t slotId, const std::shared_ptr<const CellInfoPayload> &payload) = 0;
+
+    /**
+     * Whether the producer has to slow down, written after the result of every update reply.
+     */
+    virtual bool CheckUpdateBackpressure() = 0;
+
+    static void parseSignalInfos(
+        MessageParcel &data, const int32_t size, std::vector<sptr<SignalInformation>> &result);
+    static void ParseCellInfos(MessageParcel &data, const int32_t size, std::vector<sptr<CellInformation>> &result);
+
+protected:
+    TelephonyStateRegistryIdentityCache identityCache_;
+
 private:
     int32_t ReadData(MessageParcel &data, MessageParcel &reply, sptr<TelephonyObserverBroker> &callback);
     int32_t RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver,
         int32_t slotId, uint32_t mask, bool isUpdate) override;
+    int32_t RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver,
+        int32_t slotId, uint32_t mask, bool isUpdate, const TelephonyObserverOptions &options);
     int32_t UnregisterStateChange(int32_t slotId, uint32_t mask) override;
-    void parseSignalInfos(
-        MessageParcel &data, const int32_t size, std::vector<sptr<SignalInformation>> &result);
-    void ParseLteNrSignalInfos(
+    void WriteUpdateResult(MessageParcel &reply, int32_t ret);
+    void ResolveIdentity(int32_t uid, int32_t tokenId, std::string &bundleName, std::string &appIdentifier);
+    static void ParseLteNrSignalInfos(
         MessageParcel &data, std::vector<sptr<SignalInformation>> &result, SignalInformation::NetworkType type);
 
 private:
@@ -60,6 +106,7 @@ private:
     int32_t OnUpdateNetworkState(MessageParcel &data, MessageParcel &reply);
     int32_t OnUpdateSimState(MessageParcel &data, MessageParcel &reply);
     int32_t OnRegisterStateChange(MessageParcel &data, MessageParcel &reply);
+    int32_t OnRegisterStateChangeWithOptions(MessageParcel &data, MessageParcel &reply);
     int32_t OnUnregisterStateChange(MessageParcel &data, MessageParcel &reply);
     int32_t OnUpdateCellularDataConnectState(MessageParcel &data, MessageParcel &reply);
     int32_t OnUpdateCellularDataFlow(MessageParcel &data, MessageParcel &reply);
@@ -67,11 +114,26 @@ private:
     int32_t OnUpdateVoiceMailMsgIndicator(MessageParcel &data, MessageParcel &reply);
     int32_t OnIccAccountUpdated(MessageParcel &data, MessageParcel &reply);
     int32_t OnSimActiveStateUpdated(MessageParcel &data, MessageParcel &reply);
+    int32_t OnUpdateDefaultDataSlotId(MessageParcel &data, MessageParcel &reply);
+    int32_t OnUpdateNetworkStateDelta(MessageParcel &data, MessageParcel &reply);
+    int32_t OnUpdateCellInfoDelta(MessageParcel &data, MessageParcel &reply);
+    int32_t OnResyncStateObserver(MessageParcel &data, MessageParcel &reply);
+    int32_t OnResyncEventRing(MessageParcel &data, MessageParcel &reply);
+    int32_t OnGetStateMirror(MessageParcel &data, MessageParcel &reply);
+    int32_t OnGetSignalStatistics(MessageParcel &data, MessageParcel &reply);
+    int32_t OnGetSubscriberInterest(MessageParcel &data, MessageParcel &reply);
+    int32_t OnAddInterestObserver(MessageParcel &data, MessageParcel &reply);
+    int32_t OnRemoveInterestObserver(MessageParcel &data, MessageParcel &reply);
+    int32_t ReadDelta(
+        StateNotifyInnerInterfaceCode code, int32_t slotId, MessageParcel &data, TelephonyObserverDeltaValue &value);
     int32_t SetTimer(uint32_t code);
     void CancelTimer(int32_t id);
 
 private:
     std::map<StateNotifyInterfaceCode, TelephonyStateFunc> memberFuncMap_;
+    std::mutex deltaMutex_;
+    // bases of the network state and cell information deltas sent by producers, per (code, slot)
+    std::map<std::pair<uint32_t, int32_t>, TelephonyObserverDeltaDecoder> deltaDecoders_;
     std::map<uint32_t, std::string> collieCodeStringMap_ = {
         { uint32_t(StateNotifyInterfaceCode::ADD_OBSERVER), "ADD_OBSERVER" },
     };
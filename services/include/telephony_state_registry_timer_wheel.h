@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef TELEPHONY_STATE_REGISTRY_TIMER_WHEEL_H
+#define TELEPHONY_STATE_REGISTRY_TIMER_WHEEL_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace OHOS {
+namespace Telephony {
+struct TimerWheelStatistics {
+    // updates delivered right away
+    uint64_t immediate = 0;
+    // updates held back, repeated ones of the same key included
+    uint64_t held = 0;
+    // deliveries made when a held key became due
+    uint64_t fired = 0;
+};
+
+/**
+ * Pacing of the listening types registered with DELIVERY_MODE_LATEST_ONLY or DELIVERY_MODE_PERIODIC. A key, made of
+ * the pacing id of a record, the type and the slot, is delivered at most once per period, updates arriving
+ * in between are held and the key is delivered once more when the period ends. The due keys of every record
+ * sit in one hashed wheel of TICK_MS ticks advanced by a single timer, only the keys are kept and the values
+ * are read from the registry cache when they are delivered.
+ */
+class TelephonyStateRegistryTimerWheel {
+public:
+    using PacedKey = std::tuple<uint64_t, uint32_t, int32_t>;
+
+    static constexpr int64_t TICK_MS = 50;
+    static constexpr size_t SLOT_COUNT = 64;
+
+    TelephonyStateRegistryTimerWheel();
+    ~TelephonyStateRegistryTimerWheel() = default;
+
+    /**
+     * Hold an update of a key if the key was delivered less than a period ago.
+     *
+     * @param key Pacing id of the record, listening type bitmask and slot of the update.
+     * @param periodMs Minimum time between two deliveries of the key, raised to TICK_MS.
+     * @param nowMs Current monotonic time in milliseconds.
+     * @param startTick Out param, true if the wheel was idle and the caller has to start the tick.
+     * @return bool true if the update is held and has to be skipped.
+     */
+    bool Hold(const PacedKey &key, int64_t periodMs, int64_t nowMs, bool &startTick);
+
+    /**
+     * Advance the wheel to the current time.
+     *
+     * @param nowMs Current monotonic time in milliseconds.
+     * @param due Out param, the held keys that are due and have to be delivered now.
+     * @return bool true if keys are still held and the tick has to go on.
+     */
+    bool Advance(int64_t nowMs, std::vector<PacedKey> &due);
+
+    /**
+     * Forget the keys of a record, its timers still in the wheel are dropped when they expire.
+     *
+     * @param pacingId Pacing id of the record.
+     * @param mask Listening types whose keys are forgotten, all of them by default.
+     */
+    void Remove(uint64_t pacingId, uint32_t mask = UINT32_MAX);
+
+    TimerWheelStatistics GetStatistics() const;
+    size_t GetHeldCount() const;
+
+private:
+    struct PacingState {
+        int64_t lastDeliverMs = 0;
+        bool pending = false;
+    };
+
+    struct Timer {
+        int64_t dueTick = 0;
+        PacedKey key;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<std::vector<Timer>> slots_;
+    std::map<PacedKey, PacingState> states_;
+    int64_t currentTick_ = 0;
+    size_t timerCount_ = 0;
+    bool ticking_ = false;
+    TimerWheelStatistics statistics_;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_TIMER_WHEEL_H
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TELEPHONY_STATE_REGISTRY_WAKEUP_H
+#define TELEPHONY_STATE_REGISTRY_WAKEUP_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sys/types.h>
+#include <utility>
+
+namespace OHOS {
+namespace Telephony {
+struct WakeupStatistics {
+    // updates held in a window, repeated ones of the same (type, slot) included
+    uint64_t updates = 0;
+    // (type, slot) keys handed out when the windows were closed
+    uint64_t deliveries = 0;
+};
+
+/**
+ * Wakeup windows of the subscriber processes. An event type with a latency budget does not have to reach
+ * a subscriber right away: its updates are held in a window of the subscriber process that closes when
+ * the most urgent update in it is due, and everything in the window is then delivered in one go. Only the
+ * (type, slot) keys are kept, the values are read from the registry cache when the window closes.
+ */
+class TelephonyStateRegistryWakeup {
+public:
+    using PendingKey = std::pair<uint32_t, int32_t>;
+
+    /**
+     * Set how long updates of a type may wait, 0 means they are delivered right away.
+     */
+    void SetBudget(uint32_t mask, int64_t budgetMs);
+    int64_t GetBudget(uint32_t mask) const;
+    std::map<uint32_t, int64_t> GetBudgets() const;
+
+    /**
+     * Hold an update for a process if its type may wait.
+     *
+     * @param pid Process of the subscriber.
+     * @param mask Listening type bitmask of the update.
+     * @param slotId Indicates the slot identification.
+     * @param nowMs Current monotonic time in milliseconds.
+     * @param closeDelayMs Out param, the delay after which the caller has to call Close for the process,
+     * or 0 if a close already scheduled is early enough.
+     * @return bool true if the update is held and has to be skipped.
+     */
+    bool Hold(pid_t pid, uint32_t mask, int32_t slotId, int64_t nowMs, int64_t &closeDelayMs);
+
+    /**
+     * Close the window of a process if it is due.
+     *
+     * @param pid Process of the subscriber.
+     * @param nowMs Current monotonic time in milliseconds.
+     * @param keys Out param, the keys held in the window.
+     * @return bool false if the process has no window due, e.g. the close was scheduled for an older one.
+     */
+    bool Close(pid_t pid, int64_t nowMs, std::set<PendingKey> &keys);
+
+    std::map<uint32_t, WakeupStatistics> GetStatistics() const;
+    uint64_t GetClosedCount() const;
+
+private:
+    struct Window {
+        int64_t deadlineMs = 0;
+        std::set<PendingKey> keys;
+    };
+
+    mutable std::mutex mutex_;
+    std::map<uint32_t, int64_t> budgets_;
+    std::map<pid_t, Window> windows_;
+    std::map<uint32_t, WakeupStatistics> statistics_;
+    uint64_t closedCount_ = 0;
+};
+} // namespace Telephony
+} // namespace OHOS
+#endif // TELEPHONY_STATE_REGISTRY_WAKEUP_H
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_admission.h"
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+TelephonyStateRegistryAdmission::TelephonyStateRegistryAdmission(uint32_t highWatermark, uint32_t lowWatermark)
+    : highWatermark_(highWatermark), lowWatermark_(lowWatermark < highWatermark ? lowWatermark : highWatermark)
+{}
+
+bool TelephonyStateRegistryAdmission::Enter(uint32_t mask, int32_t slotId, bool coalescible)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (coalescible) {
+        auto it = inFlight_.find(std::make_pair(mask, slotId));
+        if (it != inFlight_.end()) {
+            if (!it->second) {
+                it->second = true;
+                IncreaseQueued(mask);
+            }
+            coalescedCount_++;
+            return false;
+        }
+        inFlight_[std::make_pair(mask, slotId)] = false;
+    }
+    concurrentFanOuts_++;
+    if (concurrentFanOuts_ > maxConcurrentFanOuts_) {
+        maxConcurrentFanOuts_ = concurrentFanOuts_;
+    }
+    return true;
+}
+
+bool TelephonyStateRegistryAdmission::Leave(uint32_t mask, int32_t slotId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = inFlight_.find(std::make_pair(mask, slotId));
+    if (it != inFlight_.end()) {
+        if (it->second) {
+            it->second = false;
+            DecreaseQueued();
+            return true;
+        }
+        inFlight_.erase(it);
+    }
+    if (concurrentFanOuts_ > 0) {
+        concurrentFanOuts_--;
+    }
+    return false;
+}
+
+void TelephonyStateRegistryAdmission::AddQueued()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    IncreaseQueued(0);
+}
+
+void TelephonyStateRegistryAdmission::RemoveQueued()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecreaseQueued();
+}
+
+void TelephonyStateRegistryAdmission::IncreaseQueued(uint32_t mask)
+{
+    queued_++;
+    if (queued_ > maxQueued_) {
+        maxQueued_ = queued_;
+    }
+    if (!throttled_ && queued_ >= highWatermark_) {
+        throttled_ = true;
+        highWatermarkHits_++;
+        TELEPHONY_LOGW("queued deliveries %{public}u reached high watermark, mask = %{public}u", queued_, mask);
+    }
+}
+
+void TelephonyStateRegistryAdmission::DecreaseQueued()
+{
+    if (queued_ > 0) {
+        queued_--;
+    }
+    if (throttled_ && queued_ <= lowWatermark_) {
+        throttled_ = false;
+        TELEPHONY_LOGI("queued deliveries %{public}u back to low watermark", queued_);
+    }
+}
+
+bool TelephonyStateRegistryAdmission::CheckBackpressure()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (throttled_) {
+        throttledCount_++;
+    }
+    return throttled_;
+}
+
+bool TelephonyStateRegistryAdmission::IsThrottled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return throttled_;
+}
+
+uint32_t TelephonyStateRegistryAdmission::GetConcurrentFanOuts() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return concurrentFanOuts_;
+}
+
+uint32_t TelephonyStateRegistryAdmission::GetMaxConcurrentFanOuts() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxConcurrentFanOuts_;
+}
+
+uint32_t TelephonyStateRegistryAdmission::GetQueued() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queued_;
+}
+
+uint32_t TelephonyStateRegistryAdmission::GetMaxQueued() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return maxQueued_;
+}
+
+uint64_t TelephonyStateRegistryAdmission::GetHighWatermarkHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return highWatermarkHits_;
+}
+
+uint64_t TelephonyStateRegistryAdmission::GetCoalescedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return coalescedCount_;
+}
+
+uint64_t TelephonyStateRegistryAdmission::GetThrottledCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return throttledCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
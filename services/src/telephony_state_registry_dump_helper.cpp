@@ -15,6 +15,10 @@
 
 #include "telephony_state_registry_dump_helper.h"
 
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
 #include "core_service_client.h"
 #include "telephony_types.h"
 #include "enum_convert.h"
@@ -26,6 +30,17 @@ bool TelephonyStateRegistryDumpHelper::Dump(const std::vector<std::string> &args
 {
     result.clear();
     ShowTelephonyChangeState(result);
+    ShowTelephonyStartupInfo(result);
+    ShowTelephonyAdmissionInfo(result);
+    ShowTelephonyLimiterInfo(result);
+    ShowTelephonyWakeupInfo(result);
+    ShowTelephonySignalStatisticsInfo(result);
+    ShowTelephonyTimerWheelInfo(result);
+    ShowTelephonyInterestInfo(result);
+    ShowTelephonyProcessStateInfo(result);
+    ShowTelephonyMemoryInfo(result);
+    ShowTelephonyQuotaInfo(result);
+    ShowTelephonyIdentityCacheInfo(result);
     return ShowTelephonyStateRegistryInfo(stateRecords, result);
 }
 
@@ -64,7 +79,7 @@ bool TelephonyStateRegistryDumpHelper::ShowTelephonyStateRegistryInfo(
                 result.append("Unknown Subscriber: ");
             }
             result.append("\n").append("    { ");
-            result.append("package: ").append(item.bundleName_);
+            result.append("package: ").append(item.GetBundleName());
             result.append(" pid: ").append(std::to_string(item.pid_));
             result.append(" mask: ").append(std::to_string(item.mask_));
             result.append(" slotId: ").append(std::to_string(item.slotId_));
@@ -95,6 +110,9 @@ void TelephonyStateRegistryDumpHelper::ShowTelephonyChangeState(std::string &res
     result.append("TelephonyStateRegistry ServiceRunningState = ");
     result.append(std::to_string(service->GetServiceRunningState()));
     result.append("\n");
+    result.append("TelephonyStateRegistry DefaultDataSlotId = ");
+    result.append(std::to_string(service->GetDefaultDataSlotId()));
+    result.append("\n");
     for (int32_t i = 0; i < SIM_SLOT_COUNT; i++) {
         int32_t slot = i >= SIM_SLOT_2 ? i + 1 : i;
         if (WhetherHasSimCard(slot)) {
@@ -125,5 +143,297 @@ void TelephonyStateRegistryDumpHelper::ShowTelephonyChangeState(std::string &res
         }
     }
 }
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyStartupInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    for (const auto &phase : service->GetStartupTimeline()) {
+        result.append("TelephonyStateRegistry Startup phase = ");
+        result.append(phase.name);
+        result.append(" elapsedMs: ");
+        result.append(std::to_string(phase.elapsedMs));
+        result.append("\n");
+    }
+    const TelephonyStateRegistryEventBuffer &eventBuffer = service->GetEventBuffer();
+    result.append("TelephonyStateRegistry CommonEvent ready = ");
+    result.append(std::to_string(eventBuffer.IsReady()));
+    result.append(" pending: ");
+    result.append(std::to_string(eventBuffer.GetPendingCount()));
+    result.append(" flushed: ");
+    result.append(std::to_string(eventBuffer.GetFlushedCount()));
+    result.append(" dropped: ");
+    result.append(std::to_string(eventBuffer.GetDroppedCount()));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyAdmissionInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryAdmission &admission = service->GetAdmission();
+    result.append("TelephonyStateRegistry ConcurrentFanOuts = ");
+    result.append(std::to_string(admission.GetConcurrentFanOuts()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry MaxConcurrentFanOuts = ");
+    result.append(std::to_string(admission.GetMaxConcurrentFanOuts()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry QueuedDeliveries = ");
+    result.append(std::to_string(admission.GetQueued()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry MaxQueuedDeliveries = ");
+    result.append(std::to_string(admission.GetMaxQueued()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry Throttled = ");
+    result.append(std::to_string(admission.IsThrottled()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry HighWatermarkHits = ");
+    result.append(std::to_string(admission.GetHighWatermarkHits()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry CoalescedUpdates = ");
+    result.append(std::to_string(admission.GetCoalescedCount()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry ThrottledReplies = ");
+    result.append(std::to_string(admission.GetThrottledCount()));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyLimiterInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryLimiter &limiter = service->GetLimiter();
+    for (const auto &item : limiter.GetStatistics()) {
+        LimiterConfig config;
+        limiter.GetConfig(item.first, config);
+        result.append("TelephonyStateRegistry Limiter mask = ").append(std::to_string(item.first));
+        result.append(" enabled: ").append(config.IsEnabled() ? "true" : "false");
+        result.append(" debounceMs: ").append(std::to_string(config.debounceMs));
+        result.append(" burst: ").append(std::to_string(config.burst));
+        result.append(" refill: ").append(std::to_string(config.refillPerSecond));
+        result.append(" delivered: ").append(std::to_string(item.second.delivered));
+        result.append(" deferred: ").append(std::to_string(item.second.deferred));
+        result.append(" trailing: ").append(std::to_string(item.second.trailing));
+        result.append(" dropped: ").append(std::to_string(item.second.dropped));
+        result.append(" forced: ").append(std::to_string(item.second.forced));
+        result.append("\n");
+    }
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyWakeupInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryWakeup &wakeup = service->GetWakeup();
+    std::map<uint32_t, WakeupStatistics> statistics = wakeup.GetStatistics();
+    uint64_t deliveries = 0;
+    for (const auto &item : wakeup.GetBudgets()) {
+        const WakeupStatistics &stat = statistics[item.first];
+        deliveries += stat.deliveries;
+        std::ostringstream factor;
+        factor << std::fixed << std::setprecision(2) <<
+            (stat.deliveries == 0 ? 0.0 : static_cast<double>(stat.updates) / stat.deliveries);
+        result.append("TelephonyStateRegistry Wakeup mask = ").append(std::to_string(item.first));
+        result.append(" budgetMs: ").append(std::to_string(item.second));
+        result.append(" updates: ").append(std::to_string(stat.updates));
+        result.append(" deliveries: ").append(std::to_string(stat.deliveries));
+        result.append(" updatesPerDelivery: ").append(factor.str());
+        result.append("\n");
+    }
+    uint64_t windows = wakeup.GetClosedCount();
+    std::ostringstream factor;
+    factor << std::fixed << std::setprecision(2) <<
+        (windows == 0 ? 0.0 : static_cast<double>(deliveries) / windows);
+    result.append("TelephonyStateRegistry Wakeup windows = ").append(std::to_string(windows));
+    result.append(" deliveriesPerWindow: ").append(factor.str());
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonySignalStatisticsInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    for (const auto &slot : service->GetSignalStatistics().GetAll(nowMs)) {
+        for (const auto &item : slot.second) {
+            std::ostringstream average;
+            average << std::fixed << std::setprecision(1) << item.averageDbm;
+            result.append("TelephonyStateRegistry SignalStatistics slotId = ").append(std::to_string(slot.first));
+            result.append(" networkType: ").append(std::to_string(item.networkType));
+            result.append(" samples: ").append(std::to_string(item.samples));
+            result.append(" averageDbm: ").append(average.str());
+            result.append(" windowDbm: ").append(std::to_string(item.windowMinDbm)).append("~");
+            result.append(std::to_string(item.windowMaxDbm));
+            result.append(" p10/p50/p90: ").append(std::to_string(item.lowDbm)).append("/");
+            result.append(std::to_string(item.medianDbm)).append("/").append(std::to_string(item.highDbm));
+            result.append(" levelMs:");
+            for (int64_t duration : item.levelDurationMs) {
+                result.append(" ").append(std::to_string(duration));
+            }
+            result.append("\n");
+        }
+    }
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyTimerWheelInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryTimerWheel &timerWheel = service->GetTimerWheel();
+    TimerWheelStatistics statistics = timerWheel.GetStatistics();
+    result.append("TelephonyStateRegistry Pacing held = ").append(std::to_string(timerWheel.GetHeldCount()));
+    result.append(" immediate: ").append(std::to_string(statistics.immediate));
+    result.append(" coalesced: ").append(std::to_string(statistics.held));
+    result.append(" fired: ").append(std::to_string(statistics.fired));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyInterestInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryInterest &interest = service->GetInterest();
+    result.append("TelephonyStateRegistry Interest observers = ").append(std::to_string(interest.GetObserverCount()));
+    result.append(" watched mask: ").append(std::to_string(interest.GetWatchedMask()));
+    result.append(" advertised: ").append(std::to_string(interest.GetAdvertisedCount()));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyProcessStateInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryProcessState &processState = service->GetProcessState();
+    result.append("TelephonyStateRegistry DeferredProcesses = ");
+    result.append(std::to_string(processState.GetDeferredProcessCount()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry DeferredUpdates = ");
+    result.append(std::to_string(processState.GetDeferredCount()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry FlushedUpdates = ");
+    result.append(std::to_string(processState.GetFlushedCount()));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyIdentityCacheInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryIdentityCache &identityCache = service->GetIdentityCache();
+    result.append("TelephonyStateRegistry IdentityCacheEnabled = ");
+    result.append(std::to_string(identityCache.IsEnabled()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry IdentityCacheSize = ");
+    result.append(std::to_string(identityCache.GetSize()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry IdentityCacheHits = ");
+    result.append(std::to_string(identityCache.GetHitCount()));
+    result.append("\n");
+    result.append("TelephonyStateRegistry IdentityCacheMisses = ");
+    result.append(std::to_string(identityCache.GetMissCount()));
+    result.append("\n");
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyMemoryInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryMemory &memory = service->GetMemory();
+    result.append("TelephonyStateRegistry MemoryBytes = ");
+    result.append(std::to_string(memory.GetTotalBytes()));
+    result.append(" highWatermark: ");
+    result.append(std::to_string(memory.GetTotalHighWatermark()));
+    result.append("\n");
+    for (uint32_t i = 0; i < static_cast<uint32_t>(MemoryCategory::CATEGORY_COUNT); i++) {
+        MemoryCategory category = static_cast<MemoryCategory>(i);
+        MemoryUsage usage = memory.GetUsage(category);
+        result.append("TelephonyStateRegistry Memory category = ");
+        result.append(TelephonyStateRegistryMemory::GetCategoryName(category));
+        result.append(" bytes: ");
+        result.append(std::to_string(usage.bytes));
+        result.append(" highWatermark: ");
+        result.append(std::to_string(usage.highWatermark));
+        result.append("\n");
+    }
+    for (const auto &bundle : memory.GetBundleUsage()) {
+        result.append("TelephonyStateRegistry Memory bundle = ");
+        result.append(bundle.first);
+        result.append(" records: ");
+        result.append(std::to_string(bundle.second.records));
+        result.append(" recordBytes: ");
+        result.append(std::to_string(bundle.second.recordBytes));
+        result.append(" queuedBytes: ");
+        result.append(std::to_string(bundle.second.queuedBytes));
+        result.append("\n");
+    }
+}
+
+void TelephonyStateRegistryDumpHelper::ShowTelephonyQuotaInfo(std::string &result) const
+{
+    std::shared_ptr<TelephonyStateRegistryService> service =
+        DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    if (service == nullptr) {
+        TELEPHONY_LOGE("Get state registry service failed");
+        return;
+    }
+    const TelephonyStateRegistryQuota &quota = service->GetQuota();
+    result.append("TelephonyStateRegistry Quota uidLimit = ");
+    result.append(std::to_string(quota.GetUidLimit()));
+    result.append(" pidLimit: ");
+    result.append(std::to_string(quota.GetPidLimit()));
+    result.append("\n");
+    for (const auto &usage : quota.GetUidUsage()) {
+        result.append("TelephonyStateRegistry Quota bundle = ");
+        result.append(usage.second.bundleName);
+        result.append(" uid: ");
+        result.append(std::to_string(usage.first));
+        result.append(" records: ");
+        result.append(std::to_string(usage.second.records));
+        result.append(" rejected: ");
+        result.append(std::to_string(usage.second.rejected));
+        result.append("\n");
+    }
+}
 } // namespace Telephony
 } // namespace OHOS
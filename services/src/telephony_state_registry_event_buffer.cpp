@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_event_buffer.h"
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+TelephonyStateRegistryEventBuffer::TelephonyStateRegistryEventBuffer(size_t capacity, const Publisher &publisher)
+    : capacity_(capacity), publisher_(publisher)
+{}
+
+void TelephonyStateRegistryEventBuffer::Watch()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    watched_ = true;
+}
+
+bool TelephonyStateRegistryEventBuffer::Publish(
+    const EventFwk::CommonEventData &data, const EventFwk::CommonEventPublishInfo &info)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (watched_ && !ready_) {
+            if (capacity_ == 0) {
+                droppedCount_++;
+                return true;
+            }
+            if (pending_.size() >= capacity_) {
+                TELEPHONY_LOGW("common event buffer full, drop %{public}s",
+                    pending_.front().data.GetWant().GetAction().c_str());
+                pending_.pop_front();
+                droppedCount_++;
+            }
+            pending_.push_back({ data, info });
+            return true;
+        }
+    }
+    return publisher_ != nullptr && publisher_(data, info);
+}
+
+void TelephonyStateRegistryEventBuffer::SetReady(bool ready)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!ready) {
+        ready_ = false;
+        return;
+    }
+    // ready_ only turns true once nothing is kept, so events sent meanwhile can not overtake older ones
+    while (!pending_.empty()) {
+        std::deque<PendingEvent> pending;
+        pending.swap(pending_);
+        lock.unlock();
+        for (const auto &event : pending) {
+            if (publisher_ != nullptr && !publisher_(event.data, event.info)) {
+                TELEPHONY_LOGE("publish kept common event %{public}s failed",
+                    event.data.GetWant().GetAction().c_str());
+            }
+        }
+        lock.lock();
+        flushedCount_ += pending.size();
+    }
+    ready_ = true;
+    TELEPHONY_LOGI("common event service ready, %{public}llu events flushed",
+        static_cast<unsigned long long>(flushedCount_));
+}
+
+bool TelephonyStateRegistryEventBuffer::IsReady() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ready_;
+}
+
+size_t TelephonyStateRegistryEventBuffer::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+uint64_t TelephonyStateRegistryEventBuffer::GetDroppedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return droppedCount_;
+}
+
+uint64_t TelephonyStateRegistryEventBuffer::GetFlushedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flushedCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
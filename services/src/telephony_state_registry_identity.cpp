@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_identity.h"
+
+namespace OHOS {
+namespace Telephony {
+std::shared_ptr<const TelephonyStateRegistryIdentity> TelephonyStateRegistryIdentityPool::Intern(pid_t pid,
+    int32_t uid, int32_t tokenId, const std::string &bundleName, const std::string &appIdentifier)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    IdentityKey key = std::make_pair(pid, tokenId);
+    auto it = identities_.find(key);
+    if (it != identities_.end()) {
+        auto identity = it->second.lock();
+        // a pid may be reused by another process after the previous one died
+        if (identity != nullptr && identity->uid == uid && identity->bundleName == bundleName &&
+            identity->appIdentifier == appIdentifier) {
+            return identity;
+        }
+    }
+    for (auto iter = identities_.begin(); iter != identities_.end();) {
+        if (iter->second.expired()) {
+            iter = identities_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    auto identity = std::make_shared<TelephonyStateRegistryIdentity>();
+    identity->bundleName = bundleName;
+    identity->appIdentifier = appIdentifier;
+    identity->uid = uid;
+    identity->pid = pid;
+    identity->tokenId = tokenId;
+    identities_[key] = identity;
+    return identity;
+}
+
+size_t TelephonyStateRegistryIdentityPool::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t size = 0;
+    for (const auto &item : identities_) {
+        if (!item.second.expired()) {
+            size++;
+        }
+    }
+    return size;
+}
+
+void TelephonyStateRegistryIdentityCache::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    if (!enabled) {
+        entries_.clear();
+        generation_++;
+    }
+}
+
+bool TelephonyStateRegistryIdentityCache::IsEnabled() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+}
+
+bool TelephonyStateRegistryIdentityCache::Lookup(int32_t uid, int32_t tokenId, std::string &bundleName,
+    std::string &appIdentifier, uint64_t &generation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation = generation_;
+    if (!enabled_) {
+        return false;
+    }
+    auto it = entries_.find(std::make_pair(uid, tokenId));
+    if (it == entries_.end()) {
+        missCount_++;
+        return false;
+    }
+    bundleName = it->second.first;
+    appIdentifier = it->second.second;
+    hitCount_++;
+    return true;
+}
+
+void TelephonyStateRegistryIdentityCache::Insert(int32_t uid, int32_t tokenId, const std::string &bundleName,
+    const std::string &appIdentifier, uint64_t generation)
+{
+    // an empty bundle name means the query failed, so it is retried on the next registration
+    if (bundleName.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!enabled_ || generation != generation_) {
+        return;
+    }
+    if (entries_.size() >= MAX_CACHED_IDENTITY && entries_.find(std::make_pair(uid, tokenId)) == entries_.end()) {
+        entries_.erase(entries_.begin());
+    }
+    entries_[std::make_pair(uid, tokenId)] = std::make_pair(bundleName, appIdentifier);
+}
+
+void TelephonyStateRegistryIdentityCache::Invalidate(const std::string &bundleName, int32_t uid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    generation_++;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->first.first == uid || (!bundleName.empty() && it->second.first == bundleName)) {
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+size_t TelephonyStateRegistryIdentityCache::GetSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+uint64_t TelephonyStateRegistryIdentityCache::GetHitCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hitCount_;
+}
+
+uint64_t TelephonyStateRegistryIdentityCache::GetMissCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return missCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "telephony_state_registry_interest.h"
+
+#include <algorithm>
+#include <set>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+void TelephonyStateRegistryInterest::AddSubscriber(
+    TelephonyObserverInterest &interest, const TelephonyObserverOptions &options)
+{
+    DeliveryPolicy policy = options.GetDeliveryPolicy(interest.mask);
+    uint32_t periodMs = policy.mode == DELIVERY_MODE_PERIODIC ? policy.periodMs : 0;
+    interest.minPeriodMs = interest.subscribers == 0 ? periodMs : std::min(interest.minPeriodMs, periodMs);
+    interest.subscribers++;
+}
+
+void TelephonyStateRegistryInterest::AddObserver(const sptr<TelephonyObserverBroker> &observer, uint32_t mask)
+{
+    if (observer == nullptr || observer->AsObject() == nullptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    InterestObserver &interestObserver = observers_[observer->AsObject()];
+    interestObserver.observer = observer;
+    interestObserver.mask = mask;
+    interestObserver.initial = true;
+    TELEPHONY_LOGI("interest observer added, mask = %{public}u count = %{public}zu", mask, observers_.size());
+}
+
+bool TelephonyStateRegistryInterest::RemoveObserver(const sptr<IRemoteObject> &remote)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return observers_.erase(remote) != 0;
+}
+
+uint32_t TelephonyStateRegistryInterest::GetWatchedMask() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint32_t mask = 0;
+    for (const auto &[remote, interestObserver] : observers_) {
+        mask |= interestObserver.mask;
+    }
+    return mask;
+}
+
+void TelephonyStateRegistryInterest::Update(const InterestMap &current, std::vector<Notification> &notifications)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::set<InterestKey> changed;
+    for (const auto &[key, interest] : current) {
+        auto it = advertised_.find(key);
+        if (it == advertised_.end() || !(it->second == interest)) {
+            changed.insert(key);
+        }
+    }
+    advertised_ = current;
+    for (auto it = observers_.begin(); it != observers_.end();) {
+        InterestObserver &interestObserver = it->second;
+        if (it->first->IsObjectDead()) {
+            it = observers_.erase(it);
+            continue;
+        }
+        std::vector<TelephonyObserverInterest> interests;
+        for (const auto &[key, interest] : current) {
+            if ((key.first & interestObserver.mask) == 0) {
+                continue;
+            }
+            if (interestObserver.initial || changed.count(key) != 0) {
+                interests.push_back(interest);
+            }
+        }
+        interestObserver.initial = false;
+        if (!interests.empty()) {
+            advertisedCount_ += interests.size();
+            notifications.emplace_back(interestObserver.observer, std::move(interests));
+        }
+        ++it;
+    }
+}
+
+size_t TelephonyStateRegistryInterest::GetObserverCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return observers_.size();
+}
+
+uint64_t TelephonyStateRegistryInterest::GetAdvertisedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return advertisedCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
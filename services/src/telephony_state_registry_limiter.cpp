@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_limiter.h"
+
+#include <algorithm>
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+constexpr int64_t MS_PER_SECOND = 1000;
+constexpr int64_t MIN_TRAILING_DELAY_MS = 1;
+} // namespace
+
+void TelephonyStateRegistryLimiter::SetConfig(uint32_t mask, const LimiterConfig &config)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    configs_[mask] = config;
+    statistics_[mask];
+    TELEPHONY_LOGI("limiter mask = %{public}u debounceMs = %{public}lld burst = %{public}u refill = %{public}u",
+        mask, static_cast<long long>(config.debounceMs), config.burst, config.refillPerSecond);
+}
+
+bool TelephonyStateRegistryLimiter::GetConfig(uint32_t mask, LimiterConfig &config) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = configs_.find(mask);
+    if (it == configs_.end()) {
+        return false;
+    }
+    config = it->second;
+    return true;
+}
+
+void TelephonyStateRegistryLimiter::Refill(const LimiterConfig &config, BucketState &state, int64_t nowMs) const
+{
+    if (nowMs <= state.lastRefillMs) {
+        return;
+    }
+    double refill = static_cast<double>(nowMs - state.lastRefillMs) * config.refillPerSecond / MS_PER_SECOND;
+    state.tokens = std::min(static_cast<double>(config.burst), state.tokens + refill);
+    state.lastRefillMs = nowMs;
+}
+
+bool TelephonyStateRegistryLimiter::TakeToken(BucketState &state) const
+{
+    if (state.tokens < 1) {
+        return false;
+    }
+    state.tokens -= 1;
+    return true;
+}
+
+LimiterDecision TelephonyStateRegistryLimiter::Admit(
+    uint32_t mask, int32_t slotId, bool changed, int64_t nowMs, int64_t &delayMs)
+{
+    delayMs = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto configIt = configs_.find(mask);
+    if (configIt == configs_.end()) {
+        return LimiterDecision::DELIVER;
+    }
+    const LimiterConfig &config = configIt->second;
+    LimiterStatistics &statistics = statistics_[mask];
+    auto key = std::make_pair(mask, slotId);
+    auto stateIt = states_.find(key);
+    if (stateIt == states_.end()) {
+        BucketState initState;
+        initState.tokens = config.burst;
+        initState.lastRefillMs = nowMs;
+        stateIt = states_.emplace(key, initState).first;
+    }
+    BucketState &state = stateIt->second;
+    Refill(config, state, nowMs);
+    bool unlimited = config.burst == 0;
+    bool inWindow = state.delivered && (nowMs - state.lastDeliverMs < config.debounceMs);
+    if (config.coalescible) {
+        if (state.trailingPending) {
+            statistics.deferred++;
+            return LimiterDecision::DEFER;
+        }
+        if (!inWindow && (unlimited || TakeToken(state))) {
+            state.lastDeliverMs = nowMs;
+            state.delivered = true;
+            statistics.delivered++;
+            return LimiterDecision::DELIVER;
+        }
+        int64_t windowDelay = inWindow ? config.debounceMs - (nowMs - state.lastDeliverMs) : 0;
+        int64_t tokenDelay = 0;
+        if (!unlimited && state.tokens < 1) {
+            tokenDelay = config.refillPerSecond == 0 ?
+                config.debounceMs :
+                static_cast<int64_t>((1 - state.tokens) * MS_PER_SECOND / config.refillPerSecond) + 1;
+        }
+        state.trailingPending = true;
+        delayMs = std::max({ windowDelay, tokenDelay, MIN_TRAILING_DELAY_MS });
+        statistics.deferred++;
+        return LimiterDecision::DEFER;
+    }
+    if (changed) {
+        if (!unlimited && !TakeToken(state)) {
+            statistics.forced++;
+        }
+        state.lastDeliverMs = nowMs;
+        state.delivered = true;
+        statistics.delivered++;
+        return LimiterDecision::DELIVER;
+    }
+    if (inWindow || (!unlimited && !TakeToken(state))) {
+        statistics.dropped++;
+        return LimiterDecision::DROP;
+    }
+    state.lastDeliverMs = nowMs;
+    state.delivered = true;
+    statistics.delivered++;
+    return LimiterDecision::DELIVER;
+}
+
+void TelephonyStateRegistryLimiter::OnTrailing(uint32_t mask, int32_t slotId, int64_t nowMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto configIt = configs_.find(mask);
+    auto stateIt = states_.find(std::make_pair(mask, slotId));
+    if (configIt == configs_.end() || stateIt == states_.end()) {
+        return;
+    }
+    BucketState &state = stateIt->second;
+    Refill(configIt->second, state, nowMs);
+    TakeToken(state);
+    state.trailingPending = false;
+    state.lastDeliverMs = nowMs;
+    state.delivered = true;
+    statistics_[mask].trailing++;
+}
+
+std::map<uint32_t, LimiterStatistics> TelephonyStateRegistryLimiter::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_memory.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+const char *const CATEGORY_NAMES[] = { "records", "signalCache", "cellCache", "networkCache", "queued",
+    "extCopies" };
+} // namespace
+
+void TelephonyStateRegistryMemory::AddLocked(MemoryCategory category, uint64_t bytes)
+{
+    if (category >= MemoryCategory::CATEGORY_COUNT) {
+        return;
+    }
+    MemoryUsage &usage = usage_[static_cast<uint32_t>(category)];
+    usage.bytes += bytes;
+    if (usage.bytes > usage.highWatermark) {
+        usage.highWatermark = usage.bytes;
+    }
+    totalBytes_ += bytes;
+    if (totalBytes_ > totalHighWatermark_) {
+        totalHighWatermark_ = totalBytes_;
+    }
+}
+
+void TelephonyStateRegistryMemory::SubLocked(MemoryCategory category, uint64_t bytes)
+{
+    if (category >= MemoryCategory::CATEGORY_COUNT) {
+        return;
+    }
+    MemoryUsage &usage = usage_[static_cast<uint32_t>(category)];
+    uint64_t released = bytes < usage.bytes ? bytes : usage.bytes;
+    usage.bytes -= released;
+    totalBytes_ -= released;
+}
+
+void TelephonyStateRegistryMemory::Add(MemoryCategory category, uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddLocked(category, bytes);
+}
+
+void TelephonyStateRegistryMemory::Sub(MemoryCategory category, uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubLocked(category, bytes);
+}
+
+void TelephonyStateRegistryMemory::Replace(MemoryCategory category, uint64_t oldBytes, uint64_t newBytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubLocked(category, oldBytes);
+    AddLocked(category, newBytes);
+}
+
+void TelephonyStateRegistryMemory::AddRecord(const std::string &bundleName, uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddLocked(MemoryCategory::RECORDS, bytes);
+    BundleMemoryUsage &usage = bundles_[bundleName];
+    usage.records++;
+    usage.recordBytes += bytes;
+}
+
+void TelephonyStateRegistryMemory::RemoveRecord(const std::string &bundleName, uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubLocked(MemoryCategory::RECORDS, bytes);
+    auto it = bundles_.find(bundleName);
+    if (it == bundles_.end()) {
+        return;
+    }
+    if (it->second.records <= 1) {
+        bundles_.erase(it);
+        return;
+    }
+    it->second.records--;
+    it->second.recordBytes -= bytes < it->second.recordBytes ? bytes : it->second.recordBytes;
+}
+
+void TelephonyStateRegistryMemory::ResizeRecord(const std::string &bundleName, uint64_t oldBytes, uint64_t newBytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    SubLocked(MemoryCategory::RECORDS, oldBytes);
+    AddLocked(MemoryCategory::RECORDS, newBytes);
+    auto it = bundles_.find(bundleName);
+    if (it == bundles_.end()) {
+        return;
+    }
+    it->second.recordBytes -= oldBytes < it->second.recordBytes ? oldBytes : it->second.recordBytes;
+    it->second.recordBytes += newBytes;
+}
+
+void TelephonyStateRegistryMemory::AddQueued(pid_t pid, const std::string &bundleName, uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddLocked(MemoryCategory::QUEUED, bytes);
+    auto &queued = queued_[pid];
+    queued.first = bundleName;
+    queued.second += bytes;
+}
+
+void TelephonyStateRegistryMemory::ClearQueued(pid_t pid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = queued_.find(pid);
+    if (it == queued_.end()) {
+        return;
+    }
+    SubLocked(MemoryCategory::QUEUED, it->second.second);
+    queued_.erase(it);
+}
+
+MemoryUsage TelephonyStateRegistryMemory::GetUsage(MemoryCategory category) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (category >= MemoryCategory::CATEGORY_COUNT) {
+        return MemoryUsage();
+    }
+    return usage_[static_cast<uint32_t>(category)];
+}
+
+uint64_t TelephonyStateRegistryMemory::GetTotalBytes() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totalBytes_;
+}
+
+uint64_t TelephonyStateRegistryMemory::GetTotalHighWatermark() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return totalHighWatermark_;
+}
+
+std::map<std::string, BundleMemoryUsage> TelephonyStateRegistryMemory::GetBundleUsage() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<std::string, BundleMemoryUsage> bundles = bundles_;
+    for (const auto &queued : queued_) {
+        bundles[queued.second.first].queuedBytes += queued.second.second;
+    }
+    return bundles;
+}
+
+const char *TelephonyStateRegistryMemory::GetCategoryName(MemoryCategory category)
+{
+    if (category >= MemoryCategory::CATEGORY_COUNT) {
+        return "unknown";
+    }
+    return CATEGORY_NAMES[static_cast<uint32_t>(category)];
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_package_change.h"
+
+#include "common_event_manager.h"
+#include "common_event_support.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace OHOS::EventFwk;
+namespace {
+constexpr const char *PACKAGE_UID_KEY = "uid";
+constexpr int32_t INVALID_UID = -1;
+
+class PackageChangeSubscriber : public CommonEventSubscriber {
+public:
+    PackageChangeSubscriber(const CommonEventSubscribeInfo &info, const PackageChangeSource::Callback &callback)
+        : CommonEventSubscriber(info), callback_(callback)
+    {}
+
+    void OnReceiveEvent(const CommonEventData &data) override
+    {
+        const AAFwk::Want &want = data.GetWant();
+        std::string bundleName = want.GetElement().GetBundleName();
+        int32_t uid = want.GetIntParam(PACKAGE_UID_KEY, INVALID_UID);
+        TELEPHONY_LOGD("package %{public}s changed, action %{public}s", bundleName.c_str(),
+            want.GetAction().c_str());
+        if (callback_ != nullptr) {
+            callback_(bundleName, uid);
+        }
+    }
+
+private:
+    PackageChangeSource::Callback callback_ = nullptr;
+};
+} // namespace
+
+bool CommonEventPackageChangeSource::Start(const Callback &callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (subscriber_ != nullptr) {
+        return true;
+    }
+    MatchingSkills matchingSkills;
+    matchingSkills.AddEvent(CommonEventSupport::COMMON_EVENT_PACKAGE_CHANGED);
+    matchingSkills.AddEvent(CommonEventSupport::COMMON_EVENT_PACKAGE_REPLACED);
+    matchingSkills.AddEvent(CommonEventSupport::COMMON_EVENT_PACKAGE_REMOVED);
+    CommonEventSubscribeInfo subscribeInfo(matchingSkills);
+    auto subscriber = std::make_shared<PackageChangeSubscriber>(subscribeInfo, callback);
+    if (!CommonEventManager::SubscribeCommonEvent(subscriber)) {
+        TELEPHONY_LOGE("subscribe package change event failed");
+        return false;
+    }
+    subscriber_ = subscriber;
+    return true;
+}
+
+void CommonEventPackageChangeSource::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (subscriber_ == nullptr) {
+        return;
+    }
+    CommonEventManager::UnSubscribeCommonEvent(subscriber_);
+    subscriber_ = nullptr;
+}
+
+bool LocalPackageChangeSource::Start(const Callback &callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback_ = callback;
+    return true;
+}
+
+void LocalPackageChangeSource::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback_ = nullptr;
+}
+
+void LocalPackageChangeSource::NotifyChanged(const std::string &bundleName, int32_t uid)
+{
+    Callback callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = callback_;
+    }
+    if (callback != nullptr) {
+        callback(bundleName, uid);
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_process_state.h"
+
+#include "telephony_ext_wrapper.h"
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+bool ExtProcessStateSource::Start(const Callback &callback)
+{
+    if (TELEPHONY_EXT_WRAPPER.registerProcessStateCallback_ == nullptr) {
+        return false;
+    }
+    TELEPHONY_EXT_WRAPPER.registerProcessStateCallback_(callback);
+    return true;
+}
+
+void ExtProcessStateSource::Stop()
+{
+    if (TELEPHONY_EXT_WRAPPER.unregisterProcessStateCallback_ != nullptr) {
+        TELEPHONY_EXT_WRAPPER.unregisterProcessStateCallback_();
+    }
+}
+
+bool LocalProcessStateSource::Start(const Callback &callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback_ = callback;
+    return true;
+}
+
+void LocalProcessStateSource::Stop()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    callback_ = nullptr;
+}
+
+void LocalProcessStateSource::SetDeferred(pid_t pid, bool deferred)
+{
+    Callback callback = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback = callback_;
+    }
+    if (callback != nullptr) {
+        callback(pid, deferred);
+    }
+}
+
+bool TelephonyStateRegistryProcessState::IsDeferred(pid_t pid) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return deferred_.find(pid) != deferred_.end();
+}
+
+bool TelephonyStateRegistryProcessState::Defer(pid_t pid, uint32_t mask, int32_t slotId)
+{
+    bool added = false;
+    return Defer(pid, mask, slotId, added);
+}
+
+bool TelephonyStateRegistryProcessState::Defer(pid_t pid, uint32_t mask, int32_t slotId, bool &added)
+{
+    added = false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = deferred_.find(pid);
+    if (it == deferred_.end()) {
+        return false;
+    }
+    added = it->second.insert(std::make_pair(mask, slotId)).second;
+    deferredCount_++;
+    return true;
+}
+
+void TelephonyStateRegistryProcessState::SetDeferred(pid_t pid, bool deferred, std::set<PendingKey> &pending)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = deferred_.find(pid);
+    if (deferred) {
+        if (it == deferred_.end()) {
+            deferred_[pid];
+            TELEPHONY_LOGI("process %{public}d deferred", pid);
+        }
+        return;
+    }
+    if (it == deferred_.end()) {
+        return;
+    }
+    pending.swap(it->second);
+    deferred_.erase(it);
+    flushedCount_ += pending.size();
+    TELEPHONY_LOGI("process %{public}d active, %{public}zu pending updates", pid, pending.size());
+}
+
+uint32_t TelephonyStateRegistryProcessState::GetDeferredProcessCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<uint32_t>(deferred_.size());
+}
+
+uint64_t TelephonyStateRegistryProcessState::GetDeferredCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return deferredCount_;
+}
+
+uint64_t TelephonyStateRegistryProcessState::GetFlushedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flushedCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
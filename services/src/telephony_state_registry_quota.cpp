@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_quota.h"
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+TelephonyStateRegistryQuota::TelephonyStateRegistryQuota(uint32_t uidLimit, uint32_t pidLimit)
+    : uidLimit_(uidLimit), pidLimit_(pidLimit)
+{}
+
+void TelephonyStateRegistryQuota::SetLimits(uint32_t uidLimit, uint32_t pidLimit)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    uidLimit_ = uidLimit;
+    pidLimit_ = pidLimit;
+    TELEPHONY_LOGI("quota uidLimit = %{public}u pidLimit = %{public}u", uidLimit, pidLimit);
+}
+
+uint32_t TelephonyStateRegistryQuota::GetUidLimit() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uidLimit_;
+}
+
+uint32_t TelephonyStateRegistryQuota::GetPidLimit() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pidLimit_;
+}
+
+bool TelephonyStateRegistryQuota::Acquire(int32_t uid, pid_t pid, const std::string &bundleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    QuotaUsage &usage = uids_[uid];
+    usage.bundleName = bundleName;
+    uint32_t &pidRecords = pids_[pid];
+    if ((uidLimit_ != 0 && usage.records >= uidLimit_) || (pidLimit_ != 0 && pidRecords >= pidLimit_)) {
+        usage.rejected++;
+        if (pidRecords == 0) {
+            pids_.erase(pid);
+        }
+        TELEPHONY_LOGE("%{public}s uid %{public}d pid %{public}d is over its record quota, records = %{public}u",
+            bundleName.c_str(), uid, pid, usage.records);
+        return false;
+    }
+    usage.records++;
+    pidRecords++;
+    return true;
+}
+
+void TelephonyStateRegistryQuota::Release(int32_t uid, pid_t pid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto uidIt = uids_.find(uid);
+    if (uidIt != uids_.end() && uidIt->second.records > 0) {
+        uidIt->second.records--;
+        // the rejections stay reported until the uid registers again
+        if (uidIt->second.records == 0 && uidIt->second.rejected == 0) {
+            uids_.erase(uidIt);
+        }
+    }
+    auto pidIt = pids_.find(pid);
+    if (pidIt != pids_.end() && --pidIt->second == 0) {
+        pids_.erase(pidIt);
+    }
+}
+
+std::map<int32_t, QuotaUsage> TelephonyStateRegistryQuota::GetUidUsage() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uids_;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -17,13 +17,48 @@
 
 #include "telephony_permission.h"
 #include "telephony_log_wrapper.h"
+#include "telephony_types.h"
 #include "accesstoken_kit.h"
 #include "access_token.h"
 
 namespace OHOS {
 namespace Telephony {
 using namespace OHOS::Security::AccessToken;
-bool TelephonyStateRegistryRecord::IsCanReadCallHistory()
+namespace {
+const std::string EMPTY_STRING = "";
+
+uint32_t GetChangedNetworkStateFields(const NetworkState &last, const NetworkState &current)
+{
+    uint32_t fields = 0;
+    if (last.GetCsRegStatus() != current.GetCsRegStatus() || last.GetPsRegStatus() != current.GetPsRegStatus()) {
+        fields |= NETWORK_STATE_FIELD_REG_STATE;
+    }
+    if (last.GetCsRoamingStatus() != current.GetCsRoamingStatus() ||
+        last.GetPsRoamingStatus() != current.GetPsRoamingStatus()) {
+        fields |= NETWORK_STATE_FIELD_ROAMING;
+    }
+    if (last.GetCsRadioTech() != current.GetCsRadioTech() || last.GetPsRadioTech() != current.GetPsRadioTech()) {
+        fields |= NETWORK_STATE_FIELD_RADIO_TECH;
+    }
+    if (last.GetCfgTech() != current.GetCfgTech()) {
+        fields |= NETWORK_STATE_FIELD_CFG_TECH;
+    }
+    if (last.GetLongOperatorName() != current.GetLongOperatorName() ||
+        last.GetShortOperatorName() != current.GetShortOperatorName() ||
+        last.GetPlmnNumeric() != current.GetPlmnNumeric()) {
+        fields |= NETWORK_STATE_FIELD_OPERATOR;
+    }
+    if (last.GetNrState() != current.GetNrState()) {
+        fields |= NETWORK_STATE_FIELD_NR_STATE;
+    }
+    if (last.IsEmergency() != current.IsEmergency()) {
+        fields |= NETWORK_STATE_FIELD_EMERGENCY;
+    }
+    return fields;
+}
+} // namespace
+
+bool TelephonyStateRegistryRecord::IsCanReadCallHistory() const
 {
     if (AccessTokenKit::VerifyAccessToken(tokenId_, Permission::READ_CALL_LOG) == PERMISSION_DENIED) {
         return false;
@@ -44,5 +79,90 @@ bool TelephonyStateRegistryRecord::CanManageCallForDevices() const
     }
     return true;
 }
+
+const std::string &TelephonyStateRegistryRecord::GetBundleName() const
+{
+    return identity_ != nullptr ? identity_->bundleName : EMPTY_STRING;
+}
+
+const std::string &TelephonyStateRegistryRecord::GetAppIdentifier() const
+{
+    return identity_ != nullptr ? identity_->appIdentifier : EMPTY_STRING;
+}
+
+int32_t TelephonyStateRegistryRecord::GetUid() const
+{
+    return identity_ != nullptr ? identity_->uid : 0;
+}
+
+bool TelephonyStateRegistryRecord::IsSlotMatched(int32_t slotId) const
+{
+    if (slotId_ == slotId) {
+        return true;
+    }
+    // the slot-less call state (-1) is about any slot, so it reaches the all slots records too
+    if (slotId_ != SIM_SLOT_ID_FOR_ALL_SLOTS || slotId < -1) {
+        return false;
+    }
+    return slotId < MAX_SLOT_COUNT || canObserveVSim_;
+}
+
+int32_t TelephonyStateRegistryRecord::GetDeliveredSlotId(int32_t slotId) const
+{
+    // a record observing a single stream, such as the default data slot, compares with what it got last
+    return slotId_ == SIM_SLOT_ID_FOR_ALL_SLOTS ? slotId : slotId_;
+}
+
+void TelephonyStateRegistryRecordState::SetOptions(const TelephonyObserverOptions &options)
+{
+    options_ = options;
+    if (options_.networkStateFields_ == 0 && options_.dataConnectionStateFields_ == 0) {
+        delivered_ = nullptr;
+    } else if (delivered_ == nullptr) {
+        delivered_ = std::make_shared<TelephonyStateRegistryDelivered>();
+    }
+}
+
+bool TelephonyStateRegistryRecordState::IsNetworkStateChanged(
+    const TelephonyStateRegistryRecord &record, int32_t slotId, const sptr<NetworkState> &networkState) const
+{
+    if (options_.networkStateFields_ == 0 || delivered_ == nullptr || networkState == nullptr) {
+        return true;
+    }
+    int32_t deliveredSlotId = record.GetDeliveredSlotId(slotId);
+    std::lock_guard<std::mutex> lock(delivered_->mutex);
+    auto it = delivered_->networkStates.find(deliveredSlotId);
+    if (it != delivered_->networkStates.end() && it->second != nullptr &&
+        (GetChangedNetworkStateFields(*it->second, *networkState) & options_.networkStateFields_) == 0) {
+        return false;
+    }
+    delivered_->networkStates[deliveredSlotId] = networkState;
+    return true;
+}
+
+bool TelephonyStateRegistryRecordState::IsDataConnectStateChanged(
+    const TelephonyStateRegistryRecord &record, int32_t slotId, int32_t dataState, int32_t networkType) const
+{
+    if (options_.dataConnectionStateFields_ == 0 || delivered_ == nullptr) {
+        return true;
+    }
+    int32_t deliveredSlotId = record.GetDeliveredSlotId(slotId);
+    std::lock_guard<std::mutex> lock(delivered_->mutex);
+    auto it = delivered_->dataConnectStates.find(deliveredSlotId);
+    if (it != delivered_->dataConnectStates.end()) {
+        uint32_t fields = 0;
+        if (it->second.first != dataState) {
+            fields |= DATA_CONNECTION_STATE_FIELD_STATE;
+        }
+        if (it->second.second != networkType) {
+            fields |= DATA_CONNECTION_STATE_FIELD_NETWORK_TYPE;
+        }
+        if ((fields & options_.dataConnectionStateFields_) == 0) {
+            return false;
+        }
+    }
+    delivered_->dataConnectStates[deliveredSlotId] = std::make_pair(dataState, networkType);
+    return true;
+}
 } // namespace Telephony
 } // namespace OHOS
@@ -15,16 +15,21 @@
 
 #include "telephony_state_registry_service.h"
 
+#include <algorithm>
 #include <sstream>
-#include <thread>
 
 #include "common_event_manager.h"
 #include "common_event_support.h"
+#include "event_handler.h"
+#include "event_runner.h"
 #include "iservice_registry.h"
+#include "parameters.h"
 #include "state_registry_errors.h"
+#include "state_registry_inner_errors.h"
 #include "string_ex.h"
 #include "system_ability.h"
 #include "system_ability_definition.h"
+#include "telephony_observer_proxy.h"
 #include "telephony_permission.h"
 #include "telephony_state_manager.h"
 #include "telephony_state_registry_dump_helper.h"
@@ -40,9 +45,96 @@ using namespace OHOS::EventFwk;
 bool g_registerResult =
     SystemAbility::MakeAndRegisterAbility(DelayedSingleton<TelephonyStateRegistryService>::GetInstance().get());
 constexpr int32_t SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT = 999;
+constexpr const char *LIMITER_PARAM_PREFIX = "persist.telephony.state_registry.limiter.";
+constexpr int64_t NETWORK_STATE_DEBOUNCE_MS = 200;
+constexpr int64_t SIM_STATE_DEBOUNCE_MS = 100;
+constexpr int64_t DATA_CONNECTION_DEBOUNCE_MS = 100;
+constexpr const char *QUOTA_UID_RECORDS_PARAM = "persist.telephony.state_registry.quota.uid_records";
+constexpr const char *QUOTA_PID_RECORDS_PARAM = "persist.telephony.state_registry.quota.pid_records";
+constexpr const char *WAKEUP_PARAM_PREFIX = "persist.telephony.state_registry.wakeup.";
+constexpr int64_t SIGNAL_WAKEUP_BUDGET_MS = 1000;
+constexpr int64_t CELL_INFO_WAKEUP_BUDGET_MS = 2000;
+constexpr int64_t DATA_FLOW_WAKEUP_BUDGET_MS = 500;
+constexpr uint64_t TRAILING_TASK_BYTES =
+    sizeof(std::weak_ptr<TelephonyStateRegistryService>) + sizeof(uint32_t) + sizeof(int32_t);
+constexpr uint64_t PENDING_KEY_BYTES = sizeof(TelephonyStateRegistryProcessState::PendingKey);
+
+static int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// the call state variants are one update delivered in different forms and share its stamp
+static uint32_t GetStampMask(uint32_t mask)
+{
+    if (mask == TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX ||
+        mask == TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE) {
+        return TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    }
+    return mask;
+}
+
+// a call state that was never reported is sent to ccall observers as idle
+static int32_t GetCCallState(int32_t callState)
+{
+    if (callState == static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN)) {
+        return static_cast<int32_t>(CallStatus::CALL_STATUS_IDLE);
+    }
+    return callState;
+}
+
+template<typename T>
+static uint64_t GetVectorBytes(const std::vector<sptr<T>> &vec)
+{
+    return vec.capacity() * sizeof(sptr<T>) + vec.size() * sizeof(T);
+}
+
+template<typename Payload>
+static uint64_t GetPayloadBytes(const std::shared_ptr<const Payload> &payload)
+{
+    return payload == nullptr ? 0 : payload->GetFootprint();
+}
+
+static uint64_t GetNetworkStateBytes(const sptr<NetworkState> &networkState)
+{
+    if (networkState == nullptr) {
+        return 0;
+    }
+    return sizeof(NetworkState) + networkState->GetLongOperatorName().size() +
+        networkState->GetShortOperatorName().size() + networkState->GetPlmnNumeric().size();
+}
+
+static uint64_t GetRecordBytes(const TelephonyStateRegistryRecordState &state)
+{
+    uint64_t bytes = sizeof(TelephonyStateRegistryRecord) + sizeof(TelephonyStateRegistryRecordState);
+    if (state.delivered_ != nullptr) {
+        bytes += sizeof(TelephonyStateRegistryDelivered);
+    }
+    if (state.ring_ != nullptr) {
+        bytes += sizeof(TelephonyObserverRing) + TelephonyObserverRing::DEFAULT_CAPACITY;
+    }
+    return bytes;
+}
+
+// deltas are encoded by the proxy of a remote observer, observers in this process get the values themselves
+static TelephonyObserverProxy *GetRemoteObserverProxy(const sptr<TelephonyObserverBroker> &observer)
+{
+    if (observer == nullptr || observer->AsObject() == nullptr || !observer->AsObject()->IsProxyObject()) {
+        return nullptr;
+    }
+    return static_cast<TelephonyObserverProxy *>(observer.GetRefPtr());
+}
+
+static bool PublishToCommonEventService(
+    const EventFwk::CommonEventData &data, const EventFwk::CommonEventPublishInfo &publishInfo)
+{
+    return EventFwk::CommonEventManager::PublishCommonEvent(data, publishInfo, nullptr);
+}
 
 TelephonyStateRegistryService::TelephonyStateRegistryService()
-    : SystemAbility(TELEPHONY_STATE_REGISTRY_SYS_ABILITY_ID, true)
+    : SystemAbility(TELEPHONY_STATE_REGISTRY_SYS_ABILITY_ID, true),
+      eventBuffer_(MAX_PENDING_COMMON_EVENTS, PublishToCommonEventService)
 {
     slotSize_ = SIM_SLOT_COUNT_MD;
 #ifdef OHOS_BUILD_ENABLE_TELEPHONY_VSIM
@@ -66,12 +158,17 @@ TelephonyStateRegistryService::TelephonyStateRegistryService()
         callState_[0] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
     }
     callState_[-1] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+    stampEpoch_ = static_cast<uint64_t>(GetSteadyTimeMs());
+    InitLimiter();
+    InitQuota();
+    InitWakeup();
 }
 
 TelephonyStateRegistryService::~TelephonyStateRegistryService()
 {
     std::unique_lock<std::shared_mutex> lock(lock_);
     stateRecords_.clear();
+    recordStates_.clear();
     callState_.clear();
     callIncomingNumber_.clear();
     signalInfos_.clear();
@@ -89,38 +186,127 @@ void TelephonyStateRegistryService::OnStart()
         return;
     }
     state_ = ServiceRunningState::STATE_RUNNING;
+    ResetStartupTimeline();
+    if (handler_ == nullptr) {
+        handler_ = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::Create("StateRegistryRunner"));
+    }
+    if (mirror_ == nullptr) {
+        mirror_ = TelephonyObserverMirror::Create(slotSize_);
+    }
+    if (systemMirror_ == nullptr) {
+        systemMirror_ = TelephonyObserverMirror::Create(slotSize_);
+    }
+    lock.unlock();
+    MarkStartupPhase("handler_ready");
+    // kept until the common event service is up instead of being lost when it starts after us
+    eventBuffer_.Watch();
     bool ret = SystemAbility::Publish(DelayedSingleton<TelephonyStateRegistryService>::GetInstance().get());
     if (!ret) {
         TELEPHONY_LOGE("Leave, Failed to publish TelephonyStateRegistryService");
     }
+    MarkStartupPhase("published");
+    // sent after publishing, eventBuffer_ holds them until the common event service is up. A producer may have
+    // reported a call state meanwhile, the shared lock orders the broadcasts of the slots it did not report yet
+    // before its own
+    std::shared_lock<std::shared_mutex> sharedLock(lock_);
+    for (int32_t i = 0; i < slotSize_; i++) {
+        auto it = callState_.find(i);
+        if (it != callState_.end() && it->second != static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN)) {
+            continue;
+        }
+        TELEPHONY_LOGI("TelephonyStateRegistryService send disconnected call state.");
+        SendCallStateChanged(i, static_cast<int32_t>(CallStatus::CALL_STATUS_DISCONNECTED));
+    }
+    sharedLock.unlock();
+    if (!AddSystemAbilityListener(COMMON_EVENT_SERVICE_ID)) {
+        TELEPHONY_LOGE("add common event service listener failed");
+        eventBuffer_.SetReady(true);
+    }
 #ifdef OHOS_BUILD_ENABLE_TELEPHONY_EXT
-    TELEPHONY_EXT_WRAPPER.InitTelephonyExtWrapper();
+    std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+    handler_->PostTask([weak]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->LoadTelephonyExt();
+        }
+    });
 #endif
     TELEPHONY_LOGI("TelephonyStateRegistryService start success.");
     bindEndTime_ =
         std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
             .count();
-    auto weak = weak_from_this();
-    auto localSlotSize = slotSize_;
-    std::thread task([weak, localSlotSize]() {
-        auto self = weak.lock();
-        if (self == nullptr) {
+}
+
+void TelephonyStateRegistryService::LoadTelephonyExt()
+{
+    // the ext hooks are optional, updates that arrive before they are loaded are delivered without them
+    TelephonyExtWrapper::Hooks hooks = TelephonyExtWrapper::LoadHooks();
+    {
+        // the binder threads read the hooks under the shared lock, so they are only written under the exclusive one
+        std::unique_lock<std::shared_mutex> lock(lock_);
+        TELEPHONY_EXT_WRAPPER.SetHooks(hooks);
+        if (state_ != ServiceRunningState::STATE_RUNNING) {
             return;
         }
-        if (self->IsCommonEventServiceAbilityExist()) {
-            for (int32_t i = 0; i < localSlotSize; i++) {
-                TELEPHONY_LOGI("TelephonyStateRegistryService send disconnected call state.");
-                self->SendCallStateChanged(i, static_cast<int32_t>(CallStatus::CALL_STATUS_DISCONNECTED));
-            }
-        }
-    });
-    pthread_setname_np(task.native_handle(), "state_registry_task");
-    task.detach();
+    }
+    if (TELEPHONY_EXT_WRAPPER.registerProcessStateCallback_ != nullptr) {
+        SetProcessStateSource(std::make_shared<ExtProcessStateSource>());
+    }
+    MarkStartupPhase("ext_loaded");
+}
+
+void TelephonyStateRegistryService::OnAddSystemAbility(int32_t systemAbilityId, const std::string &deviceId)
+{
+    if (systemAbilityId != COMMON_EVENT_SERVICE_ID) {
+        return;
+    }
+    TELEPHONY_LOGI("common event service added");
+    MarkStartupPhase("ces_ready");
+    eventBuffer_.SetReady(true);
+    SetPackageChangeSource(std::make_shared<CommonEventPackageChangeSource>());
+}
+
+void TelephonyStateRegistryService::OnRemoveSystemAbility(int32_t systemAbilityId, const std::string &deviceId)
+{
+    if (systemAbilityId != COMMON_EVENT_SERVICE_ID) {
+        return;
+    }
+    TELEPHONY_LOGW("common event service removed");
+    eventBuffer_.SetReady(false);
+    // package changes are missed until it is back, the identity cache is cleared and enabled again then
+    SetPackageChangeSource(nullptr);
+}
+
+void TelephonyStateRegistryService::ResetStartupTimeline()
+{
+    std::lock_guard<std::mutex> lock(startupMutex_);
+    startupBeginMs_ = GetSteadyTimeMs();
+    startupTimeline_.clear();
+    startupTimeline_.push_back({ "start", 0 });
+}
+
+void TelephonyStateRegistryService::MarkStartupPhase(const std::string &phase)
+{
+    std::lock_guard<std::mutex> lock(startupMutex_);
+    startupTimeline_.push_back({ phase, GetSteadyTimeMs() - startupBeginMs_ });
+}
+
+std::vector<StartupPhase> TelephonyStateRegistryService::GetStartupTimeline() const
+{
+    std::lock_guard<std::mutex> lock(startupMutex_);
+    return startupTimeline_;
+}
+
+const TelephonyStateRegistryEventBuffer &TelephonyStateRegistryService::GetEventBuffer() const
+{
+    return eventBuffer_;
 }
 
 void TelephonyStateRegistryService::OnStop()
 {
     TELEPHONY_LOGI("TelephonyStateRegistryService OnStop ");
+    SetProcessStateSource(nullptr);
+    SetPackageChangeSource(nullptr);
     std::unique_lock<std::shared_mutex> lock(lock_);
     state_ = ServiceRunningState::STATE_STOPPED;
 }
@@ -145,31 +331,103 @@ int32_t TelephonyStateRegistryService::UpdateCellularDataConnectState(
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
     std::unique_lock<std::shared_mutex> uniLock(lock_);
+    bool changed = cellularDataConnectionState_.find(slotId) == cellularDataConnectionState_.end() ||
+        cellularDataConnectionState_[slotId] != dataState ||
+        cellularDataConnectionNetworkType_[slotId] != networkType;
     cellularDataConnectionState_[slotId] = dataState;
     cellularDataConnectionNetworkType_[slotId] = networkType;
+    TelephonyObserverUpdateStamp stamp =
+        NextStamp(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId);
+    MirrorState(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId);
     uniLock.unlock();
-    std::shared_lock<std::shared_mutex> lock(lock_);
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId, changed, result)) {
+        return result;
+    }
+    admission_.Enter(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId, false);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        // 999 means observe all slot
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        // 999 means observe the default cellular data slot
         if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE) &&
-            (record.slotId_ == slotId || record.slotId_ == SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT) &&
+            (record.IsSlotMatched(slotId) || IsDefaultDataSlotMatched(record, slotId)) &&
             record.telephonyObserver_ != nullptr) {
+            result = TELEPHONY_SUCCESS;
+            if (IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId)) {
+                continue;
+            }
+            int32_t networkTypeNotify = networkType;
             if (TELEPHONY_EXT_WRAPPER.onCellularDataConnectStateUpdated_ != nullptr) {
-                int32_t networkTypeExt = networkType;
-                TELEPHONY_EXT_WRAPPER.onCellularDataConnectStateUpdated_(slotId, record, networkTypeExt);
-                record.telephonyObserver_->OnCellularDataConnectStateUpdated(slotId, dataState, networkTypeExt);
-            } else {
-                record.telephonyObserver_->OnCellularDataConnectStateUpdated(slotId, dataState, networkType);
+                TELEPHONY_EXT_WRAPPER.onCellularDataConnectStateUpdated_(slotId, record, networkTypeNotify);
             }
-            result = TELEPHONY_SUCCESS;
+            if (!GetRecordState(record).IsDataConnectStateChanged(record, slotId, dataState, networkTypeNotify)) {
+                continue;
+            }
+            record.telephonyObserver_->OnCellularDataConnectStateUpdated(slotId, dataState, networkTypeNotify);
         }
     }
     SendCellularDataConnectStateChanged(slotId, dataState, networkType);
+    admission_.Leave(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, slotId);
     return result;
 }
 
+template<typename Channel>
+int32_t TelephonyStateRegistryService::UpdateChannel(
+    typename Channel::Cache &cache, int32_t slotId, const typename Channel::PayloadType &value)
+{
+    std::unique_lock<std::shared_mutex> uniLock(lock_);
+    bool changed = Channel::Store(cache, slotId, value);
+    TelephonyObserverUpdateStamp stamp = NextStamp(Channel::MASK, slotId);
+    MirrorState(Channel::MASK, slotId);
+    uniLock.unlock();
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(Channel::MASK, slotId, changed, result)) {
+        return result;
+    }
+    if (Channel::COALESCIBLE) {
+        return DeliverLevelUpdate(Channel::MASK, slotId);
+    }
+    // edge-type values are sent as they arrived, a newer one cached meanwhile gets its own fan-out
+    admission_.Enter(Channel::MASK, slotId, false);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    result = NotifyChannel<Channel>(slotId, value, stamp);
+    lock.unlock();
+    admission_.Leave(Channel::MASK, slotId);
+    return result;
+}
+
+template<typename Channel>
+int32_t TelephonyStateRegistryService::NotifyChannel(
+    int32_t slotId, const typename Channel::PayloadType &value, const TelephonyObserverUpdateStamp &stamp)
+{
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (!Channel::IsListening(record) || !(record.IsSlotMatched(slotId) ||
+            (Channel::FOLLOWS_DEFAULT_DATA_SLOT && IsDefaultDataSlotMatched(record, slotId)))) {
+            continue;
+        }
+        result = TELEPHONY_SUCCESS;
+        if (IsDeliveryDeferred(record, Channel::MASK, slotId)) {
+            continue;
+        }
+        Channel::Deliver(record, slotId, value);
+    }
+    return result;
+}
+
+template<typename Channel>
+void TelephonyStateRegistryService::NotifyCachedChannel(
+    const TelephonyStateRegistryRecord &record, const typename Channel::Cache &cache, int32_t slotId)
+{
+    auto it = cache.find(slotId);
+    if (it != cache.end()) {
+        Channel::Deliver(record, slotId, it->second);
+    }
+}
+
 int32_t TelephonyStateRegistryService::UpdateCellularDataFlow(int32_t slotId, int32_t flowData)
 {
     if (!VerifySlotId(slotId)) {
@@ -180,22 +438,18 @@ int32_t TelephonyStateRegistryService::UpdateCellularDataFlow(int32_t slotId, in
         TELEPHONY_LOGE("Check permission failed.");
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
-    std::unique_lock<std::shared_mutex> uniLock(lock_);
-    cellularDataFlow_[slotId] = flowData;
-    uniLock.unlock();
+    return UpdateChannel<CellularDataFlowChannel>(cellularDataFlow_, slotId, flowData);
+}
+
+int32_t TelephonyStateRegistryService::NotifyCellularDataFlowUpdated(int32_t slotId)
+{
     std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
-    for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        // 999 means observe all slot
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW) &&
-            (record.slotId_ == slotId || record.slotId_ == SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT) &&
-            record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnCellularDataFlowUpdated(slotId, flowData);
-            result = TELEPHONY_SUCCESS;
-        }
+    auto it = cellularDataFlow_.find(slotId);
+    if (it == cellularDataFlow_.end()) {
+        return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     }
-    return result;
+    return NotifyChannel<CellularDataFlowChannel>(
+        slotId, it->second, GetStamp(TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW, slotId));
 }
 
 int32_t TelephonyStateRegistryService::UpdateCallState(int32_t callState, const std::u16string &number)
@@ -208,35 +462,16 @@ int32_t TelephonyStateRegistryService::UpdateCallState(int32_t callState, const
     // -1 means observe all slot
     callState_[-1] = callState;
     callIncomingNumber_[-1] = number;
+    TelephonyObserverUpdateStamp stamp = NextStamp(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, -1);
+    MirrorState(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, -1);
     uniLock.unlock();
+    admission_.Enter(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, -1, false);
     std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
-    for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE) &&
-            (record.slotId_ == -1) && record.telephonyObserver_ != nullptr) {
-            std::u16string phoneNumber;
-            if (record.IsCanReadCallHistory()) {
-                phoneNumber = number;
-            } else {
-                phoneNumber = Str8ToStr16("");
-            }
-            record.telephonyObserver_->OnCallStateUpdated(record.slotId_, callState, phoneNumber);
-            result = TELEPHONY_SUCCESS;
-        } else if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX) &&
-            (record.slotId_ == -1) && record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnCallStateUpdatedEx(record.slotId_, callState);
-            result = TELEPHONY_SUCCESS;
-        } else if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE) &&
-            (record.slotId_ == -1) && record.telephonyObserver_ != nullptr) {
-            if (record.CanManageCallForDevices()) {
-                record.telephonyObserver_->OnCCallStateUpdated(record.slotId_, callState, number);
-                result = TELEPHONY_SUCCESS;
-            }
-        }
-    }
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    int32_t result = NotifyCallStateUpdated(-1, callState, number);
     SendCallStateChanged(-1, callState);
     SendCallStateChangedAsUserMultiplePermission(-1, callState, number);
+    admission_.Leave(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, -1);
     return result;
 }
 
@@ -254,30 +489,50 @@ int32_t TelephonyStateRegistryService::UpdateCallStateForSlotId(
     std::unique_lock<std::shared_mutex> uniLock(lock_);
     callState_[slotId] = callState;
     callIncomingNumber_[slotId] = number;
+    TelephonyObserverUpdateStamp stamp = NextStamp(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, slotId);
+    MirrorState(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, slotId);
     uniLock.unlock();
+    admission_.Enter(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, slotId, false);
     std::shared_lock<std::shared_mutex> lock(lock_);
+    TelephonyObserverUpdateStampScope stampScope(stamp);
+    int32_t result = NotifyCallStateUpdated(slotId, callState, number);
+    SendCallStateChanged(slotId, callState);
+    SendCallStateChangedAsUserMultiplePermission(slotId, callState, number);
+    admission_.Leave(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, slotId);
+    return result;
+}
+
+int32_t TelephonyStateRegistryService::NotifyCallStateUpdated(
+    int32_t slotId, int32_t callState, const std::u16string &number)
+{
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            std::u16string phoneNumber = GetCallIncomingNumberForSlotId(record, slotId);
-            record.telephonyObserver_->OnCallStateUpdated(slotId, callState, phoneNumber);
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.telephonyObserver_ == nullptr || !record.IsSlotMatched(slotId)) {
+            continue;
+        }
+        // a merged record can observe several call state variants, each of them is delivered on its own
+        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE)) {
             result = TELEPHONY_SUCCESS;
-        } else if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnCallStateUpdatedEx(slotId, callState);
+            if (!IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE, slotId)) {
+                std::u16string phoneNumber = record.IsCanReadCallHistory() ? number : Str8ToStr16("");
+                record.telephonyObserver_->OnCallStateUpdated(slotId, callState, phoneNumber);
+            }
+        }
+        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX)) {
             result = TELEPHONY_SUCCESS;
-        } else if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            if (record.CanManageCallForDevices()) {
-                record.telephonyObserver_->OnCCallStateUpdated(record.slotId_, callState, number);
-                result = TELEPHONY_SUCCESS;
+            if (!IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX, slotId)) {
+                record.telephonyObserver_->OnCallStateUpdatedEx(slotId, callState);
+            }
+        }
+        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE) &&
+            record.CanManageCallForDevices()) {
+            result = TELEPHONY_SUCCESS;
+            if (!IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE, slotId)) {
+                record.telephonyObserver_->OnCCallStateUpdated(slotId, callState, number);
             }
         }
     }
-    SendCallStateChanged(slotId, callState);
-    SendCallStateChangedAsUserMultiplePermission(slotId, callState, number);
     return result;
 }
 
@@ -292,27 +547,50 @@ int32_t TelephonyStateRegistryService::UpdateSimState(int32_t slotId, CardType t
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
     std::unique_lock<std::shared_mutex> uniLock(lock_);
+    bool changed = simState_.find(slotId) == simState_.end() || simState_[slotId] != state ||
+        simReason_[slotId] != reason || cardType_[slotId] != type;
     simState_[slotId] = state;
     simReason_[slotId] = reason;
     cardType_[slotId] = type;
+    TelephonyObserverUpdateStamp stamp = NextStamp(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId);
+    MirrorState(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId);
     uniLock.unlock();
-    std::shared_lock<std::shared_mutex> lock(lock_);
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId, changed, result)) {
+        return result;
+    }
+    admission_.Enter(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId, false);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
         if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
+            record.IsSlotMatched(slotId) && record.telephonyObserver_ != nullptr) {
+            if (IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId)) {
+                result = TELEPHONY_SUCCESS;
+                continue;
+            }
             record.telephonyObserver_->OnSimStateUpdated(slotId, type, state, reason);
             result = TELEPHONY_SUCCESS;
         }
     }
     SendSimStateChanged(slotId, type, state, reason);
+    admission_.Leave(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, slotId);
     return result;
 }
 
-__attribute__((no_sanitize("cfi")))
 int32_t TelephonyStateRegistryService::UpdateSignalInfo(int32_t slotId, const std::vector<sptr<SignalInformation>> &vec)
 {
+    return UpdateSignalInfoPayload(slotId, std::make_shared<const SignalInfoPayload>(vec));
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::UpdateSignalInfoPayload(
+    int32_t slotId, const std::shared_ptr<const SignalInfoPayload> &payload)
+{
+    if (payload == nullptr) {
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
     if (!VerifySlotId(slotId)) {
         TELEPHONY_LOGE("UpdateSignalInfo##VerifySlotId failed ##slotId = %{public}d", slotId);
         return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
@@ -322,31 +600,152 @@ int32_t TelephonyStateRegistryService::UpdateSignalInfo(int32_t slotId, const st
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
     std::unique_lock<std::shared_mutex> uniLock(lock_);
-    signalInfos_[slotId] = vec;
+    memory_.Replace(MemoryCategory::SIGNAL_CACHE, GetPayloadBytes(signalInfos_[slotId]), payload->GetFootprint());
+    signalInfos_[slotId] = payload;
+    NextStamp(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, slotId);
+    signalStatistics_.Add(slotId, payload->GetList(), GetSteadyTimeMs());
     uniLock.unlock();
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, slotId, true, result)) {
+        return result;
+    }
+    return DeliverLevelUpdate(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, slotId);
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::NotifySignalInfoUpdated(int32_t slotId)
+{
     std::shared_lock<std::shared_mutex> lock(lock_);
+    auto it = signalInfos_.find(slotId);
+    if (it == signalInfos_.end()) {
+        return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    }
+    const std::shared_ptr<const SignalInfoPayload> payload = it->second;
+    TelephonyObserverUpdateStampScope stampScope(
+        GetStamp(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, slotId));
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        // records that subscribed to the statistics get them from the tick instead
         if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
+            record.IsSlotMatched(slotId) && record.telephonyObserver_ != nullptr &&
+            GetRecordState(record).options_.signalStatisticsPeriodMs_ == 0) {
+            if (IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, slotId)) {
+                result = TELEPHONY_SUCCESS;
+                continue;
+            }
             if (TELEPHONY_EXT_WRAPPER.onSignalInfoUpdated_ != nullptr) {
+                const std::vector<sptr<SignalInformation>> &vec = payload->GetList();
                 std::vector<sptr<SignalInformation>> vecExt = vec;
+                uint64_t extBytes = GetVectorBytes(vecExt);
+                memory_.Add(MemoryCategory::EXT_COPIES, extBytes);
                 TELEPHONY_EXT_WRAPPER.onSignalInfoUpdated_(slotId, record, vecExt, vec);
                 record.telephonyObserver_->OnSignalInfoUpdated(slotId, vecExt);
+                memory_.Sub(MemoryCategory::EXT_COPIES, extBytes);
             } else {
-                record.telephonyObserver_->OnSignalInfoUpdated(slotId, vec);
+                DeliverSignalInfo(record, GetRecordState(record), slotId, *payload);
             }
             result = TELEPHONY_SUCCESS;
         }
     }
-    SendSignalInfoChanged(slotId, vec);
+    SendSignalInfoChanged(slotId, payload->GetList());
     return result;
 }
 
-__attribute__((no_sanitize("cfi")))
+void TelephonyStateRegistryService::DeliverSignalInfo(const TelephonyStateRegistryRecord &record,
+    const TelephonyStateRegistryRecordState &state, int32_t slotId, const SignalInfoPayload &payload)
+{
+    if (state.ring_ != nullptr &&
+        PushEventRing(record, *state.ring_, TelephonyObserverBroker::ObserverBrokerCode::ON_SIGNAL_INFO_UPDATED,
+        slotId, payload.GetBytes())) {
+        return;
+    }
+    TelephonyObserverProxy *proxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (proxy != nullptr && (proxy->OnSignalInfoBlobUpdated(slotId, payload.GetBlob()) ||
+        proxy->OnSignalInfoBytesUpdated(slotId, payload.GetBytes()))) {
+        return;
+    }
+    record.telephonyObserver_->OnSignalInfoUpdated(slotId, payload.GetList());
+}
+
+void TelephonyStateRegistryService::DeliverSignalStatistics(const TelephonyStateRegistryRecord &record, int32_t slotId)
+{
+    TelephonyObserverProxy *proxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (proxy == nullptr) {
+        return;
+    }
+    std::vector<TelephonyObserverSignalStatistics> statistics;
+    signalStatistics_.Get(slotId, GetSteadyTimeMs(), statistics);
+    if (!statistics.empty()) {
+        proxy->OnSignalStatisticsUpdated(slotId, statistics);
+    }
+}
+
+void TelephonyStateRegistryService::StartSignalStatisticsTick()
+{
+    bool ticking = false;
+    if (handler_ == nullptr || !signalStatisticsTicking_.compare_exchange_strong(ticking, true)) {
+        return;
+    }
+    PostSignalStatisticsTick();
+}
+
+void TelephonyStateRegistryService::PostSignalStatisticsTick()
+{
+    std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+    handler_->PostTask([weak]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->OnSignalStatisticsTick();
+        }
+    }, SIGNAL_STATISTICS_TICK_MS);
+}
+
+void TelephonyStateRegistryService::OnSignalStatisticsTick()
+{
+    // one tick for every subscriber, a period is a whole number of ticks
+    uint64_t tick = ++signalStatisticsTicks_;
+    bool subscribed = false;
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        uint64_t periodMs = GetRecordState(record).options_.signalStatisticsPeriodMs_;
+        if (periodMs == 0 || record.telephonyObserver_ == nullptr ||
+            !record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS)) {
+            continue;
+        }
+        subscribed = true;
+        uint64_t periodTicks = (periodMs + SIGNAL_STATISTICS_TICK_MS - 1) / SIGNAL_STATISTICS_TICK_MS;
+        if (tick % periodTicks != 0) {
+            continue;
+        }
+        for (const auto &item : signalInfos_) {
+            if (record.IsSlotMatched(item.first)) {
+                DeliverSignalStatistics(record, item.first);
+            }
+        }
+    }
+    if (!subscribed) {
+        // cleared under lock_, so a record registered after the scan finds the tick stopped and restarts it
+        signalStatisticsTicking_ = false;
+        return;
+    }
+    lock.unlock();
+    PostSignalStatisticsTick();
+}
+
 int32_t TelephonyStateRegistryService::UpdateCellInfo(int32_t slotId, const std::vector<sptr<CellInformation>> &vec)
 {
+    return UpdateCellInfoPayload(slotId, std::make_shared<const CellInfoPayload>(vec));
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::UpdateCellInfoPayload(
+    int32_t slotId, const std::shared_ptr<const CellInfoPayload> &payload)
+{
+    if (payload == nullptr) {
+        return TELEPHONY_ERR_LOCAL_PTR_NULL;
+    }
     if (!VerifySlotId(slotId)) {
         TELEPHONY_LOGE("UpdateCellInfo##VerifySlotId failed ##slotId = %{public}d", slotId);
         return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
@@ -357,23 +756,50 @@ int32_t TelephonyStateRegistryService::UpdateCellInfo(int32_t slotId, const std:
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
     std::unique_lock<std::shared_mutex> uniLock(lock_);
-    cellInfos_[slotId] = vec;
+    memory_.Replace(MemoryCategory::CELL_CACHE, GetPayloadBytes(cellInfos_[slotId]), payload->GetFootprint());
+    cellInfos_[slotId] = payload;
+    NextStamp(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, slotId);
     uniLock.unlock();
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, slotId, true, result)) {
+        return result;
+    }
+    return DeliverLevelUpdate(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, slotId);
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::NotifyCellInfoUpdated(int32_t slotId)
+{
     std::shared_lock<std::shared_mutex> lock(lock_);
+    auto it = cellInfos_.find(slotId);
+    if (it == cellInfos_.end()) {
+        return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    }
+    const std::shared_ptr<const CellInfoPayload> payload = it->second;
+    TelephonyObserverUpdateStampScope stampScope(GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, slotId));
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO) && record.slotId_ == slotId) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO) &&
+            record.IsSlotMatched(slotId)) {
             if (record.telephonyObserver_ == nullptr) {
                 TELEPHONY_LOGE("record.telephonyObserver_ is nullptr");
                 return TELEPHONY_ERR_LOCAL_PTR_NULL;
             }
+            if (IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, slotId)) {
+                result = TELEPHONY_SUCCESS;
+                continue;
+            }
             if (TELEPHONY_EXT_WRAPPER.onCellInfoUpdated_ != nullptr) {
+                const std::vector<sptr<CellInformation>> &vec = payload->GetList();
                 std::vector<sptr<CellInformation>> vecExt = vec;
+                uint64_t extBytes = GetVectorBytes(vecExt);
+                memory_.Add(MemoryCategory::EXT_COPIES, extBytes);
                 TELEPHONY_EXT_WRAPPER.onCellInfoUpdated_(slotId, record, vecExt, vec);
                 record.telephonyObserver_->OnCellInfoUpdated(slotId, vecExt);
+                memory_.Sub(MemoryCategory::EXT_COPIES, extBytes);
             } else {
-                record.telephonyObserver_->OnCellInfoUpdated(slotId, vec);
+                DeliverCellInfo(record, GetRecordState(record), slotId, *payload);
             }
             result = TELEPHONY_SUCCESS;
         }
@@ -381,6 +807,125 @@ int32_t TelephonyStateRegistryService::UpdateCellInfo(int32_t slotId, const std:
     return result;
 }
 
+void TelephonyStateRegistryService::DeliverCellInfo(const TelephonyStateRegistryRecord &record,
+    const TelephonyStateRegistryRecordState &state, int32_t slotId, const CellInfoPayload &payload)
+{
+    if (state.ring_ != nullptr &&
+        PushEventRing(record, *state.ring_, TelephonyObserverBroker::ObserverBrokerCode::ON_CELL_INFO_UPDATED,
+        slotId, payload.GetBytes())) {
+        return;
+    }
+    TelephonyObserverProxy *proxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (proxy != nullptr && (proxy->OnCellInfoBlobUpdated(slotId, payload.GetBlob()) ||
+        proxy->OnCellInfoBytesUpdated(slotId, payload.GetBytes()))) {
+        return;
+    }
+    record.telephonyObserver_->OnCellInfoUpdated(slotId, payload.GetList());
+}
+
+const TelephonyStateRegistryRecordState &TelephonyStateRegistryService::GetRecordState(
+    const TelephonyStateRegistryRecord &record) const
+{
+    static const TelephonyStateRegistryRecordState defaultState;
+    auto it = recordStates_.find(record.recordId_);
+    return it == recordStates_.end() ? defaultState : it->second;
+}
+
+TelephonyStateRegistryRecordState &TelephonyStateRegistryService::GetMutableRecordState(
+    const TelephonyStateRegistryRecord &record)
+{
+    return recordStates_[record.recordId_];
+}
+
+void TelephonyStateRegistryService::AttachEventRing(
+    const TelephonyStateRegistryRecord &record, TelephonyStateRegistryRecordState &state)
+{
+    const uint32_t ringMask =
+        TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS | TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO;
+    TelephonyObserverProxy *proxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (!state.options_.eventRing_ || proxy == nullptr || (record.mask_ & ringMask) == 0) {
+        state.ring_ = nullptr;
+        return;
+    }
+    if (state.ring_ != nullptr) {
+        return;
+    }
+    state.ring_ = TelephonyObserverRing::Create(++ringId_, record.slotId_, record.mask_ & ringMask);
+    if (state.ring_ == nullptr) {
+        TELEPHONY_LOGE("event ring of pid %{public}d is not created, binder is used", record.pid_);
+        return;
+    }
+    proxy->OnEventRingAttached(state.ring_->GetId(), state.ring_->GetAshmem());
+}
+
+void TelephonyStateRegistryService::AssignPacingId(
+    TelephonyStateRegistryRecord &record, const TelephonyObserverOptions &options)
+{
+    if (options.HasPacedDelivery() && record.pacingId_ == 0) {
+        record.pacingId_ = ++pacingSeq_;
+    }
+}
+
+bool TelephonyStateRegistryService::IsMergeableOptions(const TelephonyObserverOptions &options)
+{
+    // the delivery is kept per listening type, records differing in it alone can share an observer
+    TelephonyObserverOptions others = options;
+    others.deliveryPolicies_.clear();
+    return others.IsDefault();
+}
+
+void TelephonyStateRegistryService::MergeDeliveryPolicy(
+    TelephonyStateRegistryRecord &record, uint32_t mask, const TelephonyObserverOptions &options)
+{
+    TelephonyStateRegistryRecordState &state = GetMutableRecordState(record);
+    state.options_.SetDeliveryPolicy(mask, DELIVERY_MODE_EVERY, 0);
+    for (const auto &policy : options.deliveryPolicies_) {
+        if ((policy.first & mask) != 0) {
+            state.options_.SetDeliveryPolicy(policy.first & mask, policy.second.mode, policy.second.periodMs);
+        }
+    }
+    AssignPacingId(record, state.options_);
+}
+
+void TelephonyStateRegistryService::ReleaseMask(TelephonyStateRegistryRecord &record, uint32_t mask)
+{
+    TelephonyStateRegistryRecordState &state = GetMutableRecordState(record);
+    uint64_t oldBytes = GetRecordBytes(state);
+    record.mask_ &= ~mask;
+    state.options_.SetDeliveryPolicy(mask, DELIVERY_MODE_EVERY, 0);
+    // the ring and the held deliveries only live as long as a listening type still uses them
+    if (state.ring_ != nullptr && (record.mask_ & state.ring_->GetMask()) == 0) {
+        state.ring_ = nullptr;
+    }
+    if (record.pacingId_ != 0) {
+        timerWheel_.Remove(record.pacingId_, mask);
+    }
+    memory_.ResizeRecord(record.GetBundleName(), oldBytes, GetRecordBytes(state));
+}
+
+bool TelephonyStateRegistryService::PushEventRing(const TelephonyStateRegistryRecord &record,
+    TelephonyObserverRing &ring, TelephonyObserverBroker::ObserverBrokerCode code, int32_t slotId,
+    const std::vector<uint8_t> &bytes)
+{
+    TelephonyObserverProxy *proxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (proxy == nullptr) {
+        return false;
+    }
+    // the body is the request the observer would get in the transaction of that code
+    MessageParcel body;
+    if (!body.WriteInt32(slotId) || !body.WriteBuffer(bytes.data(), bytes.size())) {
+        return false;
+    }
+    TelephonyObserverUpdateStamp stamp = TelephonyObserverUpdateStamp::GetCurrent();
+    if (stamp.IsValid()) {
+        stamp.Marshalling(body);
+    }
+    if (ring.Push(static_cast<uint32_t>(code), body)) {
+        proxy->OnEventRingDoorbell(ring.GetId());
+    }
+    return true;
+}
+
 __attribute__((no_sanitize("cfi")))
 int32_t TelephonyStateRegistryService::UpdateNetworkState(int32_t slotId, const sptr<NetworkState> &networkState)
 {
@@ -393,6 +938,7 @@ int32_t TelephonyStateRegistryService::UpdateNetworkState(int32_t slotId, const
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
     std::unique_lock<std::shared_mutex> uniLock(lock_);
+    uint64_t oldBytes = GetNetworkStateBytes(searchNetworkState_[slotId]);
     searchNetworkState_[slotId] = networkState;
     if (networkState != nullptr) {
         sptr<NetworkState> searchNetworkState = sptr<NetworkState>::MakeSptr();
@@ -403,28 +949,56 @@ int32_t TelephonyStateRegistryService::UpdateNetworkState(int32_t slotId, const
             searchNetworkState_[slotId] = searchNetworkState;
         }
     }
+    memory_.Replace(MemoryCategory::NETWORK_CACHE, oldBytes, GetNetworkStateBytes(searchNetworkState_[slotId]));
+    NextStamp(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, slotId);
     uniLock.unlock();
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    if (IsLimited(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, slotId, true, result)) {
+        return result;
+    }
+    result = DeliverLevelUpdate(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, slotId);
+    TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateNetworkState end");
+    return result;
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::NotifyNetworkStateUpdated(int32_t slotId)
+{
     std::shared_lock<std::shared_mutex> lock(lock_);
+    auto it = searchNetworkState_.find(slotId);
+    if (it == searchNetworkState_.end()) {
+        return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    }
+    const sptr<NetworkState> networkState = it->second;
+    TelephonyObserverUpdateStampScope stampScope(
+        GetStamp(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, slotId));
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord r = stateRecords_[i];
-        if (r.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE) && (r.slotId_ == slotId) &&
+        const TelephonyStateRegistryRecord &r = stateRecords_[i];
+        if (r.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE) && r.IsSlotMatched(slotId) &&
             r.telephonyObserver_ != nullptr && networkState != nullptr) {
+            result = TELEPHONY_SUCCESS;
+            if (IsDeliveryDeferred(r, TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, slotId)) {
+                continue;
+            }
+            sptr<NetworkState> networkStateNotify = networkState;
+            uint64_t extBytes = 0;
             if (TELEPHONY_EXT_WRAPPER.onNetworkStateUpdated_ != nullptr) {
-                sptr<NetworkState> networkStateExt = new NetworkState();
+                networkStateNotify = new NetworkState();
                 MessageParcel data;
                 networkState->Marshalling(data);
-                networkStateExt->ReadFromParcel(data);
-                TELEPHONY_EXT_WRAPPER.onNetworkStateUpdated_(slotId, r, networkStateExt, networkState);
-                r.telephonyObserver_->OnNetworkStateUpdated(slotId, networkStateExt);
-            } else {
-                r.telephonyObserver_->OnNetworkStateUpdated(slotId, networkState);
+                networkStateNotify->ReadFromParcel(data);
+                extBytes = GetNetworkStateBytes(networkStateNotify);
+                memory_.Add(MemoryCategory::EXT_COPIES, extBytes);
+                TELEPHONY_EXT_WRAPPER.onNetworkStateUpdated_(slotId, r, networkStateNotify, networkState);
             }
-            result = TELEPHONY_SUCCESS;
+            if (GetRecordState(r).IsNetworkStateChanged(r, slotId, networkStateNotify)) {
+                r.telephonyObserver_->OnNetworkStateUpdated(slotId, networkStateNotify);
+            }
+            memory_.Sub(MemoryCategory::EXT_COPIES, extBytes);
         }
     }
     SendNetworkStateChanged(slotId, networkState);
-    TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateNetworkState end");
     return result;
 }
 
@@ -438,19 +1012,7 @@ int32_t TelephonyStateRegistryService::UpdateCfuIndicator(int32_t slotId, bool c
         TELEPHONY_LOGE("Check permission failed.");
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
-    std::unique_lock<std::shared_mutex> uniLock(lock_);
-    cfuResult_[slotId] = cfuResult;
-    uniLock.unlock();
-    std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
-    for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnCfuIndicatorUpdated(slotId, cfuResult);
-            result = TELEPHONY_SUCCESS;
-        }
-    }
+    int32_t result = UpdateChannel<CfuIndicatorChannel>(cfuResult_, slotId, cfuResult);
     TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateCfuIndicator end");
     return result;
 }
@@ -461,17 +1023,27 @@ int32_t TelephonyStateRegistryService::UpdateIccAccount()
         TELEPHONY_LOGE("Check permission failed.");
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
+    std::unique_lock<std::shared_mutex> uniLock(lock_);
+    TelephonyObserverUpdateStamp stamp = NextStamp(TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT, -1);
+    uniLock.unlock();
+    admission_.Enter(TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT, -1, false);
     std::shared_lock<std::shared_mutex> lock(lock_);
+    TelephonyObserverUpdateStampScope stampScope(stamp);
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
         if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT) &&
             (record.telephonyObserver_ != nullptr)) {
+            if (IsDeliveryDeferred(record, TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT, -1)) {
+                result = TELEPHONY_SUCCESS;
+                continue;
+            }
             record.telephonyObserver_->OnIccAccountUpdated();
             result = TELEPHONY_SUCCESS;
         }
     }
     TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateIccAccount end");
+    admission_.Leave(TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT, -1);
     return result;
 }
 
@@ -485,47 +1057,539 @@ int32_t TelephonyStateRegistryService::UpdateVoiceMailMsgIndicator(int32_t slotI
         TELEPHONY_LOGE("Check permission failed.");
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
-    std::unique_lock<std::shared_mutex> uniLock(lock_);
-    voiceMailMsgResult_[slotId] = voiceMailMsgResult;
-    uniLock.unlock();
-    std::shared_lock<std::shared_mutex> lock(lock_);
+    int32_t result = UpdateChannel<VoiceMailMsgIndicatorChannel>(voiceMailMsgResult_, slotId, voiceMailMsgResult);
+    TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateVoiceMailMsgIndicator end");
+    return result;
+}
+
+int32_t TelephonyStateRegistryService::UpdateSimActiveState(int32_t slotId, bool activeStateResult)
+{
+    if (!VerifySlotId(slotId)) {
+        TELEPHONY_LOGE("UpdateSimActiveState##VerifySlotId failed ##slotId = %{public}d", slotId);
+        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
+    }
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    return UpdateChannel<SimActiveStateChannel>(simActiveResult_, slotId, activeStateResult);
+}
+
+int32_t TelephonyStateRegistryService::DeliverLevelUpdate(uint32_t mask, int32_t slotId)
+{
+    if (!admission_.Enter(mask, slotId, true)) {
+        return TELEPHONY_SUCCESS;
+    }
     int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    do {
+        switch (mask) {
+            case TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS:
+                result = NotifySignalInfoUpdated(slotId);
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO:
+                result = NotifyCellInfoUpdated(slotId);
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE:
+                result = NotifyNetworkStateUpdated(slotId);
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW:
+                result = NotifyCellularDataFlowUpdated(slotId);
+                break;
+            default:
+                break;
+        }
+    } while (admission_.Leave(mask, slotId));
+    return result;
+}
+
+bool TelephonyStateRegistryService::IsLimited(uint32_t mask, int32_t slotId, bool changed, int32_t &result)
+{
+    LimiterConfig config;
+    if (!limiter_.GetConfig(mask, config) || !config.IsEnabled()) {
+        return false;
+    }
+    // without the handler a deferred value could not be delivered later, so level-type updates pass
+    if (config.coalescible && handler_ == nullptr) {
+        return false;
+    }
+    int64_t delayMs = 0;
+    LimiterDecision decision = limiter_.Admit(mask, slotId, changed, GetSteadyTimeMs(), delayMs);
+    if (decision == LimiterDecision::DELIVER) {
+        return false;
+    }
+    if (decision == LimiterDecision::DEFER && delayMs > 0) {
+        std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+        memory_.Add(MemoryCategory::QUEUED, TRAILING_TASK_BYTES);
+        admission_.AddQueued();
+        handler_->PostTask([weak, mask, slotId]() {
+            auto self = weak.lock();
+            if (self == nullptr) {
+                return;
+            }
+            self->memory_.Sub(MemoryCategory::QUEUED, TRAILING_TASK_BYTES);
+            self->admission_.RemoveQueued();
+            self->limiter_.OnTrailing(mask, slotId, GetSteadyTimeMs());
+            self->DeliverLevelUpdate(mask, slotId);
+        }, delayMs);
+    }
+    result = HasStateListener(mask, slotId);
+    return true;
+}
+
+int32_t TelephonyStateRegistryService::HasStateListener(uint32_t mask, int32_t slotId)
+{
+    bool matchDefaultConn = (mask == TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE) ||
+        (mask == TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    for (const auto &record : stateRecords_) {
+        if (record.IsExistStateListener(mask) &&
+            (record.IsSlotMatched(slotId) ||
+            (matchDefaultConn && IsDefaultDataSlotMatched(record, slotId)))) {
+            return TELEPHONY_SUCCESS;
+        }
+    }
+    return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+}
+
+void TelephonyStateRegistryService::InitLimiter()
+{
+    struct LimiterParam {
+        uint32_t mask;
+        const char *name;
+        int64_t debounceMs;
+        bool coalescible;
+    };
+    // the storm-prone types get a short debounce window, the others are limited only when configured
+    static const LimiterParam limiterParams[] = {
+        { TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, "network_state", NETWORK_STATE_DEBOUNCE_MS, true },
+        { TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, "sim_state", SIM_STATE_DEBOUNCE_MS, false },
+        { TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE, "data_connection_state",
+            DATA_CONNECTION_DEBOUNCE_MS, false },
+        { TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW, "data_flow", 0, true },
+        { TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR, "cfu_indicator", 0, false },
+        { TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR, "voice_mail_msg_indicator", 0, false },
+        { TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE, "sim_active_state", 0, false },
+    };
+    for (const auto &param : limiterParams) {
+        std::string prefix = std::string(LIMITER_PARAM_PREFIX) + param.name;
+        LimiterConfig config;
+        config.coalescible = param.coalescible;
+        config.debounceMs = system::GetIntParameter<int64_t>(prefix + ".debounce_ms", param.debounceMs);
+        config.burst = system::GetIntParameter<uint32_t>(prefix + ".burst", config.burst);
+        config.refillPerSecond = system::GetIntParameter<uint32_t>(prefix + ".refill", config.refillPerSecond);
+        limiter_.SetConfig(param.mask, config);
+    }
+}
+
+const TelephonyStateRegistryLimiter &TelephonyStateRegistryService::GetLimiter() const
+{
+    return limiter_;
+}
+
+bool TelephonyStateRegistryService::IsDeliveryDeferred(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    return IsInitialDeliveryPending(record, mask, slotId) || IsProcessDeferred(record, mask, slotId) ||
+        IsPacingDeferred(record, mask, slotId) || IsWakeupDeferred(record, mask, slotId);
+}
+
+bool TelephonyStateRegistryService::IsWakeupDeferred(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    // waking an observer in this process costs nothing, and without the handler the window would never close
+    if (handler_ == nullptr || GetRemoteObserverProxy(record.telephonyObserver_) == nullptr) {
+        return false;
+    }
+    int64_t closeDelayMs = 0;
+    if (!wakeup_.Hold(record.pid_, mask, slotId, GetSteadyTimeMs(), closeDelayMs)) {
+        return false;
+    }
+    if (closeDelayMs > 0) {
+        std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+        pid_t pid = record.pid_;
+        handler_->PostTask([weak, pid]() {
+            auto self = weak.lock();
+            if (self != nullptr) {
+                self->CloseWakeupWindow(pid);
+            }
+        }, closeDelayMs);
+    }
+    return true;
+}
+
+void TelephonyStateRegistryService::CloseWakeupWindow(pid_t pid)
+{
+    std::set<TelephonyStateRegistryWakeup::PendingKey> keys;
+    if (!wakeup_.Close(pid, GetSteadyTimeMs(), keys)) {
+        return;
+    }
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    // the process runs anyway when the window closes, the updates need not wake it a second time
+    TelephonyObserverProxy::WakeupLaterScope wakeupScope;
     for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnVoiceMailMsgIndicatorUpdated(slotId, voiceMailMsgResult);
-            result = TELEPHONY_SUCCESS;
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.pid_ != pid || record.telephonyObserver_ == nullptr) {
+            continue;
+        }
+        for (const auto &key : keys) {
+            if (IsDeferredSlotMatched(record, key.first, key.second) &&
+                !IsInitialDeliveryPending(record, key.first, key.second) &&
+                !IsProcessDeferred(record, key.first, key.second)) {
+                NotifyCachedState(record, key.first, key.second);
+            }
         }
     }
-    TELEPHONY_LOGI("TelephonyStateRegistryService::UpdateVoiceMailMsgIndicator end");
-    return result;
 }
 
-int32_t TelephonyStateRegistryService::UpdateSimActiveState(int32_t slotId, bool activeStateResult)
+bool TelephonyStateRegistryService::IsPacingDeferred(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    DeliveryPolicy policy = GetRecordState(record).options_.GetDeliveryPolicy(mask);
+    if (record.pacingId_ == 0 || policy.mode == DELIVERY_MODE_EVERY || handler_ == nullptr) {
+        return false;
+    }
+    // a latest only type counts a delivery as pending for a fixed window, the registry cannot see it being consumed
+    int64_t periodMs = policy.mode == DELIVERY_MODE_PERIODIC ? policy.periodMs : DELIVERY_LATEST_ONLY_WINDOW_MS;
+    bool startTick = false;
+    if (!timerWheel_.Hold(std::make_tuple(record.pacingId_, mask, slotId), periodMs, GetSteadyTimeMs(), startTick)) {
+        return false;
+    }
+    if (startTick) {
+        PostTimerWheelTick();
+    }
+    return true;
+}
+
+void TelephonyStateRegistryService::PostTimerWheelTick()
+{
+    std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+    handler_->PostTask([weak]() {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->OnTimerWheelTick();
+        }
+    }, TelephonyStateRegistryTimerWheel::TICK_MS);
+}
+
+void TelephonyStateRegistryService::OnTimerWheelTick()
+{
+    std::vector<TelephonyStateRegistryTimerWheel::PacedKey> due;
+    bool ticking = timerWheel_.Advance(GetSteadyTimeMs(), due);
+    if (ticking) {
+        PostTimerWheelTick();
+    }
+    if (due.empty()) {
+        return;
+    }
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.pacingId_ == 0 || record.telephonyObserver_ == nullptr) {
+            continue;
+        }
+        for (const auto &key : due) {
+            uint32_t mask = std::get<1>(key);
+            int32_t slotId = std::get<2>(key);
+            if (std::get<0>(key) != record.pacingId_ || !IsDeferredSlotMatched(record, mask, slotId) ||
+                IsInitialDeliveryPending(record, mask, slotId) || IsProcessDeferred(record, mask, slotId) ||
+                IsWakeupDeferred(record, mask, slotId)) {
+                continue;
+            }
+            NotifyCachedState(record, mask, slotId);
+        }
+    }
+}
+
+bool TelephonyStateRegistryService::IsProcessDeferred(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    bool added = false;
+    if (!processState_.Defer(record.pid_, mask, slotId, added)) {
+        return false;
+    }
+    if (added) {
+        memory_.AddQueued(record.pid_, record.GetBundleName(), PENDING_KEY_BYTES);
+    }
+    return true;
+}
+
+bool TelephonyStateRegistryService::IsDefaultDataSlotMatched(
+    const TelephonyStateRegistryRecord &record, int32_t slotId) const
+{
+    if (record.slotId_ != SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT) {
+        return false;
+    }
+    return defaultDataSlotId_ < 0 || defaultDataSlotId_ == slotId;
+}
+
+bool TelephonyStateRegistryService::IsDeferredSlotMatched(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    if (!record.IsExistStateListener(mask)) {
+        return false;
+    }
+    if (mask == TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT) {
+        return true;
+    }
+    // 999 means observe the default cellular data slot
+    if (mask == TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE ||
+        mask == TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW) {
+        return record.IsSlotMatched(slotId) || IsDefaultDataSlotMatched(record, slotId);
+    }
+    return record.IsSlotMatched(slotId);
+}
+
+__attribute__((no_sanitize("cfi")))
+void TelephonyStateRegistryService::NotifyCachedState(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    TelephonyObserverUpdateStampScope stampScope(GetStamp(mask, slotId));
+    switch (mask) {
+        case TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE: {
+            auto it = callState_.find(slotId);
+            auto numberIt = callIncomingNumber_.find(slotId);
+            if (it != callState_.end()) {
+                std::u16string phoneNumber = Str8ToStr16("");
+                if (numberIt != callIncomingNumber_.end() && record.IsCanReadCallHistory()) {
+                    phoneNumber = numberIt->second;
+                }
+                record.telephonyObserver_->OnCallStateUpdated(slotId, it->second, phoneNumber);
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX: {
+            auto it = callState_.find(slotId);
+            if (it != callState_.end()) {
+                record.telephonyObserver_->OnCallStateUpdatedEx(slotId, it->second);
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE: {
+            auto it = callState_.find(slotId);
+            auto numberIt = callIncomingNumber_.find(slotId);
+            // replayed to the record like the live update, so a permission revoked meanwhile is honored
+            if (it != callState_.end() && numberIt != callIncomingNumber_.end() && record.CanManageCallForDevices()) {
+                record.telephonyObserver_->OnCCallStateUpdated(slotId, GetCCallState(it->second), numberIt->second);
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS: {
+            auto it = signalInfos_.find(slotId);
+            if (GetRecordState(record).options_.signalStatisticsPeriodMs_ != 0) {
+                DeliverSignalStatistics(record, slotId);
+            } else if (it != signalInfos_.end()) {
+                if (TELEPHONY_EXT_WRAPPER.onSignalInfoUpdated_ != nullptr) {
+                    std::vector<sptr<SignalInformation>> vec = it->second->GetList();
+                    TELEPHONY_EXT_WRAPPER.onSignalInfoUpdated_(slotId, record, vec, it->second->GetList());
+                    record.telephonyObserver_->OnSignalInfoUpdated(slotId, vec);
+                } else {
+                    DeliverSignalInfo(record, GetRecordState(record), slotId, *it->second);
+                }
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO: {
+            auto it = cellInfos_.find(slotId);
+            if (it != cellInfos_.end()) {
+                if (TELEPHONY_EXT_WRAPPER.onCellInfoUpdated_ != nullptr) {
+                    std::vector<sptr<CellInformation>> vec = it->second->GetList();
+                    TELEPHONY_EXT_WRAPPER.onCellInfoUpdated_(slotId, record, vec, it->second->GetList());
+                    record.telephonyObserver_->OnCellInfoUpdated(slotId, vec);
+                } else {
+                    DeliverCellInfo(record, GetRecordState(record), slotId, *it->second);
+                }
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE: {
+            auto it = searchNetworkState_.find(slotId);
+            if (it != searchNetworkState_.end() && it->second != nullptr) {
+                sptr<NetworkState> networkState = it->second;
+                if (TELEPHONY_EXT_WRAPPER.onNetworkStateUpdated_ != nullptr) {
+                    networkState = new NetworkState();
+                    MessageParcel data;
+                    it->second->Marshalling(data);
+                    networkState->ReadFromParcel(data);
+                    TELEPHONY_EXT_WRAPPER.onNetworkStateUpdated_(slotId, record, networkState, it->second);
+                }
+                if (GetRecordState(record).IsNetworkStateChanged(record, slotId, networkState)) {
+                    record.telephonyObserver_->OnNetworkStateUpdated(slotId, networkState);
+                }
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE: {
+            auto it = simState_.find(slotId);
+            auto typeIt = cardType_.find(slotId);
+            auto reasonIt = simReason_.find(slotId);
+            if (it != simState_.end() && typeIt != cardType_.end() && reasonIt != simReason_.end()) {
+                record.telephonyObserver_->OnSimStateUpdated(slotId, typeIt->second, it->second, reasonIt->second);
+            }
+            break;
+        }
+        default:
+            NotifyCachedStateEx(record, mask, slotId);
+            break;
+    }
+}
+
+__attribute__((no_sanitize("cfi")))
+void TelephonyStateRegistryService::NotifyCachedStateEx(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    switch (mask) {
+        case TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE: {
+            auto it = cellularDataConnectionState_.find(slotId);
+            auto typeIt = cellularDataConnectionNetworkType_.find(slotId);
+            if (it != cellularDataConnectionState_.end() && typeIt != cellularDataConnectionNetworkType_.end()) {
+                int32_t networkType = typeIt->second;
+                if (TELEPHONY_EXT_WRAPPER.onCellularDataConnectStateUpdated_ != nullptr) {
+                    TELEPHONY_EXT_WRAPPER.onCellularDataConnectStateUpdated_(slotId, record, networkType);
+                }
+                if (GetRecordState(record).IsDataConnectStateChanged(record, slotId, it->second, networkType)) {
+                    record.telephonyObserver_->OnCellularDataConnectStateUpdated(slotId, it->second, networkType);
+                }
+            }
+            break;
+        }
+        case TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW:
+            NotifyCachedChannel<CellularDataFlowChannel>(record, cellularDataFlow_, slotId);
+            break;
+        case TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR:
+            NotifyCachedChannel<CfuIndicatorChannel>(record, cfuResult_, slotId);
+            break;
+        case TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR:
+            NotifyCachedChannel<VoiceMailMsgIndicatorChannel>(record, voiceMailMsgResult_, slotId);
+            break;
+        case TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT:
+            record.telephonyObserver_->OnIccAccountUpdated();
+            break;
+        case TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE:
+            NotifyCachedChannel<SimActiveStateChannel>(record, simActiveResult_, slotId);
+            break;
+        default:
+            break;
+    }
+}
+
+void TelephonyStateRegistryService::OnProcessStateChanged(pid_t pid, bool deferred)
+{
+    std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+    processState_.SetDeferred(pid, deferred, pending);
+    if (!deferred) {
+        memory_.ClearQueued(pid);
+    }
+    if (pending.empty()) {
+        return;
+    }
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    // every observer of the process gets what it missed in one transaction
+    TelephonyObserverProxy::BatchScope batchScope;
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.pid_ != pid || record.telephonyObserver_ == nullptr) {
+            continue;
+        }
+        for (const auto &key : pending) {
+            if (IsDeferredSlotMatched(record, key.first, key.second) &&
+                !IsInitialDeliveryPending(record, key.first, key.second)) {
+                NotifyCachedState(record, key.first, key.second);
+            }
+        }
+    }
+}
+
+void TelephonyStateRegistryService::SetProcessStateSource(const std::shared_ptr<ProcessStateSource> &source)
+{
+    std::lock_guard<std::mutex> lock(processStateSourceMutex_);
+    if (processStateSource_ != nullptr) {
+        processStateSource_->Stop();
+    }
+    processStateSource_ = source;
+    if (processStateSource_ == nullptr) {
+        return;
+    }
+    std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+    bool ret = processStateSource_->Start([weak](pid_t pid, bool deferred) {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->OnProcessStateChanged(pid, deferred);
+        }
+    });
+    TELEPHONY_LOGI("process state source start %{public}d", ret);
+}
+
+void TelephonyStateRegistryService::SetPackageChangeSource(const std::shared_ptr<PackageChangeSource> &source)
+{
+    std::lock_guard<std::mutex> lock(packageChangeSourceMutex_);
+    if (packageChangeSource_ != nullptr) {
+        packageChangeSource_->Stop();
+    }
+    packageChangeSource_ = source;
+    // a cached identity could outlive its package unless package changes are observed
+    identityCache_.SetEnabled(false);
+    if (packageChangeSource_ == nullptr) {
+        return;
+    }
+    std::weak_ptr<TelephonyStateRegistryService> weak = weak_from_this();
+    bool ret = packageChangeSource_->Start([weak](const std::string &bundleName, int32_t uid) {
+        auto self = weak.lock();
+        if (self != nullptr) {
+            self->OnPackageChanged(bundleName, uid);
+        }
+    });
+    identityCache_.SetEnabled(ret);
+    TELEPHONY_LOGI("package change source start %{public}d", ret);
+}
+
+void TelephonyStateRegistryService::OnPackageChanged(const std::string &bundleName, int32_t uid)
+{
+    identityCache_.Invalidate(bundleName, uid);
+}
+
+const TelephonyStateRegistryIdentityCache &TelephonyStateRegistryService::GetIdentityCache() const
+{
+    return identityCache_;
+}
+
+const TelephonyStateRegistryProcessState &TelephonyStateRegistryService::GetProcessState() const
+{
+    return processState_;
+}
+
+const TelephonyStateRegistryMemory &TelephonyStateRegistryService::GetMemory() const
+{
+    return memory_;
+}
+
+const TelephonyStateRegistryQuota &TelephonyStateRegistryService::GetQuota() const
+{
+    return quota_;
+}
+
+void TelephonyStateRegistryService::InitWakeup()
 {
-    if (!VerifySlotId(slotId)) {
-        TELEPHONY_LOGE("UpdateSimActiveState##VerifySlotId failed ##slotId = %{public}d", slotId);
-        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
-    }
-    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
-        TELEPHONY_LOGE("Check permission failed.");
-        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
-    }
-    std::unique_lock<std::shared_mutex> uniLock(lock_);
-    simActiveResult_[slotId] = activeStateResult;
-    uniLock.unlock();
-    std::shared_lock<std::shared_mutex> lock(lock_);
-    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
-    for (size_t i = 0; i < stateRecords_.size(); i++) {
-        TelephonyStateRegistryRecord record = stateRecords_[i];
-        if (record.IsExistStateListener(TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE) &&
-            (record.slotId_ == slotId) && record.telephonyObserver_ != nullptr) {
-            record.telephonyObserver_->OnSimActiveStateUpdated(slotId, activeStateResult);
-            result = TELEPHONY_SUCCESS;
-        }
+    struct WakeupParam {
+        uint32_t mask;
+        const char *name;
+        int64_t budgetMs;
+    };
+    // types not listed here, e.g. call state, are always delivered right away
+    static const WakeupParam wakeupParams[] = {
+        { TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS, "signal_info", SIGNAL_WAKEUP_BUDGET_MS },
+        { TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, "cell_info", CELL_INFO_WAKEUP_BUDGET_MS },
+        { TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW, "data_flow", DATA_FLOW_WAKEUP_BUDGET_MS },
+    };
+    for (const auto &param : wakeupParams) {
+        std::string name = std::string(WAKEUP_PARAM_PREFIX) + param.name + ".budget_ms";
+        wakeup_.SetBudget(param.mask, system::GetIntParameter<int64_t>(name, param.budgetMs));
     }
-    return result;
+}
+
+void TelephonyStateRegistryService::InitQuota()
+{
+    quota_.SetLimits(system::GetIntParameter<uint32_t>(QUOTA_UID_RECORDS_PARAM, UID_RECORD_QUOTA),
+        system::GetIntParameter<uint32_t>(QUOTA_PID_RECORDS_PARAM, PID_RECORD_QUOTA));
 }
 
 bool TelephonyStateRegistryService::CheckCallerIsSystemApp(uint32_t mask)
@@ -571,6 +1635,15 @@ int32_t TelephonyStateRegistryService::RegisterStateChange(
     const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId,
     uint32_t mask, const std::string &bundleName, bool isUpdate, pid_t pid, int32_t uid, int32_t tokenId,
     const std::string &appIdentifier)
+{
+    return RegisterStateChange(telephonyObserver, slotId, mask, bundleName, isUpdate, pid, uid, tokenId,
+        appIdentifier, TelephonyObserverOptions());
+}
+
+int32_t TelephonyStateRegistryService::RegisterStateChange(
+    const sptr<TelephonyObserverBroker> &telephonyObserver, int32_t slotId,
+    uint32_t mask, const std::string &bundleName, bool isUpdate, pid_t pid, int32_t uid, int32_t tokenId,
+    const std::string &appIdentifier, const TelephonyObserverOptions &options)
 {
     if (!CheckCallerIsSystemApp(mask)) {
         return TELEPHONY_ERR_ILLEGAL_USE_OF_SYSTEM_API;
@@ -578,44 +1651,325 @@ int32_t TelephonyStateRegistryService::RegisterStateChange(
     if (!CheckPermission(mask)) {
         return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
     }
-    if (!IsMultiSimsCapabilitySupported(slotId)) {
+    bool isAllSlots = slotId == SIM_SLOT_ID_FOR_ALL_SLOTS;
+    if (!isAllSlots && !IsMultiSimsCapabilitySupported(slotId)) {
         return TELEPHONY_SUCCESS;
     }
     if ((slotId > MAX_SLOT_COUNT + 1 || slotId < -1) &&
-        slotId != SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT) {
+        slotId != SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT && !isAllSlots) {
         return TELEPHONY_SUCCESS;
     }
+    // an all slots record only gets the VSim slot if the caller could register for it directly
+    bool canObserveVSim = isAllSlots && IsMultiSimsCapabilitySupported(MAX_SLOT_COUNT);
     std::unique_lock<std::shared_mutex> lock(lock_);
     bool isExist = false;
     TelephonyStateRegistryRecord record;
-    for (size_t i = 0; i < stateRecords_.size(); i++) {
-        record = stateRecords_[i];
-        if (record.slotId_ == slotId && record.mask_ == mask && record.tokenId_ == tokenId && record.pid_ == pid) {
-            isExist = true;
-            break;
+    size_t index = 0;
+    bool isFound = FindRecord(slotId, mask, tokenId, pid, index);
+    if (isFound && (stateRecords_[index].mask_ == mask ||
+        (options.IsDefault() && GetRecordState(stateRecords_[index]).options_.IsDefault()))) {
+        // the latest registration decides which fields the record is notified for
+        TelephonyStateRegistryRecordState &state = GetMutableRecordState(stateRecords_[index]);
+        uint64_t oldBytes = GetRecordBytes(state);
+        state.SetOptions(options);
+        AttachEventRing(stateRecords_[index], state);
+        AssignPacingId(stateRecords_[index], state.options_);
+        memory_.ResizeRecord(stateRecords_[index].GetBundleName(), oldBytes, GetRecordBytes(state));
+        if (isUpdate) {
+            BeginInitialDelivery(stateRecords_[index]);
         }
+        record = stateRecords_[index];
+        isExist = true;
+    }
+    // releasing the mask keeps the record, so the record it merges into does not depend on it
+    size_t mergeIndex = 0;
+    bool isMergeable = !isExist && IsMergeableOptions(options) &&
+        FindMergeableRecord(telephonyObserver, slotId, tokenId, pid, mergeIndex);
+    // checked before anything changes, a refused registration leaves the mask with its delivery where it was
+    if (!isExist && !isMergeable && !quota_.Acquire(uid, pid, bundleName)) {
+        return TELEPHONY_STATE_REGISTRY_QUOTA_EXCEEDED;
+    }
+    if (isFound && !isExist) {
+        // registered again with other options, the mask leaves the record it shares
+        ReleaseMask(stateRecords_[index], mask);
+    }
+    if (isMergeable) {
+        // the observer object already has a record for the slot, it only gets the new mask and its delivery
+        stateRecords_[mergeIndex].mask_ |= mask;
+        MergeDeliveryPolicy(stateRecords_[mergeIndex], mask, options);
+        if (isUpdate) {
+            BeginInitialDelivery(stateRecords_[mergeIndex]);
+        }
+        record = stateRecords_[mergeIndex];
+        isExist = true;
     }
 
     if (!isExist) {
+        record.identity_ = identities_.Intern(pid, uid, tokenId, bundleName, appIdentifier);
         record.pid_ = pid;
-        record.uid_ = uid;
         record.slotId_ = slotId;
         record.mask_ = mask;
-        record.bundleName_ = bundleName;
         record.tokenId_ = tokenId;
-        record.appIdentifier_ = appIdentifier;
         record.telephonyObserver_ = telephonyObserver;
+        record.canObserveVSim_ = canObserveVSim;
+        record.recordId_ = ++recordSeq_;
+        TelephonyStateRegistryRecordState &state = recordStates_[record.recordId_];
+        state.SetOptions(options);
+        AttachEventRing(record, state);
+        AssignPacingId(record, state.options_);
+        if (isUpdate) {
+            BeginInitialDelivery(record);
+        }
         stateRecords_.push_back(record);
+        memory_.AddRecord(record.GetBundleName(), GetRecordBytes(state));
+    }
+    const TelephonyStateRegistryRecordState &state = GetRecordState(record);
+    TelephonyObserverProxy *observerProxy = GetRemoteObserverProxy(record.telephonyObserver_);
+    if (observerProxy != nullptr) {
+        observerProxy->SetDeltaEncoding(state.options_.deltaEncoding_);
+        observerProxy->SetProjection(state.options_.signalInfoProjection_, state.options_.networkStateProjection_);
     }
     TELEPHONY_LOGI("RegisterStateChange mask %{public}d", record.mask_);
+    // a merged record only takes the initial snapshot of the mask registered now
+    record.mask_ = mask;
+    size_t recordSize = stateRecords_.size();
+    std::map<int32_t, SlotSnapshot> snapshots;
+    // the initial delivery runs without lock_, so it works on a copy of the options
+    TelephonyStateRegistryRecordState snapshotState;
     if (isUpdate) {
-        UpdateData(record);
+        CaptureSnapshot(record, snapshots);
+        snapshotState = state;
+    }
+    lock.unlock();
+    if (isUpdate) {
+        UpdateData(record, snapshotState, snapshots);
+        FinishInitialDelivery(record.snapshotSeq_);
+    }
+    if (options.signalStatisticsPeriodMs_ != 0) {
+        StartSignalStatisticsTick();
+    }
+    AdvertiseInterest(mask);
+    TELEPHONY_LOGD("[slot%{public}d] Register successfully, callback list size is %{public}zu", slotId, recordSize);
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryService::UpdateDefaultDataSlotId(int32_t slotId)
+{
+    if (!VerifySlotId(slotId)) {
+        TELEPHONY_LOGE("UpdateDefaultDataSlotId##VerifySlotId failed ##slotId = %{public}d", slotId);
+        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
+    }
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    std::unique_lock<std::shared_mutex> uniLock(lock_);
+    if (defaultDataSlotId_ == slotId) {
+        return TELEPHONY_SUCCESS;
+    }
+    TELEPHONY_LOGI("default data slot changed from %{public}d to %{public}d", defaultDataSlotId_, slotId);
+    defaultDataSlotId_ = slotId;
+    uniLock.unlock();
+    // the default slot switched, so 999 subscribers get the state of the new one
+    const uint32_t masks[] = { TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE,
+        TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW };
+    AdvertiseInterest(masks[0] | masks[1]);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.slotId_ != SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT || record.telephonyObserver_ == nullptr) {
+            continue;
+        }
+        for (uint32_t mask : masks) {
+            if (!record.IsExistStateListener(mask)) {
+                continue;
+            }
+            result = TELEPHONY_SUCCESS;
+            if (IsDeliveryDeferred(record, mask, slotId)) {
+                continue;
+            }
+            NotifyCachedState(record, mask, slotId);
+        }
+    }
+    return result;
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::ResyncStateObserver(
+    const sptr<IRemoteObject> &remote, int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid)
+{
+    if (mask != TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE &&
+        mask != TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    if (!VerifySlotId(slotId)) {
+        TELEPHONY_LOGE("ResyncStateObserver##VerifySlotId failed ##slotId = %{public}d", slotId);
+        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
+    }
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    int32_t result = TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.tokenId_ != tokenId || record.pid_ != pid || !record.IsExistStateListener(mask) ||
+            !record.IsSlotMatched(slotId) || record.telephonyObserver_->AsObject() != remote) {
+            continue;
+        }
+        TelephonyObserverProxy *observerProxy = GetRemoteObserverProxy(record.telephonyObserver_);
+        if (observerProxy != nullptr) {
+            observerProxy->ResetDeltaEncoding(slotId);
+        }
+        result = TELEPHONY_SUCCESS;
+        if (IsDeliveryDeferred(record, mask, slotId)) {
+            continue;
+        }
+        NotifyCachedState(record, mask, slotId);
+    }
+    return result;
+}
+
+__attribute__((no_sanitize("cfi")))
+int32_t TelephonyStateRegistryService::ResyncEventRing(
+    const sptr<IRemoteObject> &remote, uint32_t ringId, int32_t tokenId, pid_t pid)
+{
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        const std::shared_ptr<TelephonyObserverRing> &ring = GetRecordState(record).ring_;
+        if (ring == nullptr || ring->GetId() != ringId || record.tokenId_ != tokenId ||
+            record.pid_ != pid || record.telephonyObserver_->AsObject() != remote) {
+            continue;
+        }
+        // the observer dropped records, it gets the cached value of every type and slot of the ring
+        const uint32_t masks[] = { TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS,
+            TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO };
+        for (int32_t slotId = 0; slotId <= MAX_SLOT_COUNT; slotId++) {
+            if (!VerifySlotId(slotId) || !record.IsSlotMatched(slotId)) {
+                continue;
+            }
+            for (uint32_t mask : masks) {
+                if ((ring->GetMask() & mask) == 0 || IsDeliveryDeferred(record, mask, slotId)) {
+                    continue;
+                }
+                NotifyCachedState(record, mask, slotId);
+            }
+        }
+        return TELEPHONY_SUCCESS;
+    }
+    return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+}
+
+int32_t TelephonyStateRegistryService::GetStateMirror(sptr<Ashmem> &ashmem)
+{
+    // call, SIM and data state need no permission, the caller gets the region of the types it may observe
+    bool isSystem = TelephonyPermission::CheckCallerIsSystemApp() &&
+        TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE);
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    const std::shared_ptr<TelephonyObserverMirror> &mirror = isSystem ? systemMirror_ : mirror_;
+    if (mirror == nullptr) {
+        return TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST;
+    }
+    ashmem = mirror->GetAshmem();
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryService::GetSignalStatistics(
+    int32_t slotId, std::vector<TelephonyObserverSignalStatistics> &statistics)
+{
+    if (!VerifySlotId(slotId)) {
+        TELEPHONY_LOGE("GetSignalStatistics##VerifySlotId failed ##slotId = %{public}d", slotId);
+        return TELEPHONY_STATE_REGISTRY_SLODID_ERROR;
+    }
+    signalStatistics_.Get(slotId, GetSteadyTimeMs(), statistics);
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryService::GetSubscriberInterest(
+    uint32_t mask, std::vector<TelephonyObserverInterest> &interests)
+{
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    TelephonyStateRegistryInterest::InterestMap current;
+    CollectInterest(mask, current);
+    for (const auto &[key, interest] : current) {
+        interests.push_back(interest);
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryService::AddInterestObserver(const sptr<IRemoteObject> &remote, uint32_t mask)
+{
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    sptr<TelephonyObserverBroker> observer = iface_cast<TelephonyObserverBroker>(remote);
+    if (mask == 0 || observer == nullptr) {
+        return TELEPHONY_ERR_ARGUMENT_INVALID;
+    }
+    interest_.AddObserver(observer, mask);
+    AdvertiseInterest(mask);
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryService::RemoveInterestObserver(const sptr<IRemoteObject> &remote)
+{
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    if (!interest_.RemoveObserver(remote)) {
+        return TELEPHONY_STATE_UNREGISTRY_DATA_NOT_EXIST;
     }
-    TELEPHONY_LOGD("[slot%{public}d] Register successfully, callback list size is %{public}zu", slotId,
-        stateRecords_.size());
     return TELEPHONY_SUCCESS;
 }
 
+void TelephonyStateRegistryService::CollectInterest(
+    uint32_t mask, TelephonyStateRegistryInterest::InterestMap &interests)
+{
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    for (uint32_t bit = 1; bit != 0 && bit <= mask; bit <<= 1) {
+        if ((mask & bit) == 0) {
+            continue;
+        }
+        bool matchDefaultConn = (bit == TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE) ||
+            (bit == TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW);
+        for (int32_t slotId = 0; slotId < slotSize_; slotId++) {
+            TelephonyObserverInterest &interest = interests[std::make_pair(bit, slotId)];
+            interest.mask = bit;
+            interest.slotId = slotId;
+            for (const auto &record : stateRecords_) {
+                if (record.IsExistStateListener(bit) && (record.IsSlotMatched(slotId) ||
+                    (matchDefaultConn && IsDefaultDataSlotMatched(record, slotId)))) {
+                    TelephonyStateRegistryInterest::AddSubscriber(interest, GetRecordState(record).options_);
+                }
+            }
+        }
+    }
+}
+
+__attribute__((no_sanitize("cfi")))
+void TelephonyStateRegistryService::AdvertiseInterest(uint32_t mask)
+{
+    // nothing to collect unless a producer watches one of the types
+    if ((interest_.GetWatchedMask() & mask) == 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> interestLock(interestMutex_);
+    TelephonyStateRegistryInterest::InterestMap current;
+    CollectInterest(interest_.GetWatchedMask(), current);
+    std::vector<TelephonyStateRegistryInterest::Notification> notifications;
+    interest_.Update(current, notifications);
+    for (const auto &[observer, interests] : notifications) {
+        TelephonyObserverProxy *proxy = GetRemoteObserverProxy(observer);
+        if (proxy != nullptr) {
+            proxy->OnSubscriberInterestUpdated(interests);
+        }
+    }
+}
+
 int32_t TelephonyStateRegistryService::UnregisterStateChange(int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid)
 {
     if (!CheckCallerIsSystemApp(mask)) {
@@ -628,17 +1982,66 @@ int32_t TelephonyStateRegistryService::UnregisterStateChange(int32_t slotId, uin
     int32_t result = TELEPHONY_STATE_UNREGISTRY_DATA_NOT_EXIST;
     std::vector<TelephonyStateRegistryRecord>::iterator it;
     for (it = stateRecords_.begin(); it != stateRecords_.end(); ++it) {
-        if (it->slotId_ == slotId && it->mask_ == mask && it->tokenId_ == tokenId && it->pid_ == pid) {
-            stateRecords_.erase(it);
+        if (it->slotId_ != slotId || (it->mask_ & mask) != mask || it->tokenId_ != tokenId || it->pid_ != pid) {
+            continue;
+        }
+        if (it->mask_ != mask) {
+            // other registrations merged into the record keep it
+            ReleaseMask(*it, mask);
             result = TELEPHONY_SUCCESS;
             break;
         }
+        memory_.RemoveRecord(it->GetBundleName(), GetRecordBytes(GetRecordState(*it)));
+        quota_.Release(it->GetUid(), it->pid_);
+        if (it->pacingId_ != 0) {
+            timerWheel_.Remove(it->pacingId_);
+        }
+        recordStates_.erase(it->recordId_);
+        stateRecords_.erase(it);
+        result = TELEPHONY_SUCCESS;
+        break;
     }
     TELEPHONY_LOGD("[slot%{public}d] Unregister successfully, callback list size is %{public}zu", slotId,
         stateRecords_.size());
+    lock.unlock();
+    if (result == TELEPHONY_SUCCESS) {
+        AdvertiseInterest(mask);
+    }
     return result;
 }
 
+bool TelephonyStateRegistryService::FindRecord(
+    int32_t slotId, uint32_t mask, int32_t tokenId, pid_t pid, size_t &index) const
+{
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        if (stateRecords_[i].slotId_ == slotId && (stateRecords_[i].mask_ & mask) == mask &&
+            stateRecords_[i].tokenId_ == tokenId && stateRecords_[i].pid_ == pid) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TelephonyStateRegistryService::FindMergeableRecord(const sptr<TelephonyObserverBroker> &telephonyObserver,
+    int32_t slotId, int32_t tokenId, pid_t pid, size_t &index) const
+{
+    if (telephonyObserver == nullptr) {
+        return false;
+    }
+    sptr<IRemoteObject> object = telephonyObserver->AsObject();
+    for (size_t i = 0; i < stateRecords_.size(); i++) {
+        const TelephonyStateRegistryRecord &record = stateRecords_[i];
+        if (record.slotId_ == slotId && record.tokenId_ == tokenId && record.pid_ == pid && record.mask_ != 0 &&
+            IsMergeableOptions(GetRecordState(record).options_) && record.telephonyObserver_ != nullptr &&
+            record.telephonyObserver_->AsObject() == object) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool TelephonyStateRegistryService::CheckPermission(uint32_t mask)
 {
     if ((mask & TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE) != 0) {
@@ -677,7 +2080,7 @@ bool TelephonyStateRegistryService::VerifySlotId(int slotId)
 }
 
 std::u16string TelephonyStateRegistryService::GetCallIncomingNumberForSlotId(
-    TelephonyStateRegistryRecord record, int32_t slotId)
+    const TelephonyStateRegistryRecord &record, int32_t slotId)
 {
     if (record.IsCanReadCallHistory()) {
         return callIncomingNumber_[slotId];
@@ -686,81 +2089,303 @@ std::u16string TelephonyStateRegistryService::GetCallIncomingNumberForSlotId(
     }
 }
 
+template<typename T>
+static T GetCachedValue(const std::map<int32_t, T> &cache, int32_t slotId)
+{
+    auto it = cache.find(slotId);
+    return it == cache.end() ? T() : it->second;
+}
+
+TelephonyObserverUpdateStamp TelephonyStateRegistryService::NextStamp(uint32_t mask, int32_t slotId)
+{
+    TelephonyObserverUpdateStamp &stamp = stamps_[std::make_pair(GetStampMask(mask), slotId)];
+    stamp.epoch = stampEpoch_;
+    stamp.sequence++;
+    stamp.timestampMs = GetSteadyTimeMs();
+    return stamp;
+}
+
+TelephonyObserverUpdateStamp TelephonyStateRegistryService::GetStamp(uint32_t mask, int32_t slotId) const
+{
+    auto it = stamps_.find(std::make_pair(GetStampMask(mask), slotId));
+    return it == stamps_.end() ? TelephonyObserverUpdateStamp() : it->second;
+}
+
+void TelephonyStateRegistryService::MirrorState(uint32_t mask, int32_t slotId)
+{
+    const uint32_t systemMask = TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR |
+        TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR |
+        TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE;
+    auto update = [this, mask, slotId](TelephonyObserverSlotState &state) {
+        switch (mask) {
+            case TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE:
+                state.callState = callState_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE:
+                state.cardType = cardType_[slotId];
+                state.simState = simState_[slotId];
+                state.lockReason = simReason_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE:
+                state.dataState = cellularDataConnectionState_[slotId];
+                state.networkType = cellularDataConnectionNetworkType_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW:
+                state.dataFlow = cellularDataFlow_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR:
+                state.cfuResult = cfuResult_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR:
+                state.voiceMailMsgResult = voiceMailMsgResult_[slotId];
+                break;
+            case TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE:
+                state.simActive = simActiveResult_[slotId];
+                break;
+            default:
+                break;
+        }
+    };
+    if (systemMirror_ != nullptr) {
+        systemMirror_->Write(slotId, mask, update);
+    }
+    if (mirror_ != nullptr && (mask & systemMask) == 0) {
+        mirror_->Write(slotId, mask, update);
+    }
+}
+
+void TelephonyStateRegistryService::CaptureSnapshot(
+    const TelephonyStateRegistryRecord &record, std::map<int32_t, SlotSnapshot> &snapshots)
+{
+    std::vector<int32_t> slotIds;
+    if (record.slotId_ == SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT && defaultDataSlotId_ >= 0) {
+        slotIds.push_back(defaultDataSlotId_);
+    } else if (record.slotId_ != SIM_SLOT_ID_FOR_ALL_SLOTS) {
+        slotIds.push_back(record.slotId_);
+    } else {
+        for (int32_t slotId = 0; slotId < slotSize_; slotId++) {
+            if (record.IsSlotMatched(slotId)) {
+                slotIds.push_back(slotId);
+            }
+        }
+    }
+    for (int32_t slotId : slotIds) {
+        SlotSnapshot &snapshot = snapshots[slotId];
+        snapshot.callState = GetCachedValue(callState_, slotId);
+        snapshot.callIncomingNumber = GetCachedValue(callIncomingNumber_, slotId);
+        snapshot.signalInfos = GetCachedValue(signalInfos_, slotId);
+        snapshot.networkState = GetCachedValue(searchNetworkState_, slotId);
+        snapshot.cellInfos = GetCachedValue(cellInfos_, slotId);
+        snapshot.cardType = GetCachedValue(cardType_, slotId);
+        snapshot.simState = GetCachedValue(simState_, slotId);
+        snapshot.simReason = GetCachedValue(simReason_, slotId);
+        snapshot.cellularDataConnectionState = GetCachedValue(cellularDataConnectionState_, slotId);
+        snapshot.cellularDataConnectionNetworkType = GetCachedValue(cellularDataConnectionNetworkType_, slotId);
+        snapshot.cellularDataFlow = GetCachedValue(cellularDataFlow_, slotId);
+        snapshot.cfuResult = GetCachedValue(cfuResult_, slotId);
+        snapshot.voiceMailMsgResult = GetCachedValue(voiceMailMsgResult_, slotId);
+        snapshot.simActiveResult = GetCachedValue(simActiveResult_, slotId);
+    }
+    for (const auto &stamp : stamps_) {
+        auto it = snapshots.find(stamp.first.second);
+        if (it != snapshots.end()) {
+            it->second.stamps[stamp.first.first] = stamp.second;
+        }
+    }
+}
+
+void TelephonyStateRegistryService::BeginInitialDelivery(TelephonyStateRegistryRecord &record)
+{
+    // updates for the record are held back from now on until the snapshot has been delivered
+    std::lock_guard<std::mutex> lock(initialMutex_);
+    auto it = initialPending_.find(record.snapshotSeq_);
+    if (record.snapshotSeq_ == 0 || it == initialPending_.end()) {
+        record.snapshotSeq_ = ++snapshotSeq_;
+        it = initialPending_.emplace(record.snapshotSeq_, InitialDelivery()).first;
+    }
+    it->second.snapshots++;
+}
+
+bool TelephonyStateRegistryService::IsInitialDeliveryPending(
+    const TelephonyStateRegistryRecord &record, uint32_t mask, int32_t slotId)
+{
+    if (record.snapshotSeq_ == 0) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(initialMutex_);
+    auto it = initialPending_.find(record.snapshotSeq_);
+    if (it == initialPending_.end()) {
+        return false;
+    }
+    it->second.pending.insert(std::make_pair(mask, slotId));
+    return true;
+}
+
+void TelephonyStateRegistryService::FinishInitialDelivery(uint64_t snapshotSeq)
+{
+    std::unique_lock<std::mutex> finishLock(initialMutex_);
+    auto finishIt = initialPending_.find(snapshotSeq);
+    if (finishIt == initialPending_.end() || finishIt->second.snapshots == 0) {
+        return;
+    }
+    finishIt->second.snapshots--;
+    finishLock.unlock();
+    while (true) {
+        std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+        std::unique_lock<std::mutex> initialLock(initialMutex_);
+        auto it = initialPending_.find(snapshotSeq);
+        // the last snapshot in flight delivers what was held back, it is sent after the older ones
+        if (it == initialPending_.end() || it->second.snapshots > 0) {
+            return;
+        }
+        if (it->second.pending.empty()) {
+            initialPending_.erase(it);
+            return;
+        }
+        pending.swap(it->second.pending);
+        initialLock.unlock();
+        // the updates held back are delivered from the cache, which is at least as new as the snapshot
+        std::shared_lock<std::shared_mutex> lock(lock_);
+        auto recordIt = std::find_if(stateRecords_.begin(), stateRecords_.end(),
+            [snapshotSeq](const TelephonyStateRegistryRecord &record) { return record.snapshotSeq_ == snapshotSeq; });
+        if (recordIt == stateRecords_.end() || recordIt->telephonyObserver_ == nullptr) {
+            std::lock_guard<std::mutex> eraseLock(initialMutex_);
+            initialPending_.erase(snapshotSeq);
+            return;
+        }
+        for (const auto &key : pending) {
+            if (!IsProcessDeferred(*recordIt, key.first, key.second)) {
+                NotifyCachedState(*recordIt, key.first, key.second);
+            }
+        }
+    }
+}
+
 void TelephonyStateRegistryService::UpdateData(const TelephonyStateRegistryRecord &record)
+{
+    std::map<int32_t, SlotSnapshot> snapshots;
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    CaptureSnapshot(record, snapshots);
+    TelephonyStateRegistryRecordState state = GetRecordState(record);
+    lock.unlock();
+    UpdateData(record, state, snapshots);
+}
+
+void TelephonyStateRegistryService::UpdateData(const TelephonyStateRegistryRecord &record,
+    const TelephonyStateRegistryRecordState &state, const std::map<int32_t, SlotSnapshot> &snapshots)
 {
     if (record.telephonyObserver_ == nullptr) {
         TELEPHONY_LOGE("record.telephonyObserver_ is  nullptr");
         return;
     }
+    for (const auto &snapshot : snapshots) {
+        UpdateDataForSlotId(record, state, snapshot.first, snapshot.second);
+    }
+    if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT) != 0) {
+        TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_ICC_ACCOUNT");
+        record.telephonyObserver_->OnIccAccountUpdated();
+    }
+}
+
+void TelephonyStateRegistryService::UpdateDataForSlotId(const TelephonyStateRegistryRecord &record,
+    const TelephonyStateRegistryRecordState &state, int32_t slotId, const SlotSnapshot &snapshot)
+{
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE) != 0) {
-        std::u16string phoneNumber = GetCallIncomingNumberForSlotId(record, record.slotId_);
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE));
+        std::u16string phoneNumber =
+            record.IsCanReadCallHistory() ? snapshot.callIncomingNumber : Str8ToStr16("");
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_CALL_STATE");
-        record.telephonyObserver_->OnCallStateUpdated(record.slotId_, callState_[record.slotId_], phoneNumber);
+        record.telephonyObserver_->OnCallStateUpdated(slotId, snapshot.callState, phoneNumber);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_SIGNAL_STRENGTHS");
-        record.telephonyObserver_->OnSignalInfoUpdated(record.slotId_, signalInfos_[record.slotId_]);
+        if (state.options_.signalStatisticsPeriodMs_ != 0) {
+            DeliverSignalStatistics(record, slotId);
+        } else if (snapshot.signalInfos != nullptr) {
+            DeliverSignalInfo(record, state, slotId, *snapshot.signalInfos);
+        } else {
+            record.telephonyObserver_->OnSignalInfoUpdated(slotId, std::vector<sptr<SignalInformation>>());
+        }
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_NETWORK_STATE");
-        record.telephonyObserver_->OnNetworkStateUpdated(record.slotId_, searchNetworkState_[record.slotId_]);
+        state.IsNetworkStateChanged(record, slotId, snapshot.networkState);
+        record.telephonyObserver_->OnNetworkStateUpdated(slotId, snapshot.networkState);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_CELL_INFO");
-        record.telephonyObserver_->OnCellInfoUpdated(record.slotId_, cellInfos_[record.slotId_]);
+        if (snapshot.cellInfos != nullptr) {
+            DeliverCellInfo(record, state, slotId, *snapshot.cellInfos);
+        } else {
+            record.telephonyObserver_->OnCellInfoUpdated(slotId, std::vector<sptr<CellInformation>>());
+        }
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE));
         record.telephonyObserver_->OnSimStateUpdated(
-            record.slotId_, cardType_[record.slotId_], simState_[record.slotId_], simReason_[record.slotId_]);
+            slotId, snapshot.cardType, snapshot.simState, snapshot.simReason);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_DATA_CONNECTION_STATE));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_DATA_CONNECTION_STATE");
-        record.telephonyObserver_->OnCellularDataConnectStateUpdated(record.slotId_,
-            cellularDataConnectionState_[record.slotId_], cellularDataConnectionNetworkType_[record.slotId_]);
+        state.IsDataConnectStateChanged(record, slotId,
+            snapshot.cellularDataConnectionState, snapshot.cellularDataConnectionNetworkType);
+        record.telephonyObserver_->OnCellularDataConnectStateUpdated(slotId,
+            snapshot.cellularDataConnectionState, snapshot.cellularDataConnectionNetworkType);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_DATA_FLOW");
-        record.telephonyObserver_->OnCellularDataFlowUpdated(record.slotId_, cellularDataFlow_[record.slotId_]);
+        record.telephonyObserver_->OnCellularDataFlowUpdated(slotId, snapshot.cellularDataFlow);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_CFU_INDICATOR");
-        record.telephonyObserver_->OnCfuIndicatorUpdated(record.slotId_, cfuResult_[record.slotId_]);
+        record.telephonyObserver_->OnCfuIndicatorUpdated(slotId, snapshot.cfuResult);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR");
-        record.telephonyObserver_->OnVoiceMailMsgIndicatorUpdated(record.slotId_, voiceMailMsgResult_[record.slotId_]);
-    }
-    if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_ICC_ACCOUNT) != 0) {
-        TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_ICC_ACCOUNT");
-        record.telephonyObserver_->OnIccAccountUpdated();
+        record.telephonyObserver_->OnVoiceMailMsgIndicatorUpdated(slotId, snapshot.voiceMailMsgResult);
     }
-    UpdateDataEx(record);
+    UpdateDataEx(record, slotId, snapshot);
 }
 
-void TelephonyStateRegistryService::UpdateDataEx(const TelephonyStateRegistryRecord &record)
+void TelephonyStateRegistryService::UpdateDataEx(
+    const TelephonyStateRegistryRecord &record, int32_t slotId, const SlotSnapshot &snapshot)
 {
-    if (record.telephonyObserver_ == nullptr) {
-        TELEPHONY_LOGE("record.telephonyObserver_ is  nullptr");
-        return;
-    }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_CALL_STATE_EX");
-        record.telephonyObserver_->OnCallStateUpdatedEx(record.slotId_, callState_[record.slotId_]);
+        record.telephonyObserver_->OnCallStateUpdatedEx(slotId, snapshot.callState);
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE));
         if (record.CanManageCallForDevices()) {
             TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_CCALL_STATE");
-            int32_t callState = callState_[record.slotId_];
-            if (callState == static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN)) {
-                callState = static_cast<int32_t>(CallStatus::CALL_STATUS_IDLE);
-            }
-            record.telephonyObserver_->OnCCallStateUpdated(record.slotId_, callState,
-                callIncomingNumber_[record.slotId_]);
+            record.telephonyObserver_->OnCCallStateUpdated(
+                slotId, GetCCallState(snapshot.callState), snapshot.callIncomingNumber);
         }
     }
     if ((record.mask_ & TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE) != 0) {
+        TelephonyObserverUpdateStampScope stampScope(
+            snapshot.GetStamp(TelephonyObserverBroker::OBSERVER_MASK_SIM_ACTIVE_STATE));
         TELEPHONY_LOGI("RegisterStateChange##Notify-OBSERVER_MASK_SIM_ACTIVE_STATE");
-        record.telephonyObserver_->OnSimActiveStateUpdated(record.slotId_, simActiveResult_[record.slotId_]);
+        record.telephonyObserver_->OnSimActiveStateUpdated(slotId, snapshot.simActiveResult);
     }
 }
 
@@ -778,7 +2403,7 @@ bool TelephonyStateRegistryService::PublishCommonEvent(
         permissions.emplace_back(Permission::GET_NETWORK_INFO);
         publishInfo.SetSubscriberPermissions(permissions);
     }
-    bool publishResult = EventFwk::CommonEventManager::PublishCommonEvent(data, publishInfo, nullptr);
+    bool publishResult = eventBuffer_.Publish(data, publishInfo);
     TELEPHONY_LOGI("PublishCommonEvent end###publishResult = %{public}d\n", publishResult);
     return publishResult;
 }
@@ -797,7 +2422,7 @@ void TelephonyStateRegistryService::SendCallStateChanged(int32_t slotId, int32_t
     std::vector<std::string> callPermissions;
     callPermissions.emplace_back(Permission::GET_TELEPHONY_STATE);
     publishInfo.SetSubscriberPermissions(callPermissions);
-    bool publishResult = EventFwk::CommonEventManager::PublishCommonEvent(data, publishInfo, nullptr);
+    bool publishResult = eventBuffer_.Publish(data, publishInfo);
     if (!publishResult) {
         TELEPHONY_LOGE("SendCallStateChanged PublishBroadcastEvent result fail");
     }
@@ -820,7 +2445,7 @@ void TelephonyStateRegistryService::SendCallStateChangedAsUserMultiplePermission
     callPermissions.emplace_back(Permission::GET_TELEPHONY_STATE);
     callPermissions.emplace_back(Permission::READ_CALL_LOG);
     publishInfo.SetSubscriberPermissions(callPermissions);
-    bool publishResult = EventFwk::CommonEventManager::PublishCommonEvent(data, publishInfo, nullptr);
+    bool publishResult = eventBuffer_.Publish(data, publishInfo);
     if (!publishResult) {
         TELEPHONY_LOGE("SendCallStateChangedAsUserMultiplePermission PublishBroadcastEvent result fail");
     }
@@ -1044,6 +2669,42 @@ int32_t TelephonyStateRegistryService::GetLockReason(int32_t slotId)
     return result;
 }
 
+int32_t TelephonyStateRegistryService::GetDefaultDataSlotId()
+{
+    std::shared_lock<std::shared_mutex> lock(lock_);
+    return defaultDataSlotId_;
+}
+
+bool TelephonyStateRegistryService::CheckUpdateBackpressure()
+{
+    return admission_.CheckBackpressure();
+}
+
+const TelephonyStateRegistryAdmission &TelephonyStateRegistryService::GetAdmission() const
+{
+    return admission_;
+}
+
+const TelephonyStateRegistryWakeup &TelephonyStateRegistryService::GetWakeup() const
+{
+    return wakeup_;
+}
+
+const TelephonyStateRegistrySignalStatistics &TelephonyStateRegistryService::GetSignalStatistics() const
+{
+    return signalStatistics_;
+}
+
+const TelephonyStateRegistryTimerWheel &TelephonyStateRegistryService::GetTimerWheel() const
+{
+    return timerWheel_;
+}
+
+const TelephonyStateRegistryInterest &TelephonyStateRegistryService::GetInterest() const
+{
+    return interest_;
+}
+
 bool TelephonyStateRegistryService::IsCommonEventServiceAbilityExist() __attribute__((no_sanitize("cfi")))
 {
     sptr<ISystemAbilityManager> sm = SystemAbilityManagerClient::GetInstance().GetSystemAbilityManager();
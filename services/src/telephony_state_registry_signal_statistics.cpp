@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_signal_statistics.h"
+
+#include <algorithm>
+#include <functional>
+#include <set>
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// same weight as the smoothed round trip time of TCP, a sample moves the average by an eighth
+constexpr double AVERAGE_WEIGHT = 0.125;
+constexpr int64_t WINDOW_MS = 60000;
+// halving the counts makes old samples weigh less and keeps them from overflowing
+constexpr uint32_t HISTOGRAM_DECAY_COUNT = 1024;
+constexpr uint32_t LOW_PERCENT = 10;
+constexpr uint32_t MEDIAN_PERCENT = 50;
+constexpr uint32_t HIGH_PERCENT = 90;
+constexpr uint32_t PERCENT = 100;
+
+// keeps the queue monotonic, an entry that can no longer be the extreme of the window is dropped
+template<typename Keep>
+void PushWindow(std::deque<std::pair<int64_t, int32_t>> &window, int32_t dbm, int64_t nowMs, Keep keep)
+{
+    while (!window.empty() && window.front().first <= nowMs - WINDOW_MS) {
+        window.pop_front();
+    }
+    while (!window.empty() && !keep(window.back().second, dbm)) {
+        window.pop_back();
+    }
+    window.emplace_back(nowMs, dbm);
+}
+} // namespace
+
+void TelephonyStateRegistrySignalStatistics::Add(
+    int32_t slotId, const std::vector<sptr<SignalInformation>> &signals, int64_t nowMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::map<int32_t, RatState> &slot = states_[slotId];
+    std::set<int32_t> reported;
+    for (const auto &signal : signals) {
+        if (signal == nullptr) {
+            continue;
+        }
+        int32_t networkType = static_cast<int32_t>(signal->GetNetworkType());
+        reported.insert(networkType);
+        RatState &state = slot[networkType];
+        state.statistics.networkType = networkType;
+        AddSample(state, signal->GetSignalIntensity(), signal->GetSignalLevel(), nowMs);
+    }
+    for (auto &item : slot) {
+        if (reported.find(item.first) == reported.end()) {
+            SetLevel(item.second, -1, nowMs);
+        }
+    }
+}
+
+void TelephonyStateRegistrySignalStatistics::AddSample(RatState &state, int32_t dbm, int32_t level, int64_t nowMs)
+{
+    TelephonyObserverSignalStatistics &statistics = state.statistics;
+    statistics.averageDbm = statistics.samples == 0 ?
+        dbm : statistics.averageDbm + AVERAGE_WEIGHT * (dbm - statistics.averageDbm);
+    statistics.samples++;
+    statistics.lastDbm = dbm;
+    PushWindow(state.windowMin, dbm, nowMs, std::less<int32_t>());
+    PushWindow(state.windowMax, dbm, nowMs, std::greater<int32_t>());
+    int32_t bucket = (std::clamp(dbm, HISTOGRAM_MIN_DBM,
+        HISTOGRAM_MIN_DBM + static_cast<int32_t>(HISTOGRAM_BUCKET_COUNT - 1) * HISTOGRAM_STEP_DBM) -
+        HISTOGRAM_MIN_DBM) / HISTOGRAM_STEP_DBM;
+    state.histogram[bucket]++;
+    state.histogramCount++;
+    if (state.histogramCount >= HISTOGRAM_DECAY_COUNT) {
+        state.histogramCount = 0;
+        for (uint32_t &count : state.histogram) {
+            count /= 2;
+            state.histogramCount += count;
+        }
+    }
+    SetLevel(state, level, nowMs);
+}
+
+void TelephonyStateRegistrySignalStatistics::SetLevel(RatState &state, int32_t level, int64_t nowMs)
+{
+    if (state.level >= 0 && nowMs > state.levelSinceMs) {
+        state.statistics.levelDurationMs[state.level] += nowMs - state.levelSinceMs;
+    }
+    state.level = (level >= 0 && level < SIGNAL_STATISTICS_LEVEL_COUNT) ? level : -1;
+    state.levelSinceMs = nowMs;
+}
+
+int32_t TelephonyStateRegistrySignalStatistics::GetPercentile(const RatState &state, uint32_t percent) const
+{
+    uint64_t target = (static_cast<uint64_t>(state.histogramCount) * percent + PERCENT - 1) / PERCENT;
+    uint64_t count = 0;
+    for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; i++) {
+        count += state.histogram[i];
+        if (count > 0 && count >= target) {
+            return HISTOGRAM_MIN_DBM + static_cast<int32_t>(i) * HISTOGRAM_STEP_DBM;
+        }
+    }
+    return state.statistics.lastDbm;
+}
+
+TelephonyObserverSignalStatistics TelephonyStateRegistrySignalStatistics::Snapshot(
+    const RatState &state, int64_t nowMs) const
+{
+    TelephonyObserverSignalStatistics statistics = state.statistics;
+    // a window without samples reports the last one
+    auto current = [nowMs](const std::pair<int64_t, int32_t> &entry) { return entry.first > nowMs - WINDOW_MS; };
+    auto minIt = std::find_if(state.windowMin.begin(), state.windowMin.end(), current);
+    auto maxIt = std::find_if(state.windowMax.begin(), state.windowMax.end(), current);
+    statistics.windowMinDbm = minIt != state.windowMin.end() ? minIt->second : statistics.lastDbm;
+    statistics.windowMaxDbm = maxIt != state.windowMax.end() ? maxIt->second : statistics.lastDbm;
+    statistics.lowDbm = GetPercentile(state, LOW_PERCENT);
+    statistics.medianDbm = GetPercentile(state, MEDIAN_PERCENT);
+    statistics.highDbm = GetPercentile(state, HIGH_PERCENT);
+    if (state.level >= 0 && nowMs > state.levelSinceMs) {
+        statistics.levelDurationMs[state.level] += nowMs - state.levelSinceMs;
+    }
+    return statistics;
+}
+
+void TelephonyStateRegistrySignalStatistics::Get(
+    int32_t slotId, int64_t nowMs, std::vector<TelephonyObserverSignalStatistics> &statistics) const
+{
+    statistics.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = states_.find(slotId);
+    if (it == states_.end()) {
+        return;
+    }
+    for (const auto &item : it->second) {
+        statistics.push_back(Snapshot(item.second, nowMs));
+    }
+}
+
+std::map<int32_t, std::vector<TelephonyObserverSignalStatistics>> TelephonyStateRegistrySignalStatistics::GetAll(
+    int64_t nowMs) const
+{
+    std::map<int32_t, std::vector<TelephonyObserverSignalStatistics>> all;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &slot : states_) {
+        std::vector<TelephonyObserverSignalStatistics> &statistics = all[slot.first];
+        for (const auto &item : slot.second) {
+            statistics.push_back(Snapshot(item.second, nowMs));
+        }
+    }
+    return all;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -21,6 +21,7 @@
 
 #include "sim_state_type.h"
 #include "state_registry_errors.h"
+#include "state_registry_inner_errors.h"
 #include "telephony_permission.h"
 
 #ifdef HICOLLIE_ENABLE
@@ -61,6 +62,28 @@ TelephonyStateRegistryStub::TelephonyStateRegistryStub()
         [this](MessageParcel &data, MessageParcel &reply) { return OnIccAccountUpdated(data, reply); };
     memberFuncMap_[StateNotifyInterfaceCode::SIM_ACTIVR_STATE] =
         [this](MessageParcel &data, MessageParcel &reply) { return OnSimActiveStateUpdated(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::ADD_OBSERVER_WITH_OPTIONS)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnRegisterStateChangeWithOptions(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::DEFAULT_DATA_SLOT_ID)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnUpdateDefaultDataSlotId(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::NET_WORK_STATE_DELTA)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnUpdateNetworkStateDelta(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::CELL_INFO_DELTA)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnUpdateCellInfoDelta(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::RESYNC_OBSERVER)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnResyncStateObserver(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::RESYNC_EVENT_RING)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnResyncEventRing(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::GET_STATE_MIRROR)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnGetStateMirror(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::GET_SIGNAL_STATISTICS)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnGetSignalStatistics(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::GET_SUBSCRIBER_INTEREST)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnGetSubscriberInterest(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::ADD_INTEREST_OBSERVER)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnAddInterestObserver(data, reply); };
+    memberFuncMap_[static_cast<StateNotifyInterfaceCode>(StateNotifyInnerInterfaceCode::REMOVE_INTEREST_OBSERVER)] =
+        [this](MessageParcel &data, MessageParcel &reply) { return OnRemoveInterestObserver(data, reply); };
 }
 
 TelephonyStateRegistryStub::~TelephonyStateRegistryStub()
@@ -135,7 +158,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCallState(MessageParcel &data, Messa
     std::u16string phoneNumber = data.ReadString16();
     int32_t ret = UpdateCallState(callState, phoneNumber);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateCallState end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -147,7 +170,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateSimState(MessageParcel &data, Messag
     LockReason reason = static_cast<LockReason>(data.ReadInt32());
     int32_t ret = UpdateSimState(slotId, type, state, reason);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateSimState end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -158,7 +181,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCallStateForSlotId(MessageParcel &da
     std::u16string incomingNumber = data.ReadString16();
     int32_t ret = UpdateCallStateForSlotId(slotId, callState, incomingNumber);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateCallStateForSlotId end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -171,7 +194,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellularDataConnectState(MessageParc
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateCellularDataConnectState end fail##ret=%{public}d", ret);
     }
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -183,6 +206,17 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellularDataFlow(MessageParcel &data
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateCellularDataFlow end fail##ret=%{public}d", ret);
     }
+    WriteUpdateResult(reply, ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnUpdateDefaultDataSlotId(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    int32_t ret = UpdateDefaultDataSlotId(slotId);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateDefaultDataSlotId end fail##ret=%{public}d", ret);
+    }
     reply.WriteInt32(ret);
     return NO_ERROR;
 }
@@ -191,17 +225,21 @@ int32_t TelephonyStateRegistryStub::OnUpdateSignalInfo(MessageParcel &data, Mess
 {
     int32_t ret = TELEPHONY_SUCCESS;
     int32_t slotId = data.ReadInt32();
+    size_t begin = data.GetReadPosition();
     int32_t size = data.ReadInt32();
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateSignalInfo size=%{public}d", size);
-    size = ((size > SignalInformation::MAX_SIGNAL_NUM) ? 0 : size);
     if (size < 0) {
         ret = TELEPHONY_ERR_FAIL;
         TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateSignalInfo size < 0");
         return ret;
     }
-    std::vector<sptr<SignalInformation>> result;
-    parseSignalInfos(data, size, result);
-    ret = UpdateSignalInfo(slotId, result);
+    if (size <= SignalInformation::MAX_SIGNAL_NUM) {
+        ret = UpdateSignalInfoPayload(slotId,
+            SignalInfoPayload::Read(data, begin, size, &TelephonyStateRegistryStub::parseSignalInfos));
+    } else {
+        std::vector<sptr<SignalInformation>> result;
+        ret = UpdateSignalInfo(slotId, result);
+    }
     if (ret != TELEPHONY_SUCCESS) {
         TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateSignalInfo end fail##ret=%{public}d", ret);
     }
@@ -285,6 +323,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
 {
     int32_t ret = TELEPHONY_SUCCESS;
     int32_t slotId = data.ReadInt32();
+    size_t begin = data.GetReadPosition();
     int32_t size = data.ReadInt32();
     TELEPHONY_LOGI("TelephonyStateRegistryStub OnUpdateCellInfo:size=%{public}d", size);
     size = ((size > CellInformation::MAX_CELL_NUM) ? 0 : size);
@@ -293,7 +332,15 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
         TELEPHONY_LOGE("TelephonyStateRegistryStub the size less than or equal to 0!");
         return ret;
     }
-    std::vector<sptr<CellInformation>> cells;
+    ret = UpdateCellInfoPayload(slotId,
+        CellInfoPayload::Read(data, begin, size, &TelephonyStateRegistryStub::ParseCellInfos));
+    TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateCellInfo end##ret=%{public}d", ret);
+    return NO_ERROR;
+}
+
+void TelephonyStateRegistryStub::ParseCellInfos(
+    MessageParcel &data, const int32_t size, std::vector<sptr<CellInformation>> &result)
+{
     CellInformation::CellType type;
     for (int i = 0; i < size; ++i) {
         type = static_cast<CellInformation::CellType>(data.ReadInt32());
@@ -302,7 +349,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
                 std::unique_ptr<GsmCellInformation> cell = std::make_unique<GsmCellInformation>();
                 if (cell != nullptr) {
                     cell->ReadFromParcel(data);
-                    cells.emplace_back(cell.release());
+                    result.emplace_back(cell.release());
                 }
                 break;
             }
@@ -310,7 +357,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
                 std::unique_ptr<LteCellInformation> cell = std::make_unique<LteCellInformation>();
                 if (cell != nullptr) {
                     cell->ReadFromParcel(data);
-                    cells.emplace_back(cell.release());
+                    result.emplace_back(cell.release());
                 }
                 break;
             }
@@ -318,7 +365,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
                 std::unique_ptr<NrCellInformation> cell = std::make_unique<NrCellInformation>();
                 if (cell != nullptr) {
                     cell->ReadFromParcel(data);
-                    cells.emplace_back(cell.release());
+                    result.emplace_back(cell.release());
                 }
                 break;
             }
@@ -326,9 +373,6 @@ int32_t TelephonyStateRegistryStub::OnUpdateCellInfo(MessageParcel &data, Messag
                 break;
         }
     }
-    ret = UpdateCellInfo(slotId, cells);
-    TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateCellInfo end##ret=%{public}d", ret);
-    return NO_ERROR;
 }
 
 int32_t TelephonyStateRegistryStub::OnUpdateNetworkState(MessageParcel &data, MessageParcel &reply)
@@ -343,6 +387,181 @@ int32_t TelephonyStateRegistryStub::OnUpdateNetworkState(MessageParcel &data, Me
     }
     ret = UpdateNetworkState(slotId, result);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateNetworkState end##ret=%{public}d", ret);
+    WriteUpdateResult(reply, ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::ReadDelta(
+    StateNotifyInnerInterfaceCode code, int32_t slotId, MessageParcel &data, TelephonyObserverDeltaValue &value)
+{
+    // only producers may leave bases behind
+    if (!TelephonyPermission::CheckPermission(Permission::SET_TELEPHONY_STATE)) {
+        TELEPHONY_LOGE("Check permission failed.");
+        return TELEPHONY_STATE_REGISTRY_PERMISSION_DENIED;
+    }
+    std::lock_guard<std::mutex> lock(deltaMutex_);
+    if (!deltaDecoders_[std::make_pair(static_cast<uint32_t>(code), slotId)].Read(data, value)) {
+        TELEPHONY_LOGW("delta of code %{public}u slotId %{public}d cannot be applied", static_cast<uint32_t>(code),
+            slotId);
+        return TELEPHONY_STATE_REGISTRY_DELTA_BASE_UNKNOWN;
+    }
+    return TELEPHONY_SUCCESS;
+}
+
+int32_t TelephonyStateRegistryStub::OnUpdateNetworkStateDelta(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    TelephonyObserverDeltaValue value;
+    int32_t ret = ReadDelta(StateNotifyInnerInterfaceCode::NET_WORK_STATE_DELTA, slotId, data, value);
+    if (ret == TELEPHONY_SUCCESS) {
+        sptr<NetworkState> networkState = TelephonyObserverDelta::ToNetworkState(value);
+        ret = networkState == nullptr ? TELEPHONY_ERR_READ_DATA_FAIL : UpdateNetworkState(slotId, networkState);
+    }
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateNetworkStateDelta end fail##ret=%{public}d", ret);
+    }
+    WriteUpdateResult(reply, ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnUpdateCellInfoDelta(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    TelephonyObserverDeltaValue value;
+    int32_t ret = ReadDelta(StateNotifyInnerInterfaceCode::CELL_INFO_DELTA, slotId, data, value);
+    if (ret == TELEPHONY_SUCCESS) {
+        std::vector<sptr<CellInformation>> cells;
+        TelephonyObserverDelta::ToCellInfo(value, cells);
+        ret = UpdateCellInfo(slotId, cells);
+    }
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnUpdateCellInfoDelta end fail##ret=%{public}d", ret);
+    }
+    WriteUpdateResult(reply, ret);
+    return NO_ERROR;
+}
+
+void TelephonyStateRegistryStub::WriteUpdateResult(MessageParcel &reply, int32_t ret)
+{
+    // the flag follows the result, so proxies that only read the result are not affected
+    reply.WriteInt32(ret);
+    reply.WriteBool(CheckUpdateBackpressure());
+}
+
+int32_t TelephonyStateRegistryStub::OnResyncStateObserver(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    uint32_t mask = static_cast<uint32_t>(data.ReadInt32());
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnResyncStateObserver remote is nullptr.");
+        reply.WriteInt32(TELEPHONY_ERR_READ_DATA_FAIL);
+        return NO_ERROR;
+    }
+    int32_t ret = ResyncStateObserver(remote, slotId, mask, static_cast<int32_t>(IPCSkeleton::GetCallingTokenID()),
+        IPCSkeleton::GetCallingPid());
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnResyncStateObserver end fail##ret=%{public}d", ret);
+    }
+    reply.WriteInt32(ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnResyncEventRing(MessageParcel &data, MessageParcel &reply)
+{
+    uint32_t ringId = data.ReadUint32();
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnResyncEventRing remote is nullptr.");
+        reply.WriteInt32(TELEPHONY_ERR_READ_DATA_FAIL);
+        return NO_ERROR;
+    }
+    int32_t ret = ResyncEventRing(remote, ringId, static_cast<int32_t>(IPCSkeleton::GetCallingTokenID()),
+        IPCSkeleton::GetCallingPid());
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnResyncEventRing end fail##ret=%{public}d", ret);
+    }
+    reply.WriteInt32(ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnGetStateMirror(MessageParcel &data, MessageParcel &reply)
+{
+    sptr<Ashmem> ashmem = nullptr;
+    int32_t ret = GetStateMirror(ashmem);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetStateMirror end fail##ret=%{public}d", ret);
+        reply.WriteInt32(ret);
+        return NO_ERROR;
+    }
+    if (!reply.WriteInt32(ret) || !reply.WriteAshmem(ashmem)) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetStateMirror write reply failed");
+    }
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnGetSignalStatistics(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    std::vector<TelephonyObserverSignalStatistics> statistics;
+    int32_t ret = GetSignalStatistics(slotId, statistics);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetSignalStatistics end fail##ret=%{public}d", ret);
+        reply.WriteInt32(ret);
+        return NO_ERROR;
+    }
+    if (!reply.WriteInt32(ret) || !TelephonyObserverSignalStatistics::WriteList(reply, statistics)) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetSignalStatistics write reply failed");
+    }
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnGetSubscriberInterest(MessageParcel &data, MessageParcel &reply)
+{
+    uint32_t mask = data.ReadUint32();
+    std::vector<TelephonyObserverInterest> interests;
+    int32_t ret = GetSubscriberInterest(mask, interests);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetSubscriberInterest end fail##ret=%{public}d", ret);
+        reply.WriteInt32(ret);
+        return NO_ERROR;
+    }
+    if (!reply.WriteInt32(ret) || !TelephonyObserverInterest::WriteList(reply, interests)) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnGetSubscriberInterest write reply failed");
+    }
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnAddInterestObserver(MessageParcel &data, MessageParcel &reply)
+{
+    uint32_t mask = data.ReadUint32();
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnAddInterestObserver remote is nullptr.");
+        reply.WriteInt32(TELEPHONY_ERR_READ_DATA_FAIL);
+        return NO_ERROR;
+    }
+    int32_t ret = AddInterestObserver(remote, mask);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnAddInterestObserver end fail##ret=%{public}d", ret);
+    }
+    reply.WriteInt32(ret);
+    return NO_ERROR;
+}
+
+int32_t TelephonyStateRegistryStub::OnRemoveInterestObserver(MessageParcel &data, MessageParcel &reply)
+{
+    data.ReadUint32();
+    sptr<IRemoteObject> remote = data.ReadRemoteObject();
+    if (remote == nullptr) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnRemoveInterestObserver remote is nullptr.");
+        reply.WriteInt32(TELEPHONY_ERR_READ_DATA_FAIL);
+        return NO_ERROR;
+    }
+    int32_t ret = RemoveInterestObserver(remote);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnRemoveInterestObserver end fail##ret=%{public}d", ret);
+    }
     reply.WriteInt32(ret);
     return NO_ERROR;
 }
@@ -368,6 +587,32 @@ int32_t TelephonyStateRegistryStub::OnRegisterStateChange(MessageParcel &data, M
     return NO_ERROR;
 }
 
+int32_t TelephonyStateRegistryStub::OnRegisterStateChangeWithOptions(MessageParcel &data, MessageParcel &reply)
+{
+    int32_t slotId = data.ReadInt32();
+    int32_t mask = data.ReadInt32();
+    bool notifyNow = data.ReadBool();
+    sptr<TelephonyObserverBroker> callback = nullptr;
+    int32_t ret = ReadData(data, reply, callback);
+    if (ret != TELEPHONY_SUCCESS) {
+        reply.WriteInt32(ret);
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnRegisterStateChangeWithOptions ReadData failed");
+        return NO_ERROR;
+    }
+    TelephonyObserverOptions options;
+    if (!options.ReadFromParcel(data)) {
+        reply.WriteInt32(TELEPHONY_ERR_READ_DATA_FAIL);
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnRegisterStateChangeWithOptions read options failed");
+        return NO_ERROR;
+    }
+    ret = RegisterStateChange(callback, slotId, mask, notifyNow, options);
+    if (ret != TELEPHONY_SUCCESS) {
+        TELEPHONY_LOGE("TelephonyStateRegistryStub::OnRegisterStateChangeWithOptions end fail##ret=%{public}d", ret);
+    }
+    reply.WriteInt32(ret);
+    return NO_ERROR;
+}
+
 int32_t TelephonyStateRegistryStub::OnUnregisterStateChange(MessageParcel &data, MessageParcel &reply)
 {
     int32_t slotId = data.ReadInt32();
@@ -407,7 +652,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateCfuIndicator(MessageParcel &data, Me
     bool cfuResult = data.ReadBool();
     int32_t ret = UpdateCfuIndicator(slotId, cfuResult);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateCfuIndicator end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -417,7 +662,7 @@ int32_t TelephonyStateRegistryStub::OnUpdateVoiceMailMsgIndicator(MessageParcel
     bool voiceMailMsgResult = data.ReadBool();
     int32_t ret = UpdateVoiceMailMsgIndicator(slotId, voiceMailMsgResult);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnUpdateVoiceMailMsgIndicator end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -425,7 +670,7 @@ int32_t TelephonyStateRegistryStub::OnIccAccountUpdated(MessageParcel &data, Mes
 {
     int32_t ret = UpdateIccAccount();
     TELEPHONY_LOGI("end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
@@ -435,23 +680,40 @@ int32_t TelephonyStateRegistryStub::OnSimActiveStateUpdated(MessageParcel &data,
     bool activeStateResult = data.ReadBool();
     int32_t ret = UpdateSimActiveState(slotId, activeStateResult);
     TELEPHONY_LOGI("TelephonyStateRegistryStub::OnSimActiveState end##ret=%{public}d", ret);
-    reply.WriteInt32(ret);
+    WriteUpdateResult(reply, ret);
     return NO_ERROR;
 }
 
 int32_t TelephonyStateRegistryStub::RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver,
     int32_t slotId, uint32_t mask, bool isUpdate)
+{
+    return RegisterStateChange(telephonyObserver, slotId, mask, isUpdate, TelephonyObserverOptions());
+}
+
+int32_t TelephonyStateRegistryStub::RegisterStateChange(const sptr<TelephonyObserverBroker> &telephonyObserver,
+    int32_t slotId, uint32_t mask, bool isUpdate, const TelephonyObserverOptions &options)
 {
     int32_t uid = IPCSkeleton::GetCallingUid();
+    int32_t tokenId = static_cast<int32_t>(IPCSkeleton::GetCallingTokenID());
     std::string bundleName = "";
+    std::string appIdentifier = "";
+    ResolveIdentity(uid, tokenId, bundleName, appIdentifier);
+    return RegisterStateChange(telephonyObserver, slotId, mask, bundleName, isUpdate,
+        IPCSkeleton::GetCallingPid(), uid, tokenId, appIdentifier, options);
+}
+
+void TelephonyStateRegistryStub::ResolveIdentity(
+    int32_t uid, int32_t tokenId, std::string &bundleName, std::string &appIdentifier)
+{
+    uint64_t generation = 0;
+    if (identityCache_.Lookup(uid, tokenId, bundleName, appIdentifier, generation)) {
+        return;
+    }
     TelephonyPermission::GetBundleNameByUid(uid, bundleName);
-    int32_t tokenId = static_cast<int32_t>(IPCSkeleton::GetCallingTokenID());
     Security::AccessToken::HapTokenInfo hapTokenInfo;
     Security::AccessToken::AccessTokenKit::GetHapTokenInfo(tokenId, hapTokenInfo);
-    std::string appIdentifier = "";
     TelephonyPermission::GetAppIdentifier(bundleName, appIdentifier, hapTokenInfo.userID);
-    return RegisterStateChange(telephonyObserver, slotId, mask, bundleName, isUpdate,
-        IPCSkeleton::GetCallingPid(), uid, tokenId, appIdentifier);
+    identityCache_.Insert(uid, tokenId, bundleName, appIdentifier, generation);
 }
 
 int32_t TelephonyStateRegistryStub::UnregisterStateChange(int32_t slotId, uint32_t mask)
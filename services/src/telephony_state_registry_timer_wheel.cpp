@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "telephony_state_registry_timer_wheel.h"
+
+#include <algorithm>
+
+namespace OHOS {
+namespace Telephony {
+TelephonyStateRegistryTimerWheel::TelephonyStateRegistryTimerWheel() : slots_(SLOT_COUNT) {}
+
+bool TelephonyStateRegistryTimerWheel::Hold(const PacedKey &key, int64_t periodMs, int64_t nowMs, bool &startTick)
+{
+    startTick = false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stateIt = states_.find(key);
+    if (stateIt == states_.end()) {
+        PacingState initState;
+        initState.lastDeliverMs = nowMs;
+        states_.emplace(key, initState);
+        statistics_.immediate++;
+        return false;
+    }
+    PacingState &state = stateIt->second;
+    if (state.pending) {
+        statistics_.held++;
+        return true;
+    }
+    int64_t period = std::max(periodMs, TICK_MS);
+    if (nowMs - state.lastDeliverMs >= period) {
+        state.lastDeliverMs = nowMs;
+        statistics_.immediate++;
+        return false;
+    }
+    if (!ticking_) {
+        // the wheel was idle, it starts over from the current tick
+        ticking_ = true;
+        currentTick_ = nowMs / TICK_MS;
+        startTick = true;
+    }
+    int64_t dueTick = std::max((state.lastDeliverMs + period + TICK_MS - 1) / TICK_MS, currentTick_ + 1);
+    slots_[static_cast<size_t>(dueTick) % SLOT_COUNT].push_back({ dueTick, key });
+    timerCount_++;
+    state.pending = true;
+    statistics_.held++;
+    return true;
+}
+
+bool TelephonyStateRegistryTimerWheel::Advance(int64_t nowMs, std::vector<PacedKey> &due)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t targetTick = nowMs / TICK_MS;
+    // after a long stall every slot is visited once, the due tick of each timer tells whether it expired
+    int64_t steps = std::min(targetTick - currentTick_, static_cast<int64_t>(SLOT_COUNT));
+    for (int64_t step = 1; step <= steps; step++) {
+        std::vector<Timer> &slot = slots_[static_cast<size_t>(currentTick_ + step) % SLOT_COUNT];
+        auto expired = std::stable_partition(
+            slot.begin(), slot.end(), [targetTick](const Timer &timer) { return timer.dueTick > targetTick; });
+        for (auto it = expired; it != slot.end(); ++it) {
+            auto stateIt = states_.find(it->key);
+            if (stateIt == states_.end() || !stateIt->second.pending) {
+                continue;
+            }
+            stateIt->second.pending = false;
+            stateIt->second.lastDeliverMs = nowMs;
+            due.push_back(it->key);
+            statistics_.fired++;
+        }
+        timerCount_ -= static_cast<size_t>(slot.end() - expired);
+        slot.erase(expired, slot.end());
+    }
+    currentTick_ = std::max(currentTick_, targetTick);
+    ticking_ = timerCount_ > 0;
+    return ticking_;
+}
+
+void TelephonyStateRegistryTimerWheel::Remove(uint64_t pacingId, uint32_t mask)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = states_.begin(); it != states_.end();) {
+        if (std::get<0>(it->first) == pacingId && (std::get<1>(it->first) & mask) != 0) {
+            it = states_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+TimerWheelStatistics TelephonyStateRegistryTimerWheel::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+size_t TelephonyStateRegistryTimerWheel::GetHeldCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto &state : states_) {
+        if (state.second.pending) {
+            count++;
+        }
+    }
+    return count;
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "telephony_state_registry_wakeup.h"
+
+#include "telephony_log_wrapper.h"
+
+namespace OHOS {
+namespace Telephony {
+namespace {
+// a close running this much early still takes the window, so a timer firing a bit early does not strand it
+constexpr int64_t CLOSE_SLACK_MS = 10;
+} // namespace
+
+void TelephonyStateRegistryWakeup::SetBudget(uint32_t mask, int64_t budgetMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (budgetMs <= 0) {
+        budgets_.erase(mask);
+        return;
+    }
+    budgets_[mask] = budgetMs;
+    statistics_[mask];
+    TELEPHONY_LOGI("wakeup budget mask = %{public}u budgetMs = %{public}lld", mask,
+        static_cast<long long>(budgetMs));
+}
+
+int64_t TelephonyStateRegistryWakeup::GetBudget(uint32_t mask) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = budgets_.find(mask);
+    return it == budgets_.end() ? 0 : it->second;
+}
+
+std::map<uint32_t, int64_t> TelephonyStateRegistryWakeup::GetBudgets() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budgets_;
+}
+
+bool TelephonyStateRegistryWakeup::Hold(pid_t pid, uint32_t mask, int32_t slotId, int64_t nowMs,
+    int64_t &closeDelayMs)
+{
+    closeDelayMs = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto budgetIt = budgets_.find(mask);
+    if (budgetIt == budgets_.end()) {
+        return false;
+    }
+    int64_t deadlineMs = nowMs + budgetIt->second;
+    auto windowIt = windows_.find(pid);
+    if (windowIt == windows_.end()) {
+        windowIt = windows_.emplace(pid, Window()).first;
+        windowIt->second.deadlineMs = deadlineMs;
+        closeDelayMs = budgetIt->second;
+    } else if (deadlineMs < windowIt->second.deadlineMs) {
+        // a more urgent type joined, the close scheduled for the old deadline finds nothing due and is ignored
+        windowIt->second.deadlineMs = deadlineMs;
+        closeDelayMs = budgetIt->second;
+    }
+    windowIt->second.keys.insert(std::make_pair(mask, slotId));
+    statistics_[mask].updates++;
+    return true;
+}
+
+bool TelephonyStateRegistryWakeup::Close(pid_t pid, int64_t nowMs, std::set<PendingKey> &keys)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto windowIt = windows_.find(pid);
+    if (windowIt == windows_.end() || windowIt->second.deadlineMs > nowMs + CLOSE_SLACK_MS) {
+        return false;
+    }
+    keys.swap(windowIt->second.keys);
+    windows_.erase(windowIt);
+    for (const auto &key : keys) {
+        statistics_[key.first].deliveries++;
+    }
+    closedCount_++;
+    return true;
+}
+
+std::map<uint32_t, WakeupStatistics> TelephonyStateRegistryWakeup::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+}
+
+uint64_t TelephonyStateRegistryWakeup::GetClosedCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closedCount_;
+}
+} // namespace Telephony
+} // namespace OHOS
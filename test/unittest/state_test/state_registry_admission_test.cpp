@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_admission.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryAdmissionTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryAdmissionTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryAdmissionTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryAdmissionTest::SetUp(void)
+{
+}
+
+void StateRegistryAdmissionTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryAdmission_Coalesce
+ * @tc.name     telephony state registry admission test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryAdmissionTest, TelephonyStateRegistryAdmission_Coalesce, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryAdmission admission(4, 1);
+    uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS;
+    int32_t slotId = 0;
+    EXPECT_TRUE(admission.Enter(mask, slotId, true));
+    EXPECT_FALSE(admission.Enter(mask, slotId, true));
+    EXPECT_FALSE(admission.Enter(mask, slotId, true));
+    EXPECT_TRUE(admission.Enter(mask, slotId + 1, true));
+    EXPECT_EQ(admission.GetCoalescedCount(), 2u);
+    EXPECT_EQ(admission.GetConcurrentFanOuts(), 2u);
+    EXPECT_EQ(admission.GetQueued(), 1u);
+    EXPECT_TRUE(admission.Leave(mask, slotId));
+    EXPECT_EQ(admission.GetQueued(), 0u);
+    EXPECT_FALSE(admission.Leave(mask, slotId));
+    EXPECT_FALSE(admission.Leave(mask, slotId + 1));
+    EXPECT_EQ(admission.GetConcurrentFanOuts(), 0u);
+    EXPECT_TRUE(admission.Enter(mask, slotId, true));
+    EXPECT_FALSE(admission.Leave(mask, slotId));
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryAdmission_Watermark
+ * @tc.name     telephony state registry admission test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryAdmissionTest, TelephonyStateRegistryAdmission_Watermark, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryAdmission admission(3, 1);
+    uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS;
+    for (int32_t slotId = 0; slotId < 3; slotId++) {
+        EXPECT_TRUE(admission.Enter(mask, slotId, false));
+    }
+    EXPECT_FALSE(admission.IsThrottled());
+    EXPECT_FALSE(admission.CheckBackpressure());
+    EXPECT_TRUE(admission.Enter(mask, 0, true));
+    EXPECT_FALSE(admission.Enter(mask, 0, true));
+    EXPECT_TRUE(admission.Enter(mask, 1, true));
+    EXPECT_FALSE(admission.Enter(mask, 1, true));
+    admission.AddQueued();
+    EXPECT_TRUE(admission.IsThrottled());
+    EXPECT_EQ(admission.GetHighWatermarkHits(), 1u);
+    EXPECT_TRUE(admission.CheckBackpressure());
+    EXPECT_TRUE(admission.Leave(mask, 0));
+    EXPECT_TRUE(admission.IsThrottled());
+    admission.RemoveQueued();
+    EXPECT_FALSE(admission.IsThrottled());
+    EXPECT_FALSE(admission.CheckBackpressure());
+    EXPECT_EQ(admission.GetMaxQueued(), 3u);
+    EXPECT_EQ(admission.GetThrottledCount(), 1u);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -17,8 +17,13 @@
 
 #include "state_registry_branch_test.h"
 
+#include <condition_variable>
+#include <future>
+#include <thread>
+
 #include "core_service_client.h"
 #include "sim_state_type.h"
+#include "state_registry_inner_errors.h"
 #include "state_registry_test.h"
 #include "telephony_ext_wrapper.h"
 #include "telephony_log_wrapper.h"
@@ -36,6 +41,7 @@ using namespace testing::ext;
 using namespace testing;
 static constexpr int32_t DATA_STATE_CONNECTING = 1;
 static constexpr int32_t NETWORK_TYPE_GSM = 1;
+static constexpr int32_t SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT = 999;
 static constexpr int32_t DATA_FLOW_TYPE_DOWN = 1;
 static constexpr int32_t PROFILE_STATE_DISCONNECTING = 3;
 class StateRegistryBranchTest : public testing::Test {
@@ -516,5 +522,623 @@ HWTEST_F(StateRegistryBranchTest, Client_UpdateSimActiveState, Function | Medium
         slotId, enable);
     EXPECT_NE(ret, TELEPHONY_ERR_IPC_CONNECT_STUB_FAIL);
 }
+
+/**
+ * @tc.number   TelephonyStateRegistryService_UpdateDefaultDataSlotId
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_UpdateDefaultDataSlotId, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    int32_t slotId = 0;
+    TelephonyStateRegistryRecord record;
+    record.telephonyObserver_ = std::make_unique<TelephonyObserver>().release();
+    record.slotId_ = SIM_SLOT_ID_FOR_DEFAULT_CONN_EVENT;
+    record.mask_ = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    service->stateRecords_.push_back(record);
+    EXPECT_EQ(TELEPHONY_SUCCESS, service->UpdateCellularDataFlow(slotId, 0));
+    service->defaultDataSlotId_ = slotId + 1;
+    EXPECT_EQ(TELEPHONY_STATE_REGISTRY_DATA_NOT_EXIST, service->UpdateCellularDataFlow(slotId, 0));
+    EXPECT_EQ(TELEPHONY_STATE_REGISTRY_SLODID_ERROR, service->UpdateDefaultDataSlotId(-1));
+    EXPECT_EQ(TELEPHONY_SUCCESS, service->UpdateDefaultDataSlotId(slotId));
+    EXPECT_EQ(slotId, service->GetDefaultDataSlotId());
+    EXPECT_EQ(TELEPHONY_SUCCESS, service->UpdateCellularDataFlow(slotId, 0));
+    service->stateRecords_.pop_back();
+    service->defaultDataSlotId_ = -1;
+    service->cellularDataFlow_.erase(slotId);
+}
+
+class BlockingCallStateObserver : public TelephonyObserver {
+public:
+    explicit BlockingCallStateObserver(bool blocking) : blocking_(blocking) {}
+
+    void OnCallStateUpdated(int32_t slotId, int32_t callState, const std::u16string &phoneNumber) override
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        callStates_.push_back(callState);
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return !blocking_; });
+    }
+
+    bool WaitCallStateCount(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(WAIT_SECONDS), [this, count] {
+            return callStates_.size() >= count;
+        });
+    }
+
+    void Release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        blocking_ = false;
+        cv_.notify_all();
+    }
+
+    std::vector<int32_t> GetCallStates()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return callStates_;
+    }
+
+private:
+    static constexpr int32_t WAIT_SECONDS = 5;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool blocking_ = false;
+    std::vector<int32_t> callStates_;
+};
+
+/**
+ * @tc.number   TelephonyStateRegistryService_RegisterNotifyNow
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_RegisterNotifyNow, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const int32_t observerCount = 100;
+    const pid_t basePid = 20000;
+    const int32_t idle = static_cast<int32_t>(CallStatus::CALL_STATUS_IDLE);
+    const int32_t active = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    const uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    service->UpdateCallState(idle, u"");
+    std::vector<sptr<BlockingCallStateObserver>> observers;
+    for (int32_t i = 0; i < observerCount; i++) {
+        observers.push_back(new BlockingCallStateObserver(i == 0));
+    }
+    // the first observer blocks in its initial delivery, holding the registering thread
+    std::thread registerThread([&service, &observers, basePid, mask]() {
+        for (size_t i = 0; i < observers.size(); i++) {
+            service->RegisterStateChange(observers[i], -1, mask, "", true, basePid + static_cast<pid_t>(i), 0,
+                basePid + static_cast<int32_t>(i), "");
+        }
+    });
+    ASSERT_TRUE(observers[0]->WaitCallStateCount(1));
+    auto update = std::async(std::launch::async, [&service, active]() {
+        return service->UpdateCallState(active, u"");
+    });
+    bool updated = update.wait_for(std::chrono::seconds(1)) == std::future_status::ready;
+    observers[0]->Release();
+    registerThread.join();
+    EXPECT_TRUE(updated);
+    update.get();
+    // the update held back during the initial delivery follows the snapshot
+    std::vector<int32_t> firstStates = observers[0]->GetCallStates();
+    ASSERT_EQ(firstStates.size(), 2u);
+    EXPECT_EQ(firstStates[0], idle);
+    EXPECT_EQ(firstStates[1], active);
+    EXPECT_EQ(observers[observerCount - 1]->GetCallStates().back(), active);
+    EXPECT_TRUE(service->initialPending_.empty());
+    for (int32_t i = 0; i < observerCount; i++) {
+        service->UnregisterStateChange(-1, mask, basePid + i, basePid + i);
+    }
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_MergeRecord
+ * @tc.name     telephony state registry record merge test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_MergeRecord, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t flowMask = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    const pid_t pid = 4000;
+    service->stateRecords_.clear();
+    sptr<TelephonyObserver> observer = new TelephonyObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, callMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, flowMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    // the second mask joins the record of the observer object
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->stateRecords_[0].mask_, callMask | flowMask);
+    // a registration for a (slot, mask) the record already covers updates it, as before
+    sptr<TelephonyObserver> other = new TelephonyObserver();
+    EXPECT_EQ(service->RegisterStateChange(other, -1, flowMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    EXPECT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->UnregisterStateChange(-1, callMask, pid, pid), TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->stateRecords_[0].mask_, flowMask);
+    EXPECT_EQ(service->UnregisterStateChange(-1, callMask, pid, pid), TELEPHONY_STATE_UNREGISTRY_DATA_NOT_EXIST);
+    EXPECT_EQ(service->UnregisterStateChange(-1, flowMask, pid, pid), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(service->stateRecords_.empty());
+}
+
+class CallStateVariantObserver : public TelephonyObserver {
+public:
+    void OnCallStateUpdated(int32_t slotId, int32_t callState, const std::u16string &phoneNumber) override
+    {
+        callStates_.push_back(callState);
+    }
+
+    void OnCallStateUpdatedEx(int32_t slotId, int32_t callStateEx) override
+    {
+        callStatesEx_.push_back(callStateEx);
+    }
+
+    void OnCCallStateUpdated(int32_t slotId, int32_t callState, const std::u16string &number) override
+    {
+        cCallStates_.push_back(callState);
+        cCallNumbers_.push_back(number);
+    }
+
+    std::vector<int32_t> callStates_;
+    std::vector<int32_t> callStatesEx_;
+    std::vector<int32_t> cCallStates_;
+    std::vector<std::u16string> cCallNumbers_;
+};
+
+/**
+ * @tc.number   TelephonyStateRegistryService_MergedCallState
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_MergedCallState, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t callExMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX;
+    const int32_t active = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    const int32_t slotId = 0;
+    const pid_t pid = 4100;
+    service->stateRecords_.clear();
+    sptr<CallStateVariantObserver> observer = new CallStateVariantObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, slotId, callMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    EXPECT_EQ(
+        service->RegisterStateChange(observer, slotId, callExMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    // the merged record gets every variant it observes, not only the first one
+    EXPECT_EQ(service->UpdateCallStateForSlotId(slotId, active, u""), TELEPHONY_SUCCESS);
+    ASSERT_EQ(observer->callStates_.size(), 1u);
+    ASSERT_EQ(observer->callStatesEx_.size(), 1u);
+    EXPECT_EQ(observer->callStatesEx_[0], active);
+    EXPECT_EQ(service->UnregisterStateChange(slotId, callMask, pid, pid), TELEPHONY_SUCCESS);
+    EXPECT_EQ(service->UnregisterStateChange(slotId, callExMask, pid, pid), TELEPHONY_SUCCESS);
+    service->callState_[slotId] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+    service->callIncomingNumber_.erase(slotId);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_CCallStateReplay
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_CCallStateReplay, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    const uint32_t cCallMask = TelephonyObserverBroker::OBSERVER_MASK_CCALL_STATE;
+    const int32_t slotId = 0;
+    const pid_t pid = 4200;
+    sptr<CallStateVariantObserver> observer = new CallStateVariantObserver();
+    TelephonyStateRegistryRecord record;
+    record.telephonyObserver_ = observer.GetRefPtr();
+    record.slotId_ = slotId;
+    record.mask_ = cCallMask;
+    record.pid_ = pid;
+    // token 0 holds no permission, as if MANAGE_CALL_FOR_DEVICES was revoked while the process was frozen
+    record.tokenId_ = 0;
+    service->stateRecords_.clear();
+    service->stateRecords_.push_back(record);
+    service->callState_[slotId] = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    service->callIncomingNumber_[slotId] = u"10086";
+    std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+    service->processState_.SetDeferred(pid, true, pending);
+    EXPECT_TRUE(service->processState_.Defer(pid, cCallMask, slotId));
+    // the flush on thaw replays the cached state with the checks of the live update
+    service->OnProcessStateChanged(pid, false);
+    EXPECT_TRUE(observer->cCallStates_.empty());
+    service->NotifyCachedState(service->stateRecords_[0], cCallMask, slotId);
+    EXPECT_TRUE(observer->cCallNumbers_.empty());
+    service->stateRecords_.clear();
+    service->callState_[slotId] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+    service->callIncomingNumber_.erase(slotId);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_AllSlotsCallState
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_AllSlotsCallState, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const int32_t active = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    const int32_t idle = static_cast<int32_t>(CallStatus::CALL_STATUS_IDLE);
+    const pid_t pid = 4300;
+    service->stateRecords_.clear();
+    sptr<CallStateVariantObserver> observer = new CallStateVariantObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, SIM_SLOT_ID_FOR_ALL_SLOTS, callMask, "", false, pid, 0, pid, ""),
+        TELEPHONY_SUCCESS);
+    // the all slots record gets the per-slot and the slot-less call state
+    EXPECT_EQ(service->UpdateCallStateForSlotId(0, active, u""), TELEPHONY_SUCCESS);
+    EXPECT_EQ(service->UpdateCallState(idle, u""), TELEPHONY_SUCCESS);
+    std::vector<int32_t> expected = { active, idle };
+    EXPECT_EQ(observer->callStates_, expected);
+    EXPECT_EQ(service->UnregisterStateChange(SIM_SLOT_ID_FOR_ALL_SLOTS, callMask, pid, pid), TELEPHONY_SUCCESS);
+    service->callState_[0] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+    service->callState_[-1] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_MergeDuringSnapshot
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_MergeDuringSnapshot, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t callExMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE_EX;
+    const int32_t active = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    const pid_t pid = 4400;
+    service->stateRecords_.clear();
+    service->initialPending_.clear();
+    sptr<CallStateVariantObserver> observer = new CallStateVariantObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, 0, callMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    // the snapshot of the first registration is still in flight when the update comes in
+    service->BeginInitialDelivery(service->stateRecords_[0]);
+    uint64_t firstSeq = service->stateRecords_[0].snapshotSeq_;
+    EXPECT_EQ(service->UpdateCallStateForSlotId(0, active, u""), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(observer->callStates_.empty());
+    // a registration merged in meanwhile delivers its own snapshot, the held update still waits
+    EXPECT_EQ(service->RegisterStateChange(observer, 0, callExMask, "", true, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->stateRecords_[0].snapshotSeq_, firstSeq);
+    EXPECT_EQ(observer->callStatesEx_.size(), 1u);
+    EXPECT_TRUE(observer->callStates_.empty());
+    service->FinishInitialDelivery(firstSeq);
+    std::vector<int32_t> expected = { active };
+    EXPECT_EQ(observer->callStates_, expected);
+    EXPECT_TRUE(service->initialPending_.empty());
+    service->stateRecords_.clear();
+    service->callState_[0] = static_cast<int32_t>(CallStatus::CALL_STATUS_UNKNOWN);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_CesRemoved
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_CesRemoved, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    bool wasReady = service->GetEventBuffer().IsReady();
+    service->SetPackageChangeSource(std::make_shared<LocalPackageChangeSource>());
+    EXPECT_TRUE(service->GetIdentityCache().IsEnabled());
+    std::string bundleName = "";
+    std::string appIdentifier = "";
+    uint64_t generation = 0;
+    EXPECT_FALSE(service->identityCache_.Lookup(20030, 1, bundleName, appIdentifier, generation));
+    service->identityCache_.Insert(20030, 1, "bundle", "appId", generation);
+    EXPECT_EQ(service->GetIdentityCache().GetSize(), 1u);
+    // package changes cannot be observed while the common event service is gone
+    service->OnRemoveSystemAbility(COMMON_EVENT_SERVICE_ID, "");
+    EXPECT_FALSE(service->GetIdentityCache().IsEnabled());
+    EXPECT_EQ(service->GetIdentityCache().GetSize(), 0u);
+    EXPECT_EQ(service->packageChangeSource_, nullptr);
+    service->eventBuffer_.SetReady(wasReady);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_StateMirror
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_StateMirror, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t cfuMask = TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR;
+    auto mirror = service->mirror_;
+    auto systemMirror = service->systemMirror_;
+    service->mirror_ = TelephonyObserverMirror::Create(2);
+    service->systemMirror_ = TelephonyObserverMirror::Create(2);
+    ASSERT_TRUE(service->mirror_ != nullptr && service->systemMirror_ != nullptr);
+    service->callState_[0] = static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE);
+    service->cfuResult_[0] = true;
+    service->MirrorState(callMask, 0);
+    service->MirrorState(cfuMask, 0);
+    // an ordinary app maps the region without the types only system apps observe
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(false));
+    sptr<Ashmem> ashmem = nullptr;
+    EXPECT_EQ(service->GetStateMirror(ashmem), TELEPHONY_SUCCESS);
+    EXPECT_EQ(ashmem, service->mirror_->GetAshmem());
+    TelephonyObserverSlotState state;
+    ASSERT_TRUE(service->mirror_->Read(0, state));
+    EXPECT_EQ(state.reported, callMask);
+    EXPECT_EQ(state.callState, static_cast<int32_t>(CallStatus::CALL_STATUS_ACTIVE));
+    EXPECT_FALSE(state.cfuResult);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    EXPECT_EQ(service->GetStateMirror(ashmem), TELEPHONY_SUCCESS);
+    EXPECT_EQ(ashmem, service->systemMirror_->GetAshmem());
+    ASSERT_TRUE(service->systemMirror_->Read(0, state));
+    EXPECT_EQ(state.reported, callMask | cfuMask);
+    EXPECT_TRUE(state.cfuResult);
+    service->mirror_ = mirror;
+    service->systemMirror_ = systemMirror;
+    service->callState_.erase(0);
+    service->cfuResult_.erase(0);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_DeliveryPolicy
+ * @tc.name     telephony state registry delivery policy test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_DeliveryPolicy, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t flowMask = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    const pid_t pid = 4100;
+    TelephonyObserverOptions periodic;
+    periodic.SetDeliveryPolicy(callMask, DELIVERY_MODE_PERIODIC, 1000);
+    MessageParcel parcel;
+    ASSERT_TRUE(periodic.Marshalling(parcel));
+    TelephonyObserverOptions readOptions;
+    ASSERT_TRUE(readOptions.ReadFromParcel(parcel));
+    EXPECT_EQ(readOptions.GetDeliveryPolicy(callMask).mode, static_cast<uint32_t>(DELIVERY_MODE_PERIODIC));
+    EXPECT_EQ(readOptions.GetDeliveryPolicy(callMask).periodMs, 1000u);
+    EXPECT_EQ(readOptions.GetDeliveryPolicy(flowMask).mode, static_cast<uint32_t>(DELIVERY_MODE_EVERY));
+
+    service->stateRecords_.clear();
+    sptr<TelephonyObserver> observer = new TelephonyObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, callMask, "", false, pid, 0, pid, "", periodic),
+        TELEPHONY_SUCCESS);
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, flowMask, "", false, pid, 0, pid, ""), TELEPHONY_SUCCESS);
+    // the types share the record of the observer object and each keeps its own delivery
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->stateRecords_[0].mask_, callMask | flowMask);
+    EXPECT_NE(service->stateRecords_[0].pacingId_, 0u);
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(callMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_PERIODIC));
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(flowMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_EVERY));
+    TelephonyObserverOptions latest;
+    latest.SetDeliveryPolicy(flowMask, DELIVERY_MODE_LATEST_ONLY, 0);
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, flowMask, "", false, pid, 0, pid, "", latest),
+        TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(callMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_PERIODIC));
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(flowMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_LATEST_ONLY));
+    EXPECT_EQ(service->UnregisterStateChange(-1, callMask, pid, pid), TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(callMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_EVERY));
+    // the options live beside the record and go with it
+    uint64_t recordId = service->stateRecords_[0].recordId_;
+    EXPECT_NE(recordId, 0u);
+    EXPECT_EQ(service->UnregisterStateChange(-1, flowMask, pid, pid), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(service->stateRecords_.empty());
+    EXPECT_EQ(service->recordStates_.count(recordId), 0u);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_LimiterDefaults
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_LimiterDefaults, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    service->InitLimiter();
+    const uint32_t cfuMask = TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR;
+    LimiterConfig config;
+    ASSERT_TRUE(service->GetLimiter().GetConfig(TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE, config));
+    EXPECT_TRUE(config.IsEnabled());
+    EXPECT_TRUE(config.coalescible);
+    ASSERT_TRUE(service->GetLimiter().GetConfig(TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE, config));
+    EXPECT_TRUE(config.IsEnabled());
+    EXPECT_FALSE(config.coalescible);
+    ASSERT_TRUE(service->GetLimiter().GetConfig(cfuMask, config));
+    EXPECT_FALSE(config.IsEnabled());
+
+    // an edge-type channel drops a repeated value inside the window but never a changed one
+    const int32_t slotId = 0;
+    service->limiter_.SetConfig(cfuMask, { 60000, 0, 0, false });
+    service->UpdateCfuIndicator(slotId, true);
+    service->UpdateCfuIndicator(slotId, true);
+    service->UpdateCfuIndicator(slotId, false);
+    LimiterStatistics statistics = service->GetLimiter().GetStatistics()[cfuMask];
+    EXPECT_EQ(statistics.delivered, 2u);
+    EXPECT_EQ(statistics.dropped, 1u);
+    service->limiter_.SetConfig(cfuMask, LimiterConfig());
+    service->cfuResult_.erase(slotId);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_QuotaKeepsMask
+ * @tc.name     telephony state registry quota test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_QuotaKeepsMask, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    ASSERT_TRUE(permission_ != nullptr);
+    EXPECT_CALL(*permission_, CheckPermission(_)).WillRepeatedly(Return(true));
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const uint32_t flowMask = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    const pid_t pid = 4600;
+    uint32_t uidLimit = service->GetQuota().GetUidLimit();
+    uint32_t pidLimit = service->GetQuota().GetPidLimit();
+    TelephonyObserverOptions periodic;
+    periodic.SetDeliveryPolicy(callMask, DELIVERY_MODE_PERIODIC, 1000);
+    service->stateRecords_.clear();
+    sptr<TelephonyObserver> observer = new TelephonyObserver();
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, callMask | flowMask, "", false, pid, 0, pid, "", periodic),
+        TELEPHONY_SUCCESS);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    uint64_t pacingId = service->stateRecords_[0].pacingId_;
+    EXPECT_NE(pacingId, 0u);
+    // the call state would need a record of its own, the process already holds all it may
+    service->quota_.SetLimits(0, 1);
+    TelephonyObserverOptions ring;
+    ring.eventRing_ = true;
+    EXPECT_EQ(service->RegisterStateChange(observer, -1, callMask, "", false, pid, 0, pid, "", ring),
+        TELEPHONY_STATE_REGISTRY_QUOTA_EXCEEDED);
+    ASSERT_EQ(service->stateRecords_.size(), 1u);
+    EXPECT_EQ(service->stateRecords_[0].mask_, callMask | flowMask);
+    EXPECT_EQ(service->stateRecords_[0].pacingId_, pacingId);
+    EXPECT_EQ(service->GetRecordState(service->stateRecords_[0]).options_.GetDeliveryPolicy(callMask).mode,
+        static_cast<uint32_t>(DELIVERY_MODE_PERIODIC));
+    service->quota_.SetLimits(uidLimit, pidLimit);
+    EXPECT_EQ(service->UnregisterStateChange(-1, callMask | flowMask, pid, pid), TELEPHONY_SUCCESS);
+    EXPECT_TRUE(service->stateRecords_.empty());
+}
+
+class IndicatorObserver : public TelephonyObserver {
+public:
+    int32_t cfuCount_ = 0;
+    int32_t voiceMailCount_ = 0;
+
+    void OnCfuIndicatorUpdated(int32_t slotId, bool cfuResult) override
+    {
+        cfuCount_++;
+    }
+
+    void OnVoiceMailMsgIndicatorUpdated(int32_t slotId, bool voiceMailMsgResult) override
+    {
+        voiceMailCount_++;
+    }
+};
+
+class BatchRemoteObject : public TestIRemoteObject {
+public:
+    int32_t requests_ = 0;
+    sptr<IndicatorObserver> observer_;
+
+    int SendRequest(uint32_t code, MessageParcel &data, MessageParcel &reply, MessageOption &option) override
+    {
+        requests_++;
+        requestCode_ = code;
+        return observer_ == nullptr ? 0 : observer_->OnRemoteRequest(code, data, reply, option);
+    }
+};
+
+/**
+ * @tc.number   TelephonyObserverProxy_BatchScope
+ * @tc.name     telephony observer proxy test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyObserverProxy_BatchScope, Function | MediumTest | Level1)
+{
+    sptr<IndicatorObserver> observer = new IndicatorObserver();
+    sptr<BatchRemoteObject> remote = new BatchRemoteObject();
+    remote->observer_ = observer;
+    sptr<TelephonyObserverProxy> cfuProxy = new TelephonyObserverProxy(remote);
+    sptr<TelephonyObserverProxy> voiceMailProxy = new TelephonyObserverProxy(remote);
+    {
+        TelephonyObserverProxy::BatchScope batchScope;
+        cfuProxy->OnCfuIndicatorUpdated(0, true);
+        voiceMailProxy->OnVoiceMailMsgIndicatorUpdated(0, true);
+        EXPECT_EQ(remote->requests_, 0);
+    }
+    EXPECT_EQ(remote->requests_, 1);
+    EXPECT_EQ(remote->requestCode_, static_cast<uint32_t>(ObserverBrokerInnerCode::ON_UPDATE_BATCH));
+    EXPECT_EQ(observer->cfuCount_, 1);
+    EXPECT_EQ(observer->voiceMailCount_, 1);
+    {
+        TelephonyObserverProxy::BatchScope batchScope;
+        cfuProxy->OnCfuIndicatorUpdated(0, false);
+    }
+    EXPECT_EQ(remote->requests_, 2);
+    EXPECT_EQ(remote->requestCode_,
+        static_cast<uint32_t>(TelephonyObserverBroker::ObserverBrokerCode::ON_CFU_INDICATOR_UPDATED));
+    EXPECT_EQ(observer->cfuCount_, 2);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryService_ThawBatch
+ * @tc.name     telephony state registry service test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryBranchTest, TelephonyStateRegistryService_ThawBatch, Function | MediumTest | Level1)
+{
+    auto service = DelayedSingleton<TelephonyStateRegistryService>::GetInstance();
+    ASSERT_TRUE(service != nullptr);
+    const uint32_t cfuMask = TelephonyObserverBroker::OBSERVER_MASK_CFU_INDICATOR;
+    const uint32_t voiceMailMask = TelephonyObserverBroker::OBSERVER_MASK_VOICE_MAIL_MSG_INDICATOR;
+    const int32_t slotId = 0;
+    const pid_t pid = 2900;
+    sptr<IndicatorObserver> observer = new IndicatorObserver();
+    sptr<BatchRemoteObject> remote = new BatchRemoteObject();
+    remote->observer_ = observer;
+    TelephonyStateRegistryRecord record;
+    record.telephonyObserver_ = new TelephonyObserverProxy(remote);
+    record.slotId_ = slotId;
+    record.mask_ = cfuMask | voiceMailMask;
+    record.pid_ = pid;
+    service->stateRecords_.clear();
+    service->stateRecords_.push_back(record);
+    service->cfuResult_[slotId] = true;
+    service->voiceMailMsgResult_[slotId] = true;
+    std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+    service->processState_.SetDeferred(pid, true, pending);
+    EXPECT_TRUE(service->processState_.Defer(pid, cfuMask, slotId));
+    EXPECT_TRUE(service->processState_.Defer(pid, voiceMailMask, slotId));
+    service->OnProcessStateChanged(pid, false);
+    EXPECT_EQ(remote->requests_, 1);
+    EXPECT_EQ(remote->requestCode_, static_cast<uint32_t>(ObserverBrokerInnerCode::ON_UPDATE_BATCH));
+    EXPECT_EQ(observer->cfuCount_, 1);
+    EXPECT_EQ(observer->voiceMailCount_, 1);
+    service->stateRecords_.clear();
+    service->cfuResult_.erase(slotId);
+    service->voiceMailMsgResult_.erase(slotId);
+}
 } // namespace Telephony
 } // namespace OHOS
\ No newline at end of file
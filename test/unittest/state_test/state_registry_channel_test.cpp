@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_channel.h"
+#include "telephony_state_registry_record.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryChannelTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryChannelTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryChannelTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryChannelTest::SetUp(void)
+{
+}
+
+void StateRegistryChannelTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryChannel_Store
+ * @tc.name     telephony state registry channel test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryChannelTest, TelephonyStateRegistryChannel_Store, Function | MediumTest | Level1)
+{
+    EXPECT_FALSE(CfuIndicatorChannel::COALESCIBLE);
+    EXPECT_FALSE(SimActiveStateChannel::FOLLOWS_DEFAULT_DATA_SLOT);
+    EXPECT_TRUE(CellularDataFlowChannel::COALESCIBLE);
+    EXPECT_TRUE(CellularDataFlowChannel::FOLLOWS_DEFAULT_DATA_SLOT);
+    CellularDataFlowChannel::Cache cache;
+    EXPECT_TRUE(CellularDataFlowChannel::Store(cache, 0, 0));
+    EXPECT_FALSE(CellularDataFlowChannel::Store(cache, 0, 0));
+    EXPECT_TRUE(CellularDataFlowChannel::Store(cache, 0, 1));
+    EXPECT_TRUE(CellularDataFlowChannel::Store(cache, 1, 1));
+    EXPECT_EQ(cache[0], 1);
+    EXPECT_EQ(cache.size(), 2u);
+    TelephonyStateRegistryRecord record;
+    EXPECT_FALSE(CellularDataFlowChannel::IsListening(record));
+    record.mask_ = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    EXPECT_FALSE(CellularDataFlowChannel::IsListening(record));
+    record.telephonyObserver_ = std::make_unique<TelephonyObserver>().release();
+    EXPECT_TRUE(CellularDataFlowChannel::IsListening(record));
+    EXPECT_FALSE(CfuIndicatorChannel::IsListening(record));
+}
+} // namespace Telephony
+} // namespace OHOS
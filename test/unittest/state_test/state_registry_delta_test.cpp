@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "cell_information.h"
+#include "message_parcel.h"
+#include "network_state.h"
+#include "telephony_observer_delta.h"
+#include "telephony_observer_options.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryDeltaTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryDeltaTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryDeltaTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryDeltaTest::SetUp(void)
+{
+}
+
+void StateRegistryDeltaTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyObserverDelta_Codec
+ * @tc.name     telephony observer delta test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryDeltaTest, TelephonyObserverDelta_Codec, Function | MediumTest | Level1)
+{
+    sptr<NetworkState> networkState = new NetworkState();
+    networkState->SetOperatorInfo("long", "short", "46001", DomainType::DOMAIN_TYPE_CS);
+    TelephonyObserverDeltaEncoder networkEncoder;
+    TelephonyObserverDeltaDecoder networkDecoder;
+    TelephonyObserverDeltaValue value;
+    TelephonyObserverDeltaValue decoded;
+    for (int32_t i = 0; i < 2; i++) {
+        networkState->SetNetworkState(
+            i == 0 ? RegServiceState::REG_STATE_SEARCH : RegServiceState::REG_STATE_IN_SERVICE,
+            DomainType::DOMAIN_TYPE_CS);
+        ASSERT_TRUE(TelephonyObserverDelta::FromNetworkState(networkState, value));
+        MessageParcel parcel;
+        ASSERT_TRUE(networkEncoder.Write(parcel, value));
+        ASSERT_TRUE(networkDecoder.Read(parcel, decoded));
+        sptr<NetworkState> rebuilt = TelephonyObserverDelta::ToNetworkState(decoded);
+        ASSERT_TRUE(rebuilt != nullptr);
+        EXPECT_TRUE(*rebuilt == *networkState);
+    }
+
+    std::vector<sptr<CellInformation>> cells;
+    for (int32_t cellId = 1; cellId <= 4; cellId++) {
+        sptr<GsmCellInformation> cell = new GsmCellInformation();
+        cell->Init(0, 0, cellId);
+        cell->SetGsmParam(0, cellId, cellId);
+        cells.push_back(cell);
+    }
+    TelephonyObserverDeltaEncoder cellEncoder;
+    TelephonyObserverDeltaDecoder cellDecoder;
+    ASSERT_TRUE(TelephonyObserverDelta::FromCellInfo(cells, value));
+    MessageParcel full;
+    ASSERT_TRUE(cellEncoder.Write(full, value));
+    ASSERT_TRUE(cellDecoder.Read(full, decoded));
+    // one cell changed, one removed and one added
+    sptr<GsmCellInformation> changed = new GsmCellInformation();
+    changed->Init(0, 0, 1);
+    changed->SetGsmParam(0, 1, 100);
+    sptr<GsmCellInformation> added = new GsmCellInformation();
+    added->Init(0, 0, 5);
+    cells = { cells[3], changed, cells[1], added };
+    ASSERT_TRUE(TelephonyObserverDelta::FromCellInfo(cells, value));
+    MessageParcel delta;
+    ASSERT_TRUE(cellEncoder.Write(delta, value));
+    EXPECT_LT(delta.GetDataSize(), full.GetDataSize());
+    MessageParcel deltaCopy;
+    deltaCopy.WriteBuffer(reinterpret_cast<const void *>(delta.GetData()), delta.GetDataSize());
+    ASSERT_TRUE(cellDecoder.Read(delta, decoded));
+    std::vector<sptr<CellInformation>> rebuilt;
+    TelephonyObserverDelta::ToCellInfo(decoded, rebuilt);
+    ASSERT_EQ(rebuilt.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+        EXPECT_EQ(rebuilt[i]->GetCellId(), cells[i]->GetCellId());
+        EXPECT_EQ(rebuilt[i]->GetArfcn(), cells[i]->GetArfcn());
+    }
+
+    // a receiver without the base asks for a resync, which the sender answers with the full value
+    TelephonyObserverDeltaDecoder otherDecoder;
+    EXPECT_FALSE(otherDecoder.Read(deltaCopy, decoded));
+    cellEncoder.Reset();
+    MessageParcel resync;
+    ASSERT_TRUE(cellEncoder.Write(resync, value));
+    EXPECT_TRUE(otherDecoder.Read(resync, decoded));
+    EXPECT_EQ(decoded.size(), cells.size());
+
+    // options of older clients do not carry the delta flag
+    MessageParcel options;
+    options.WriteUint32(0);
+    options.WriteUint32(0);
+    TelephonyObserverOptions readOptions;
+    readOptions.deltaEncoding_ = true;
+    ASSERT_TRUE(readOptions.ReadFromParcel(options));
+    EXPECT_FALSE(readOptions.deltaEncoding_);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "common_event_manager.h"
+#include "telephony_state_registry_event_buffer.h"
+#include "want.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryEventBufferTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryEventBufferTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryEventBufferTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryEventBufferTest::SetUp(void)
+{
+}
+
+void StateRegistryEventBufferTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryEventBuffer_Flush
+ * @tc.name     telephony state registry event buffer test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryEventBufferTest, TelephonyStateRegistryEventBuffer_Flush, Function | MediumTest | Level1)
+{
+    std::vector<std::string> published;
+    TelephonyStateRegistryEventBuffer buffer(2,
+        [&published](const EventFwk::CommonEventData &data, const EventFwk::CommonEventPublishInfo &info) {
+            published.push_back(data.GetWant().GetAction());
+            return true;
+        });
+    auto makeEvent = [](const std::string &action) {
+        AAFwk::Want want;
+        want.SetAction(action);
+        EventFwk::CommonEventData data;
+        data.SetWant(want);
+        return data;
+    };
+    EventFwk::CommonEventPublishInfo info;
+    EXPECT_TRUE(buffer.Publish(makeEvent("a"), info));
+    EXPECT_EQ(published.size(), 1u);
+    buffer.Watch();
+    EXPECT_TRUE(buffer.Publish(makeEvent("b"), info));
+    EXPECT_TRUE(buffer.Publish(makeEvent("c"), info));
+    EXPECT_TRUE(buffer.Publish(makeEvent("d"), info));
+    EXPECT_EQ(published.size(), 1u);
+    EXPECT_EQ(buffer.GetPendingCount(), 2u);
+    EXPECT_EQ(buffer.GetDroppedCount(), 1u);
+    buffer.SetReady(true);
+    ASSERT_EQ(published.size(), 3u);
+    EXPECT_EQ(published[1], "c");
+    EXPECT_EQ(published[2], "d");
+    EXPECT_EQ(buffer.GetFlushedCount(), 2u);
+    EXPECT_TRUE(buffer.Publish(makeEvent("e"), info));
+    EXPECT_EQ(published.size(), 4u);
+    buffer.SetReady(false);
+    EXPECT_TRUE(buffer.Publish(makeEvent("f"), info));
+    EXPECT_EQ(buffer.GetPendingCount(), 1u);
+}
+} // namespace Telephony
+} // namespace OHOS
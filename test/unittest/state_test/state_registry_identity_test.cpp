@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_state_registry_identity.h"
+#include "telephony_state_registry_package_change.h"
+#include "telephony_state_registry_record.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryIdentityTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryIdentityTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryIdentityTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryIdentityTest::SetUp(void)
+{
+}
+
+void StateRegistryIdentityTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryIdentityPool_Intern
+ * @tc.name     telephony state registry identity test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryIdentityTest, TelephonyStateRegistryIdentityPool_Intern, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryIdentityPool pool;
+    auto first = pool.Intern(100, 20020, 1, "bundle", "appId");
+    auto second = pool.Intern(100, 20020, 1, "bundle", "appId");
+    EXPECT_EQ(first, second);
+    auto other = pool.Intern(101, 20021, 2, "other", "");
+    EXPECT_NE(first, other);
+    EXPECT_EQ(pool.GetSize(), 2u);
+    TelephonyStateRegistryRecord record;
+    EXPECT_TRUE(record.GetBundleName().empty());
+    EXPECT_EQ(record.GetUid(), 0);
+    record.identity_ = first;
+    EXPECT_EQ(record.GetBundleName(), "bundle");
+    EXPECT_EQ(record.GetAppIdentifier(), "appId");
+    EXPECT_EQ(record.GetUid(), 20020);
+    record.identity_ = nullptr;
+    first = nullptr;
+    second = nullptr;
+    EXPECT_EQ(pool.GetSize(), 1u);
+    auto reused = pool.Intern(100, 20022, 1, "reused", "");
+    ASSERT_TRUE(reused != nullptr);
+    EXPECT_EQ(reused->bundleName, "reused");
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryIdentityCache_Invalidate
+ * @tc.name     telephony state registry identity cache test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryIdentityTest, TelephonyStateRegistryIdentityCache_Invalidate, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryIdentityCache cache;
+    std::string bundleName = "";
+    std::string appIdentifier = "";
+    uint64_t generation = 0;
+    EXPECT_FALSE(cache.Lookup(20020, 1, bundleName, appIdentifier, generation));
+    cache.Insert(20020, 1, "bundle", "appId", generation);
+    EXPECT_EQ(cache.GetSize(), 0u);
+    LocalPackageChangeSource source;
+    EXPECT_TRUE(source.Start([&cache](const std::string &bundleName, int32_t uid) {
+        cache.Invalidate(bundleName, uid);
+    }));
+    cache.SetEnabled(true);
+    EXPECT_FALSE(cache.Lookup(20020, 1, bundleName, appIdentifier, generation));
+    cache.Insert(20020, 1, "bundle", "appId", generation);
+    EXPECT_TRUE(cache.Lookup(20020, 1, bundleName, appIdentifier, generation));
+    EXPECT_EQ(bundleName, "bundle");
+    EXPECT_EQ(appIdentifier, "appId");
+    EXPECT_FALSE(cache.Lookup(20021, 2, bundleName, appIdentifier, generation));
+    source.NotifyChanged("other", 20021);
+    cache.Insert(20021, 2, "other", "", generation);
+    EXPECT_EQ(cache.GetSize(), 1u);
+    source.NotifyChanged("bundle", -1);
+    EXPECT_EQ(cache.GetSize(), 0u);
+    EXPECT_EQ(cache.GetHitCount(), 1u);
+    EXPECT_EQ(cache.GetMissCount(), 2u);
+    source.Stop();
+}
+} // namespace Telephony
+} // namespace OHOS
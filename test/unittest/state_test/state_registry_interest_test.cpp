@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer.h"
+#include "telephony_observer_broker.h"
+#include "telephony_observer_interest.h"
+#include "telephony_observer_options.h"
+#include "telephony_state_registry_interest.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryInterestTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryInterestTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryInterestTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryInterestTest::SetUp(void)
+{
+}
+
+void StateRegistryInterestTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryInterest_Update
+ * @tc.name     telephony state registry interest test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryInterestTest, TelephonyStateRegistryInterest_Update, Function | MediumTest | Level1)
+{
+    const uint32_t signalMask = TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS;
+    const uint32_t cellMask = TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO;
+    TelephonyObserverOptions periodic;
+    periodic.SetDeliveryPolicy(signalMask, DELIVERY_MODE_PERIODIC, 2000);
+    TelephonyStateRegistryInterest::InterestMap current;
+    TelephonyObserverInterest &signal = current[std::make_pair(signalMask, 0)];
+    signal.mask = signalMask;
+    TelephonyStateRegistryInterest::AddSubscriber(signal, periodic);
+    periodic.SetDeliveryPolicy(signalMask, DELIVERY_MODE_PERIODIC, 1000);
+    TelephonyStateRegistryInterest::AddSubscriber(signal, periodic);
+    EXPECT_EQ(signal.subscribers, 2u);
+    EXPECT_EQ(signal.minPeriodMs, 1000u);
+    current[std::make_pair(cellMask, 0)].mask = cellMask;
+
+    TelephonyStateRegistryInterest interest;
+    sptr<TelephonyObserver> observer = new TelephonyObserver();
+    interest.AddObserver(observer, signalMask | cellMask);
+    EXPECT_EQ(interest.GetWatchedMask(), signalMask | cellMask);
+    // a new observer is told every entry of its mask, later only the changed ones
+    std::vector<TelephonyStateRegistryInterest::Notification> notifications;
+    interest.Update(current, notifications);
+    ASSERT_EQ(notifications.size(), 1u);
+    EXPECT_EQ(notifications[0].second.size(), 2u);
+    notifications.clear();
+    interest.Update(current, notifications);
+    EXPECT_TRUE(notifications.empty());
+    // a subscriber that is not paced wants every update
+    TelephonyStateRegistryInterest::AddSubscriber(current[std::make_pair(signalMask, 0)], TelephonyObserverOptions());
+    interest.Update(current, notifications);
+    ASSERT_EQ(notifications.size(), 1u);
+    ASSERT_EQ(notifications[0].second.size(), 1u);
+    EXPECT_EQ(notifications[0].second[0].subscribers, 3u);
+    EXPECT_EQ(notifications[0].second[0].minPeriodMs, 0u);
+    EXPECT_EQ(interest.GetAdvertisedCount(), 3u);
+    EXPECT_TRUE(interest.RemoveObserver(observer->AsObject()));
+    EXPECT_FALSE(interest.RemoveObserver(observer->AsObject()));
+    EXPECT_EQ(interest.GetWatchedMask(), 0u);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_limiter.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryLimiterTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryLimiterTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryLimiterTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryLimiterTest::SetUp(void)
+{
+}
+
+void StateRegistryLimiterTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryLimiter_Level
+ * @tc.name     telephony state registry limiter test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryLimiterTest, TelephonyStateRegistryLimiter_Level, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryLimiter limiter;
+    uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_NETWORK_STATE;
+    int64_t delayMs = 0;
+    EXPECT_EQ(limiter.Admit(mask, 0, true, 0, delayMs), LimiterDecision::DELIVER);
+    limiter.SetConfig(mask, { 200, 2, 1, true });
+    int64_t now = 1000;
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now, delayMs), LimiterDecision::DELIVER);
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now + 50, delayMs), LimiterDecision::DEFER);
+    EXPECT_EQ(delayMs, 150);
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now + 60, delayMs), LimiterDecision::DEFER);
+    EXPECT_EQ(delayMs, 0);
+    EXPECT_EQ(limiter.Admit(mask, 1, true, now + 60, delayMs), LimiterDecision::DELIVER);
+    limiter.OnTrailing(mask, 0, now + 200);
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now + 500, delayMs), LimiterDecision::DEFER);
+    EXPECT_GT(delayMs, 0);
+    auto statistics = limiter.GetStatistics();
+    EXPECT_EQ(statistics[mask].delivered, 2u);
+    EXPECT_EQ(statistics[mask].deferred, 3u);
+    EXPECT_EQ(statistics[mask].trailing, 1u);
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryLimiter_Edge
+ * @tc.name     telephony state registry limiter test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryLimiterTest, TelephonyStateRegistryLimiter_Edge, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryLimiter limiter;
+    uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE;
+    limiter.SetConfig(mask, { 100, 1, 1, false });
+    int64_t delayMs = 0;
+    int64_t now = 1000;
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now, delayMs), LimiterDecision::DELIVER);
+    EXPECT_EQ(limiter.Admit(mask, 0, false, now + 10, delayMs), LimiterDecision::DROP);
+    EXPECT_EQ(limiter.Admit(mask, 0, true, now + 20, delayMs), LimiterDecision::DELIVER);
+    EXPECT_EQ(limiter.Admit(mask, 0, false, now + 200, delayMs), LimiterDecision::DROP);
+    EXPECT_EQ(limiter.Admit(mask, 0, false, now + 2000, delayMs), LimiterDecision::DELIVER);
+    auto statistics = limiter.GetStatistics();
+    EXPECT_EQ(statistics[mask].delivered, 3u);
+    EXPECT_EQ(statistics[mask].dropped, 2u);
+    EXPECT_EQ(statistics[mask].forced, 1u);
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_state_registry_memory.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryMemoryTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryMemoryTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryMemoryTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryMemoryTest::SetUp(void)
+{
+}
+
+void StateRegistryMemoryTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryMemory_Accounting
+ * @tc.name     telephony state registry memory test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryMemoryTest, TelephonyStateRegistryMemory_Accounting, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryMemory memory;
+    memory.AddRecord("bundle", 100);
+    memory.AddRecord("bundle", 100);
+    memory.AddRecord("other", 50);
+    memory.ResizeRecord("other", 50, 80);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::RECORDS).bytes, 280u);
+    memory.Replace(MemoryCategory::SIGNAL_CACHE, 0, 64);
+    memory.Replace(MemoryCategory::SIGNAL_CACHE, 64, 32);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::SIGNAL_CACHE).bytes, 32u);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::SIGNAL_CACHE).highWatermark, 64u);
+    memory.AddQueued(100, "bundle", 8);
+    memory.AddQueued(100, "bundle", 8);
+    std::map<std::string, BundleMemoryUsage> bundles = memory.GetBundleUsage();
+    EXPECT_EQ(bundles["bundle"].records, 2u);
+    EXPECT_EQ(bundles["bundle"].recordBytes, 200u);
+    EXPECT_EQ(bundles["bundle"].queuedBytes, 16u);
+    EXPECT_EQ(bundles["other"].recordBytes, 80u);
+    EXPECT_EQ(memory.GetTotalBytes(), 328u);
+    memory.ClearQueued(100);
+    memory.RemoveRecord("other", 80);
+    memory.Sub(MemoryCategory::EXT_COPIES, 10);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::QUEUED).bytes, 0u);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::QUEUED).highWatermark, 16u);
+    EXPECT_EQ(memory.GetUsage(MemoryCategory::EXT_COPIES).bytes, 0u);
+    EXPECT_EQ(memory.GetBundleUsage().count("other"), 0u);
+    EXPECT_EQ(memory.GetTotalBytes(), 232u);
+    EXPECT_EQ(memory.GetTotalHighWatermark(), 344u);
+    EXPECT_STREQ(TelephonyStateRegistryMemory::GetCategoryName(MemoryCategory::RECORDS), "records");
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "sim_state_type.h"
+#include "telephony_observer_broker.h"
+#include "telephony_observer_mirror.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryMirrorTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryMirrorTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryMirrorTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryMirrorTest::SetUp(void)
+{
+}
+
+void StateRegistryMirrorTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyObserverMirror_WriteRead
+ * @tc.name     telephony observer mirror test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryMirrorTest, TelephonyObserverMirror_WriteRead, Function | MediumTest | Level1)
+{
+    const uint32_t simMask = TelephonyObserverBroker::OBSERVER_MASK_SIM_STATE;
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    EXPECT_EQ(TelephonyObserverMirror::Create(0), nullptr);
+    std::shared_ptr<TelephonyObserverMirror> mirror = TelephonyObserverMirror::Create(2);
+    ASSERT_NE(mirror, nullptr);
+    mirror->Write(0, simMask, [](TelephonyObserverSlotState &state) {
+        state.simState = SimState::SIM_STATE_READY;
+        state.cardType = CardType::SINGLE_MODE_USIM_CARD;
+    });
+    mirror->Write(-1, callMask, [](TelephonyObserverSlotState &state) { state.callState = 1; });
+
+    // the client reads what the registry wrote through its own mapping
+    std::shared_ptr<TelephonyObserverMirror> attached = TelephonyObserverMirror::Attach(mirror->GetAshmem());
+    ASSERT_NE(attached, nullptr);
+    EXPECT_EQ(attached->GetSlotCount(), 2);
+    TelephonyObserverSlotState state;
+    ASSERT_TRUE(attached->Read(0, state));
+    EXPECT_EQ(state.reported, simMask);
+    EXPECT_EQ(state.simState, SimState::SIM_STATE_READY);
+    EXPECT_EQ(state.cardType, CardType::SINGLE_MODE_USIM_CARD);
+    EXPECT_EQ(state.callState, -1);
+    ASSERT_TRUE(attached->Read(-1, state));
+    EXPECT_EQ(state.reported, callMask);
+    EXPECT_EQ(state.callState, 1);
+    ASSERT_TRUE(attached->Read(1, state));
+    EXPECT_EQ(state.reported, 0u);
+    EXPECT_FALSE(attached->Read(2, state));
+    EXPECT_FALSE(attached->Read(-2, state));
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "cell_information.h"
+#include "message_parcel.h"
+#include "signal_information.h"
+#include "state_registry_inner_ipc_interface_code.h"
+#include "telephony_errors.h"
+#include "telephony_observer.h"
+#include "telephony_observer_proxy.h"
+#include "telephony_state_registry_payload.h"
+#include "telephony_state_registry_stub.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryPayloadTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryPayloadTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryPayloadTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryPayloadTest::SetUp(void)
+{
+}
+
+void StateRegistryPayloadTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryPayload_PassThrough
+ * @tc.name     telephony state registry payload test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryPayloadTest, TelephonyStateRegistryPayload_PassThrough, Function | MediumTest | Level1)
+{
+    std::vector<sptr<CellInformation>> cells;
+    for (int32_t cellId = 1; cellId <= 3; cellId++) {
+        sptr<GsmCellInformation> cell = new GsmCellInformation();
+        cell->Init(0, 0, cellId);
+        cell->SetGsmParam(0, cellId, cellId);
+        cells.push_back(cell);
+    }
+    CellInfoPayload typed(cells);
+    const std::vector<uint8_t> &bytes = typed.GetBytes();
+    ASSERT_FALSE(bytes.empty());
+
+    // the bytes a producer sent are decoded once and forwarded without what follows them
+    MessageParcel data;
+    data.WriteBuffer(bytes.data(), bytes.size());
+    data.WriteInt32(0);
+    size_t begin = data.GetReadPosition();
+    int32_t size = data.ReadInt32();
+    auto raw = CellInfoPayload::Read(data, begin, size, &TelephonyStateRegistryStub::ParseCellInfos);
+    ASSERT_NE(raw, nullptr);
+    EXPECT_EQ(raw->GetBytes(), bytes);
+    const std::vector<sptr<CellInformation>> &decoded = raw->GetList();
+    ASSERT_EQ(decoded.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+        EXPECT_EQ(decoded[i]->GetCellId(), cells[i]->GetCellId());
+        EXPECT_EQ(decoded[i]->GetArfcn(), cells[i]->GetArfcn());
+    }
+
+    // a count the elements do not back is not forwarded, the decoded list is marshalled instead
+    MessageParcel truncated;
+    truncated.WriteInt32(size + 1);
+    truncated.WriteBuffer(bytes.data() + sizeof(int32_t), bytes.size() - sizeof(int32_t));
+    begin = truncated.GetReadPosition();
+    size = truncated.ReadInt32();
+    raw = CellInfoPayload::Read(truncated, begin, size, &TelephonyStateRegistryStub::ParseCellInfos);
+    ASSERT_NE(raw, nullptr);
+    EXPECT_EQ(raw->GetList().size(), cells.size());
+    EXPECT_EQ(raw->GetBytes(), bytes);
+
+    // observers never get more signals than the proxy used to send
+    const int32_t maxSignalNum = SignalInformation::MAX_SIGNAL_NUM;
+    std::vector<sptr<SignalInformation>> signals;
+    for (int32_t i = 0; i <= maxSignalNum; i++) {
+        signals.push_back(new GsmSignalInformation());
+    }
+    SignalInfoPayload signalPayload(signals);
+    MessageParcel signalData;
+    const std::vector<uint8_t> &signalBytes = signalPayload.GetBytes();
+    signalData.WriteBuffer(signalBytes.data(), signalBytes.size());
+    EXPECT_EQ(signalData.ReadInt32(), maxSignalNum);
+}
+
+namespace {
+class CellInfoObserver : public TelephonyObserver {
+public:
+    void OnCellInfoUpdated(int32_t slotId, const std::vector<sptr<CellInformation>> &vec) override
+    {
+        cells_ = vec;
+    }
+
+    std::vector<sptr<CellInformation>> cells_;
+};
+} // namespace
+
+/**
+ * @tc.number   TelephonyStateRegistryPayload_Blob
+ * @tc.name     telephony state registry payload test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryPayloadTest, TelephonyStateRegistryPayload_Blob, Function | MediumTest | Level1)
+{
+    std::vector<sptr<CellInformation>> cells;
+    for (int32_t cellId = 1; cellId <= 3; cellId++) {
+        sptr<GsmCellInformation> cell = new GsmCellInformation();
+        cell->Init(0, 0, cellId);
+        cell->SetGsmParam(0, cellId, cellId);
+        cells.push_back(cell);
+    }
+    // small lists stay inline
+    CellInfoPayload small(cells);
+    EXPECT_EQ(small.GetBlob(), nullptr);
+    std::vector<uint8_t> bytes = small.GetBytes();
+    std::vector<uint8_t> large(CellInfoPayload::BLOB_THRESHOLD_BYTES, 0);
+    CellInfoPayload largePayload(std::move(large), cells);
+    sptr<Ashmem> largeBlob = largePayload.GetBlob();
+    ASSERT_NE(largeBlob, nullptr);
+    EXPECT_EQ(largePayload.GetBlob(), largeBlob);
+
+    // the observer reads the list from the region
+    sptr<Ashmem> blob = Ashmem::CreateAshmem("test", static_cast<int32_t>(bytes.size()));
+    ASSERT_NE(blob, nullptr);
+    ASSERT_TRUE(blob->MapReadAndWriteAshmem());
+    ASSERT_TRUE(blob->WriteToAshmem(bytes.data(), static_cast<int32_t>(bytes.size()), 0));
+    blob->UnmapAshmem();
+    CellInfoObserver observer;
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel reply;
+    dataParcel.WriteInterfaceToken(TelephonyObserverProxy::GetDescriptor());
+    dataParcel.WriteInt32(0);
+    dataParcel.WriteInt32(static_cast<int32_t>(bytes.size()));
+    dataParcel.WriteAshmem(blob);
+    EXPECT_EQ(observer.OnRemoteRequest(static_cast<uint32_t>(ObserverBrokerInnerCode::ON_CELL_INFO_BLOB_UPDATED),
+        dataParcel, reply, option), TELEPHONY_ERR_SUCCESS);
+    ASSERT_EQ(observer.cells_.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+        EXPECT_EQ(observer.cells_[i]->GetCellId(), cells[i]->GetCellId());
+    }
+}
+} // namespace Telephony
+} // namespace OHOS
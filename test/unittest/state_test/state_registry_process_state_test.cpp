@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_process_state.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryProcessStateTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryProcessStateTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryProcessStateTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryProcessStateTest::SetUp(void)
+{
+}
+
+void StateRegistryProcessStateTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryProcessState_Defer
+ * @tc.name     telephony state registry process state test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryProcessStateTest, TelephonyStateRegistryProcessState_Defer, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryProcessState processState;
+    pid_t pid = 100;
+    uint32_t mask = TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS;
+    EXPECT_FALSE(processState.Defer(pid, mask, 0));
+    std::set<TelephonyStateRegistryProcessState::PendingKey> pending;
+    processState.SetDeferred(pid, true, pending);
+    EXPECT_TRUE(pending.empty());
+    EXPECT_TRUE(processState.IsDeferred(pid));
+    EXPECT_FALSE(processState.IsDeferred(pid + 1));
+    EXPECT_TRUE(processState.Defer(pid, mask, 0));
+    EXPECT_TRUE(processState.Defer(pid, mask, 0));
+    EXPECT_TRUE(processState.Defer(pid, mask, 1));
+    EXPECT_FALSE(processState.Defer(pid + 1, mask, 0));
+    EXPECT_EQ(processState.GetDeferredProcessCount(), 1u);
+    EXPECT_EQ(processState.GetDeferredCount(), 3u);
+    processState.SetDeferred(pid, false, pending);
+    EXPECT_EQ(pending.size(), 2u);
+    EXPECT_EQ(processState.GetFlushedCount(), 2u);
+    EXPECT_EQ(processState.GetDeferredProcessCount(), 0u);
+    EXPECT_FALSE(processState.Defer(pid, mask, 0));
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryProcessState_LocalSource
+ * @tc.name     telephony state registry process state test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryProcessStateTest, TelephonyStateRegistryProcessState_LocalSource, Function | MediumTest | Level1)
+{
+    LocalProcessStateSource source;
+    source.SetDeferred(100, true);
+    pid_t lastPid = 0;
+    bool lastDeferred = false;
+    EXPECT_TRUE(source.Start([&lastPid, &lastDeferred](pid_t pid, bool deferred) {
+        lastPid = pid;
+        lastDeferred = deferred;
+    }));
+    source.SetDeferred(100, true);
+    EXPECT_EQ(lastPid, 100);
+    EXPECT_TRUE(lastDeferred);
+    source.Stop();
+    source.SetDeferred(100, false);
+    EXPECT_TRUE(lastDeferred);
+}
+} // namespace Telephony
+} // namespace OHOS
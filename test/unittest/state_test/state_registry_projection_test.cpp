@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "message_parcel.h"
+#include "network_state.h"
+#include "signal_information.h"
+#include "telephony_observer_options.h"
+#include "telephony_observer_projection.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryProjectionTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryProjectionTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryProjectionTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryProjectionTest::SetUp(void)
+{
+}
+
+void StateRegistryProjectionTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyObserverProjection_WriteRead
+ * @tc.name     telephony observer projection test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryProjectionTest, TelephonyObserverProjection_WriteRead, Function | MediumTest | Level1)
+{
+    sptr<GsmSignalInformation> gsm = new GsmSignalInformation();
+    gsm->SetValue(-80, 1);
+    gsm->SetSignalLevel(3);
+    std::vector<sptr<SignalInformation>> signals = { gsm };
+    MessageParcel parcel;
+    ASSERT_TRUE(TelephonyObserverProjection::WriteSignalInfo(parcel, SIGNAL_INFO_FIELD_LEVEL, signals));
+    std::vector<sptr<SignalInformation>> read;
+    ASSERT_TRUE(TelephonyObserverProjection::ReadSignalInfo(parcel, read));
+    ASSERT_EQ(read.size(), 1u);
+    EXPECT_EQ(read[0]->GetNetworkType(), SignalInformation::NetworkType::GSM);
+    EXPECT_EQ(read[0]->GetSignalLevel(), 3);
+    // a field left out of the projection reads as 0
+    EXPECT_EQ(read[0]->GetSignalIntensity(), 0);
+
+    sptr<NetworkState> networkState = new NetworkState();
+    networkState->SetNetworkState(RegServiceState::REG_STATE_IN_SERVICE, DomainType::DOMAIN_TYPE_PS);
+    networkState->SetOperatorInfo("longName", "shortName", "46001", DomainType::DOMAIN_TYPE_PS);
+    MessageParcel stateParcel;
+    ASSERT_TRUE(TelephonyObserverProjection::WriteNetworkState(
+        stateParcel, NETWORK_STATE_FIELD_REG_STATE | NETWORK_STATE_FIELD_OPERATOR, networkState));
+    sptr<NetworkState> readState = TelephonyObserverProjection::ReadNetworkState(stateParcel);
+    ASSERT_NE(readState, nullptr);
+    EXPECT_EQ(readState->GetPsRegStatus(), RegServiceState::REG_STATE_IN_SERVICE);
+    EXPECT_EQ(readState->GetLongOperatorName(), "longName");
+    EXPECT_EQ(TelephonyObserverProjection::ReadNetworkState(stateParcel), nullptr);
+}
+} // namespace Telephony
+} // namespace OHOS
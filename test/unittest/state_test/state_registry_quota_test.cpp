@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_state_registry_quota.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryQuotaTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryQuotaTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryQuotaTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryQuotaTest::SetUp(void)
+{
+}
+
+void StateRegistryQuotaTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryQuota_Limits
+ * @tc.name     telephony state registry quota test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryQuotaTest, TelephonyStateRegistryQuota_Limits, Function | MediumTest | Level1)
+{
+    const int32_t uid = 20010000;
+    const pid_t pid = 3000;
+    TelephonyStateRegistryQuota quota(3, 2);
+    EXPECT_TRUE(quota.Acquire(uid, pid, "bundle"));
+    EXPECT_TRUE(quota.Acquire(uid, pid, "bundle"));
+    // the pid holds its limit, another process of the uid may still register once
+    EXPECT_FALSE(quota.Acquire(uid, pid, "bundle"));
+    EXPECT_TRUE(quota.Acquire(uid, pid + 1, "bundle"));
+    EXPECT_FALSE(quota.Acquire(uid, pid + 2, "bundle"));
+    std::map<int32_t, QuotaUsage> usage = quota.GetUidUsage();
+    EXPECT_EQ(usage[uid].bundleName, "bundle");
+    EXPECT_EQ(usage[uid].records, 3u);
+    EXPECT_EQ(usage[uid].rejected, 2u);
+    quota.Release(uid, pid);
+    EXPECT_TRUE(quota.Acquire(uid, pid, "bundle"));
+    quota.SetLimits(0, 0);
+    EXPECT_TRUE(quota.Acquire(uid, pid, "bundle"));
+    EXPECT_EQ(quota.GetUidUsage()[uid].records, 4u);
+}
+} // namespace Telephony
+} // namespace OHOS
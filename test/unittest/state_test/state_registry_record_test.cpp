@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "network_state.h"
+#include "telephony_observer_options.h"
+#include "telephony_state_registry_record.h"
+#include "telephony_types.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+static constexpr int32_t DATA_STATE_CONNECTING = 1;
+static constexpr int32_t NETWORK_TYPE_GSM = 1;
+class StateRegistryRecordTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryRecordTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryRecordTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryRecordTest::SetUp(void)
+{
+}
+
+void StateRegistryRecordTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryRecord_NetworkStateFields
+ * @tc.name     telephony state registry record test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryRecordTest, TelephonyStateRegistryRecord_NetworkStateFields, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryRecord record;
+    TelephonyStateRegistryRecordState state;
+    sptr<NetworkState> networkState = new NetworkState();
+    EXPECT_TRUE(state.IsNetworkStateChanged(record, 0, networkState));
+    TelephonyObserverOptions options;
+    options.networkStateFields_ = NETWORK_STATE_FIELD_REG_STATE;
+    state.SetOptions(options);
+    EXPECT_TRUE(state.IsNetworkStateChanged(record, 0, networkState));
+    sptr<NetworkState> operatorChanged = new NetworkState();
+    operatorChanged->SetOperatorInfo("long", "short", "46001", DomainType::DOMAIN_TYPE_CS);
+    EXPECT_FALSE(state.IsNetworkStateChanged(record, 0, operatorChanged));
+    sptr<NetworkState> regChanged = new NetworkState();
+    regChanged->SetNetworkState(RegServiceState::REG_STATE_IN_SERVICE, DomainType::DOMAIN_TYPE_CS);
+    EXPECT_TRUE(state.IsNetworkStateChanged(record, 0, regChanged));
+    EXPECT_FALSE(state.IsNetworkStateChanged(record, 0, regChanged));
+    TelephonyStateRegistryRecordState copy = state;
+    EXPECT_FALSE(copy.IsNetworkStateChanged(record, 0, regChanged));
+    state.SetOptions(TelephonyObserverOptions());
+    EXPECT_TRUE(state.IsNetworkStateChanged(record, 0, regChanged));
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryRecord_DataConnectionFields
+ * @tc.name     telephony state registry record test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryRecordTest, TelephonyStateRegistryRecord_DataConnectionFields, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryRecord record;
+    TelephonyStateRegistryRecordState state;
+    TelephonyObserverOptions options;
+    options.dataConnectionStateFields_ = DATA_CONNECTION_STATE_FIELD_NETWORK_TYPE;
+    state.SetOptions(options);
+    EXPECT_TRUE(state.IsDataConnectStateChanged(record, 0, DATA_STATE_CONNECTING, NETWORK_TYPE_GSM));
+    EXPECT_FALSE(state.IsDataConnectStateChanged(record, 0, DATA_STATE_CONNECTING + 1, NETWORK_TYPE_GSM));
+    EXPECT_TRUE(state.IsDataConnectStateChanged(record, 0, DATA_STATE_CONNECTING, NETWORK_TYPE_GSM + 1));
+    MessageParcel parcel;
+    EXPECT_TRUE(options.Marshalling(parcel));
+    TelephonyObserverOptions readOptions;
+    EXPECT_TRUE(readOptions.ReadFromParcel(parcel));
+    EXPECT_EQ(readOptions.dataConnectionStateFields_, DATA_CONNECTION_STATE_FIELD_NETWORK_TYPE);
+    EXPECT_FALSE(readOptions.IsDefault());
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryRecord_AllSlots
+ * @tc.name     telephony state registry record test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryRecordTest, TelephonyStateRegistryRecord_AllSlots, Function | MediumTest | Level1)
+{
+    TelephonyStateRegistryRecord record;
+    record.slotId_ = SIM_SLOT_ID_FOR_ALL_SLOTS;
+    EXPECT_TRUE(record.IsSlotMatched(0));
+    EXPECT_TRUE(record.IsSlotMatched(1));
+    EXPECT_TRUE(record.IsSlotMatched(SIM_SLOT_ID_FOR_ALL_SLOTS));
+    EXPECT_TRUE(record.IsSlotMatched(-1));
+    EXPECT_FALSE(record.IsSlotMatched(-2));
+    EXPECT_FALSE(record.IsSlotMatched(MAX_SLOT_COUNT));
+    record.canObserveVSim_ = true;
+    EXPECT_TRUE(record.IsSlotMatched(MAX_SLOT_COUNT));
+    TelephonyStateRegistryRecordState state;
+    TelephonyObserverOptions options;
+    options.dataConnectionStateFields_ = DATA_CONNECTION_STATE_FIELD_STATE;
+    state.SetOptions(options);
+    EXPECT_TRUE(state.IsDataConnectStateChanged(record, 0, DATA_STATE_CONNECTING, NETWORK_TYPE_GSM));
+    EXPECT_TRUE(state.IsDataConnectStateChanged(record, 1, DATA_STATE_CONNECTING, NETWORK_TYPE_GSM));
+    EXPECT_FALSE(state.IsDataConnectStateChanged(record, 0, DATA_STATE_CONNECTING, NETWORK_TYPE_GSM));
+    record.slotId_ = 0;
+    EXPECT_FALSE(record.IsSlotMatched(1));
+}
+} // namespace Telephony
+} // namespace OHOS
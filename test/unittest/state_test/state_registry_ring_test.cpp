@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "cell_information.h"
+#include "message_parcel.h"
+#include "state_registry_inner_ipc_interface_code.h"
+#include "telephony_errors.h"
+#include "telephony_observer.h"
+#include "telephony_observer_proxy.h"
+#include "telephony_observer_ring.h"
+#include "telephony_state_registry_payload.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryRingTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryRingTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryRingTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryRingTest::SetUp(void)
+{
+}
+
+void StateRegistryRingTest::TearDown(void)
+{
+}
+
+namespace {
+class CellInfoObserver : public TelephonyObserver {
+public:
+    void OnCellInfoUpdated(int32_t slotId, const std::vector<sptr<CellInformation>> &vec) override
+    {
+        cells_ = vec;
+    }
+
+    std::vector<sptr<CellInformation>> cells_;
+};
+} // namespace
+
+/**
+ * @tc.number   TelephonyObserverRing_PushDrain
+ * @tc.name     telephony observer ring test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryRingTest, TelephonyObserverRing_PushDrain, Function | MediumTest | Level1)
+{
+    std::vector<sptr<CellInformation>> cells;
+    for (int32_t cellId = 1; cellId <= 2; cellId++) {
+        sptr<GsmCellInformation> cell = new GsmCellInformation();
+        cell->Init(0, 0, cellId);
+        cells.push_back(cell);
+    }
+    std::vector<uint8_t> bytes = CellInfoPayload(cells).GetBytes();
+    MessageParcel body;
+    body.WriteInt32(0);
+    body.WriteBuffer(bytes.data(), bytes.size());
+    uint32_t code = static_cast<uint32_t>(TelephonyObserverBroker::ObserverBrokerCode::ON_CELL_INFO_UPDATED);
+    const int32_t capacity = 1024;
+    std::shared_ptr<TelephonyObserverRing> ring =
+        TelephonyObserverRing::Create(1, 0, TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO, capacity);
+    ASSERT_NE(ring, nullptr);
+    // only the first record after a drain wakes the observer
+    EXPECT_TRUE(ring->Push(code, body));
+    EXPECT_FALSE(ring->Push(code, body));
+
+    CellInfoObserver observer;
+    MessageOption option;
+    MessageParcel attachParcel;
+    MessageParcel reply;
+    attachParcel.WriteInterfaceToken(TelephonyObserverProxy::GetDescriptor());
+    attachParcel.WriteUint32(ring->GetId());
+    attachParcel.WriteAshmem(ring->GetAshmem());
+    EXPECT_EQ(observer.OnRemoteRequest(static_cast<uint32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_ATTACHED),
+        attachParcel, reply, option), TELEPHONY_ERR_SUCCESS);
+    MessageParcel doorbellParcel;
+    doorbellParcel.WriteInterfaceToken(TelephonyObserverProxy::GetDescriptor());
+    doorbellParcel.WriteUint32(ring->GetId());
+    EXPECT_EQ(observer.OnRemoteRequest(static_cast<uint32_t>(ObserverBrokerInnerCode::ON_EVENT_RING_DOORBELL),
+        doorbellParcel, reply, option), TELEPHONY_ERR_SUCCESS);
+    ASSERT_EQ(observer.cells_.size(), cells.size());
+    EXPECT_EQ(observer.cells_[1]->GetCellId(), cells[1]->GetCellId());
+
+    // records that do not fit are dropped until the observer has drained the ring
+    EXPECT_TRUE(ring->Push(code, body));
+    for (int32_t i = 0; i < capacity && ring->GetDropped() == 0; i++) {
+        ring->Push(code, body);
+    }
+    EXPECT_EQ(ring->GetDropped(), 1u);
+    EXPECT_FALSE(ring->Push(code, body));
+    EXPECT_EQ(ring->GetDropped(), 2u);
+    int32_t records = 0;
+    auto handle = [&records](uint32_t recordCode, const uint8_t *recordBody, size_t size) { records++; };
+    EXPECT_TRUE(ring->Drain(handle));
+    EXPECT_GT(records, 0);
+    EXPECT_FALSE(ring->Drain(handle));
+    EXPECT_TRUE(ring->Push(code, body));
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "message_parcel.h"
+#include "signal_information.h"
+#include "telephony_observer_signal_statistics.h"
+#include "telephony_state_registry_signal_statistics.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistrySignalStatisticsTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistrySignalStatisticsTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistrySignalStatisticsTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistrySignalStatisticsTest::SetUp(void)
+{
+}
+
+void StateRegistrySignalStatisticsTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistrySignalStatistics_Add
+ * @tc.name     telephony state registry signal statistics test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistrySignalStatisticsTest, TelephonyStateRegistrySignalStatistics_Add, Function | MediumTest | Level1)
+{
+    const int32_t slotId = 0;
+    const int32_t weakLevel = 1;
+    const int32_t strongLevel = 4;
+    TelephonyStateRegistrySignalStatistics signalStatistics;
+    sptr<SignalInformation> gsm = new GsmSignalInformation();
+    gsm->SetSignalLevel(weakLevel);
+    signalStatistics.Add(slotId, { gsm }, 0);
+    gsm->SetSignalLevel(strongLevel);
+    signalStatistics.Add(slotId, { gsm }, 1000);
+    std::vector<TelephonyObserverSignalStatistics> statistics;
+    signalStatistics.Get(slotId, 1500, statistics);
+    ASSERT_EQ(statistics.size(), 1u);
+    EXPECT_EQ(statistics[0].samples, 2u);
+    EXPECT_EQ(statistics[0].windowMinDbm, statistics[0].lastDbm);
+    EXPECT_EQ(statistics[0].windowMaxDbm, statistics[0].lastDbm);
+    EXPECT_EQ(statistics[0].levelDurationMs[weakLevel], 1000);
+    // the current level counts up to the time asked for
+    EXPECT_EQ(statistics[0].levelDurationMs[strongLevel], 500);
+    // a report without GSM stops its time
+    signalStatistics.Add(slotId, {}, 2000);
+    signalStatistics.Get(slotId, 5000, statistics);
+    ASSERT_EQ(statistics.size(), 1u);
+    EXPECT_EQ(statistics[0].levelDurationMs[strongLevel], 1000);
+    signalStatistics.Get(1, 5000, statistics);
+    EXPECT_TRUE(statistics.empty());
+    MessageParcel parcel;
+    signalStatistics.Get(slotId, 5000, statistics);
+    ASSERT_TRUE(TelephonyObserverSignalStatistics::WriteList(parcel, statistics));
+    std::vector<TelephonyObserverSignalStatistics> read;
+    ASSERT_TRUE(TelephonyObserverSignalStatistics::ReadList(parcel, read));
+    ASSERT_EQ(read.size(), 1u);
+    EXPECT_EQ(read[0].samples, 2u);
+    EXPECT_EQ(read[0].levelDurationMs[weakLevel], 1000);
+}
+} // namespace Telephony
+} // namespace OHOS
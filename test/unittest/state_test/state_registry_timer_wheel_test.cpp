@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_timer_wheel.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryTimerWheelTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryTimerWheelTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryTimerWheelTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryTimerWheelTest::SetUp(void)
+{
+}
+
+void StateRegistryTimerWheelTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryTimerWheel_Hold
+ * @tc.name     telephony state registry timer wheel test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryTimerWheelTest, TelephonyStateRegistryTimerWheel_Hold, Function | MediumTest | Level1)
+{
+    const uint32_t signalMask = TelephonyObserverBroker::OBSERVER_MASK_SIGNAL_STRENGTHS;
+    const TelephonyStateRegistryTimerWheel::PacedKey periodicKey = std::make_tuple(1, signalMask, 0);
+    const TelephonyStateRegistryTimerWheel::PacedKey latestKey = std::make_tuple(2, signalMask, 0);
+    TelephonyStateRegistryTimerWheel timerWheel;
+    bool startTick = false;
+    EXPECT_FALSE(timerWheel.Hold(periodicKey, 1000, 0, startTick));
+    EXPECT_TRUE(timerWheel.Hold(periodicKey, 1000, 100, startTick));
+    EXPECT_TRUE(startTick);
+    // held again before the period ends, the pending delivery carries the latest value
+    EXPECT_TRUE(timerWheel.Hold(periodicKey, 1000, 200, startTick));
+    EXPECT_FALSE(startTick);
+    EXPECT_EQ(timerWheel.GetHeldCount(), 1u);
+    std::vector<TelephonyStateRegistryTimerWheel::PacedKey> due;
+    EXPECT_TRUE(timerWheel.Advance(500, due));
+    EXPECT_TRUE(due.empty());
+    EXPECT_FALSE(timerWheel.Advance(1000, due));
+    ASSERT_EQ(due.size(), 1u);
+    EXPECT_TRUE(due[0] == periodicKey);
+    EXPECT_FALSE(timerWheel.Hold(periodicKey, 1000, 2500, startTick));
+    // latest only is paced by a single tick, a removed record drops its held key
+    EXPECT_FALSE(timerWheel.Hold(latestKey, 0, 2500, startTick));
+    EXPECT_TRUE(timerWheel.Hold(latestKey, 0, 2510, startTick));
+    EXPECT_TRUE(startTick);
+    timerWheel.Remove(2);
+    due.clear();
+    EXPECT_FALSE(timerWheel.Advance(2600, due));
+    EXPECT_TRUE(due.empty());
+    TimerWheelStatistics statistics = timerWheel.GetStatistics();
+    EXPECT_EQ(statistics.immediate, 3u);
+    EXPECT_EQ(statistics.held, 3u);
+    EXPECT_EQ(statistics.fired, 1u);
+}
+} // namespace Telephony
+} // namespace OHOS
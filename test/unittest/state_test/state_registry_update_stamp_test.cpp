@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_errors.h"
+#include "telephony_observer.h"
+#include "telephony_observer_proxy.h"
+#include "telephony_observer_update_stamp.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryUpdateStampTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryUpdateStampTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryUpdateStampTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryUpdateStampTest::SetUp(void)
+{
+}
+
+void StateRegistryUpdateStampTest::TearDown(void)
+{
+}
+
+class StampedCallStateExObserver : public TelephonyObserver {
+public:
+    void OnCallStateUpdatedEx(int32_t slotId, int32_t callStateEx) override
+    {
+        sequences_.push_back(TelephonyObserverUpdateStamp::GetCurrent().sequence);
+    }
+
+    std::vector<uint64_t> sequences_;
+};
+
+static int32_t SendCallStateEx(TelephonyObserver &observer, const TelephonyObserverUpdateStamp *stamp)
+{
+    MessageOption option;
+    MessageParcel dataParcel;
+    MessageParcel reply;
+    dataParcel.WriteInterfaceToken(TelephonyObserverProxy::GetDescriptor());
+    dataParcel.WriteInt32(0);
+    dataParcel.WriteInt32(0);
+    if (stamp != nullptr) {
+        stamp->Marshalling(dataParcel);
+    }
+    return observer.OnRemoteRequest(
+        static_cast<uint32_t>(TelephonyObserverBroker::ObserverBrokerCode::ON_CALL_STATE_EX_UPDATED), dataParcel,
+        reply, option);
+}
+
+/**
+ * @tc.number   TelephonyObserver_UpdateStamp
+ * @tc.name     telephony observer test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryUpdateStampTest, TelephonyObserver_UpdateStamp, Function | MediumTest | Level1)
+{
+    TelephonyObserverUpdateStamp stamp;
+    stamp.epoch = 1;
+    stamp.sequence = 2;
+    stamp.timestampMs = 100;
+    MessageParcel parcel;
+    ASSERT_TRUE(stamp.Marshalling(parcel));
+    TelephonyObserverUpdateStamp read;
+    ASSERT_TRUE(read.ReadFromParcel(parcel));
+    EXPECT_EQ(read.epoch, 1u);
+    EXPECT_EQ(read.sequence, 2u);
+    EXPECT_EQ(read.timestampMs, 100);
+    EXPECT_FALSE(read.ReadFromParcel(parcel));
+    EXPECT_FALSE(read.IsValid());
+
+    StampedCallStateExObserver observer;
+    EXPECT_EQ(SendCallStateEx(observer, &stamp), TELEPHONY_ERR_SUCCESS);
+    TelephonyObserverUpdateStamp older = stamp;
+    older.sequence = 1;
+    EXPECT_EQ(SendCallStateEx(observer, &older), TELEPHONY_ERR_SUCCESS);
+    EXPECT_EQ(SendCallStateEx(observer, &stamp), TELEPHONY_ERR_SUCCESS);
+    TelephonyObserverUpdateStamp restarted = older;
+    restarted.epoch = 2;
+    EXPECT_EQ(SendCallStateEx(observer, &restarted), TELEPHONY_ERR_SUCCESS);
+    EXPECT_EQ(SendCallStateEx(observer, nullptr), TELEPHONY_ERR_SUCCESS);
+    std::vector<uint64_t> expected = { 2, 1, 0 };
+    EXPECT_EQ(observer.sequences_, expected);
+    EXPECT_FALSE(TelephonyObserverUpdateStamp::GetCurrent().IsValid());
+}
+} // namespace Telephony
+} // namespace OHOS
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "gtest/gtest.h"
+#include "telephony_observer_broker.h"
+#include "telephony_state_registry_wakeup.h"
+
+namespace OHOS {
+namespace Telephony {
+using namespace testing::ext;
+class StateRegistryWakeupTest : public testing::Test {
+public:
+    static void SetUpTestCase();
+    static void TearDownTestCase();
+    void SetUp();
+    void TearDown();
+};
+
+void StateRegistryWakeupTest::SetUpTestCase(void)
+{
+}
+
+void StateRegistryWakeupTest::TearDownTestCase(void)
+{
+}
+
+void StateRegistryWakeupTest::SetUp(void)
+{
+}
+
+void StateRegistryWakeupTest::TearDown(void)
+{
+}
+
+/**
+ * @tc.number   TelephonyStateRegistryWakeup_Window
+ * @tc.name     telephony state registry wakeup test
+ * @tc.desc     Function test
+ */
+HWTEST_F(StateRegistryWakeupTest, TelephonyStateRegistryWakeup_Window, Function | MediumTest | Level1)
+{
+    const uint32_t cellMask = TelephonyObserverBroker::OBSERVER_MASK_CELL_INFO;
+    const uint32_t flowMask = TelephonyObserverBroker::OBSERVER_MASK_DATA_FLOW;
+    const uint32_t callMask = TelephonyObserverBroker::OBSERVER_MASK_CALL_STATE;
+    const pid_t pid = 3000;
+    TelephonyStateRegistryWakeup wakeup;
+    wakeup.SetBudget(cellMask, 2000);
+    wakeup.SetBudget(flowMask, 500);
+    int64_t closeDelayMs = 0;
+    EXPECT_FALSE(wakeup.Hold(pid, callMask, 0, 0, closeDelayMs));
+    EXPECT_TRUE(wakeup.Hold(pid, cellMask, 0, 0, closeDelayMs));
+    EXPECT_EQ(closeDelayMs, 2000);
+    EXPECT_TRUE(wakeup.Hold(pid, cellMask, 0, 100, closeDelayMs));
+    EXPECT_EQ(closeDelayMs, 0);
+    // data flow is due before the window would close, the window closes earlier
+    EXPECT_TRUE(wakeup.Hold(pid, flowMask, 0, 200, closeDelayMs));
+    EXPECT_EQ(closeDelayMs, 500);
+    std::set<TelephonyStateRegistryWakeup::PendingKey> keys;
+    EXPECT_FALSE(wakeup.Close(pid, 600, keys));
+    EXPECT_TRUE(wakeup.Close(pid, 700, keys));
+    EXPECT_EQ(keys.size(), 2u);
+    // the close scheduled for the first deadline finds nothing
+    EXPECT_FALSE(wakeup.Close(pid, 2000, keys));
+    std::map<uint32_t, WakeupStatistics> statistics = wakeup.GetStatistics();
+    EXPECT_EQ(statistics[cellMask].updates, 2u);
+    EXPECT_EQ(statistics[cellMask].deliveries, 1u);
+    EXPECT_EQ(statistics[flowMask].deliveries, 1u);
+    EXPECT_EQ(wakeup.GetClosedCount(), 1u);
+    wakeup.SetBudget(cellMask, 0);
+    EXPECT_EQ(wakeup.GetBudget(cellMask), 0);
+    EXPECT_FALSE(wakeup.Hold(pid, cellMask, 0, 3000, closeDelayMs));
+}
+} // namespace Telephony
+} // namespace OHOS